@@ -28,6 +28,12 @@ extern "C" {
 #define chachapoly_decrypt torsion_chachapoly_decrypt
 #define chachapoly_auth torsion_chachapoly_auth
 #define chachapoly_final torsion_chachapoly_final
+#define chachapoly_encrypt_iov torsion_chachapoly_encrypt_iov
+#define chachapoly_decrypt_iov torsion_chachapoly_decrypt_iov
+#define chachapoly_seal torsion_chachapoly_seal
+#define chachapoly_open torsion_chachapoly_open
+#define chachapoly_seal_batch torsion_chachapoly_seal_batch
+#define chachapoly_open_batch torsion_chachapoly_open_batch
 
 /*
  * Types
@@ -40,6 +46,22 @@ typedef struct chachapoly_s {
   uint64_t ctlen;
 } chachapoly_t;
 
+typedef struct chachapoly_iov_s {
+  unsigned char *data;
+  size_t len;
+} chachapoly_iov_t;
+
+typedef struct chachapoly_msg_s {
+  const unsigned char *key;
+  const unsigned char *iv;
+  size_t iv_len;
+  const unsigned char *aad;
+  size_t aad_len;
+  unsigned char *data;
+  size_t len;
+  unsigned char *tag;
+} chachapoly_msg_t;
+
 /*
  * AEAD
  */
@@ -84,6 +106,42 @@ chachapoly_auth(chachapoly_t *aead, const unsigned char *data, size_t len);
 TORSION_EXTERN void
 chachapoly_final(chachapoly_t *aead, unsigned char *tag);
 
+TORSION_EXTERN void
+chachapoly_encrypt_iov(chachapoly_t *aead,
+                       const chachapoly_iov_t *iov,
+                       size_t iov_len);
+
+TORSION_EXTERN void
+chachapoly_decrypt_iov(chachapoly_t *aead,
+                       const chachapoly_iov_t *iov,
+                       size_t iov_len);
+
+TORSION_EXTERN void
+chachapoly_seal(unsigned char *tag,
+                const chachapoly_iov_t *iov,
+                size_t iov_len,
+                const unsigned char *aad,
+                size_t aad_len,
+                const unsigned char *key,
+                const unsigned char *iv,
+                size_t iv_len);
+
+TORSION_EXTERN int
+chachapoly_open(const unsigned char *tag,
+                const chachapoly_iov_t *iov,
+                size_t iov_len,
+                const unsigned char *aad,
+                size_t aad_len,
+                const unsigned char *key,
+                const unsigned char *iv,
+                size_t iv_len);
+
+TORSION_EXTERN void
+chachapoly_seal_batch(const chachapoly_msg_t *msgs, size_t len);
+
+TORSION_EXTERN int
+chachapoly_open_batch(int *valid, const chachapoly_msg_t *msgs, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
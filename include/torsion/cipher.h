@@ -90,6 +90,8 @@ extern "C" {
 #define gcm_encrypt torsion_gcm_encrypt
 #define gcm_decrypt torsion_gcm_decrypt
 #define gcm_digest torsion_gcm_digest
+#define gcm_seal_batch torsion_gcm_seal_batch
+#define gcm_open_batch torsion_gcm_open_batch
 #define ccm_init torsion_ccm_init
 #define ccm_setup torsion_ccm_setup
 #define ccm_encrypt torsion_ccm_encrypt
@@ -299,6 +301,17 @@ typedef struct gcm_s {
   unsigned char mask[16];
 } gcm_t;
 
+typedef struct gcm_msg_s {
+  const cipher_t *cipher;
+  const unsigned char *iv;
+  size_t iv_len;
+  const unsigned char *aad;
+  size_t aad_len;
+  unsigned char *data;
+  size_t len;
+  unsigned char *tag;
+} gcm_msg_t;
+
 struct cmac_s {
   unsigned char mac[CIPHER_MAX_BLOCK_SIZE];
   size_t pos;
@@ -718,6 +731,12 @@ gcm_decrypt(gcm_t *mode, const cipher_t *cipher,
 TORSION_EXTERN void
 gcm_digest(gcm_t *mode, unsigned char *mac);
 
+TORSION_EXTERN int
+gcm_seal_batch(const gcm_msg_t *msgs, size_t len);
+
+TORSION_EXTERN int
+gcm_open_batch(int *valid, const gcm_msg_t *msgs, size_t len);
+
 /*
  * CCM
  */
@@ -20,6 +20,7 @@ extern "C" {
 
 #define dsa_params_create torsion_dsa_params_create
 #define dsa_params_generate torsion_dsa_params_generate
+#define dsa_params_generate_with_runner torsion_dsa_params_generate_with_runner
 #define dsa_params_bits torsion_dsa_params_bits
 #define dsa_params_qbits torsion_dsa_params_qbits
 #define dsa_params_verify torsion_dsa_params_verify
@@ -43,6 +44,12 @@ extern "C" {
 #define dsa_sign torsion_dsa_sign
 #define dsa_verify torsion_dsa_verify
 #define dsa_derive torsion_dsa_derive
+#define dsa_domain_create torsion_dsa_domain_create
+#define dsa_domain_destroy torsion_dsa_domain_destroy
+#define dsa_domain_bits torsion_dsa_domain_bits
+#define dsa_domain_qbits torsion_dsa_domain_qbits
+#define dsa_domain_privkey_create torsion_dsa_domain_privkey_create
+#define dsa_domain_sign torsion_dsa_domain_sign
 
 /*
  * Definitions
@@ -88,6 +95,15 @@ extern "C" {
   + 2 + 1 + DSA_MAX_QSIZE /* x */ \
 )
 
+/*
+ * Types
+ */
+
+typedef struct dsa_domain_s dsa_domain_t;
+
+typedef void dsa_job_f(void *);
+typedef void dsa_run_f(dsa_job_f *, void **, size_t, void *);
+
 /*
  * DSA
  */
@@ -102,6 +118,23 @@ dsa_params_generate(unsigned char *out,
                     unsigned int bits,
                     const unsigned char *entropy);
 
+/* The search for p is split into windows of candidates
+ * which are handed to the runner as jobs. The runner must
+ * call `job(args[i])` for each `i < len` before returning;
+ * jobs may run concurrently and in any order. libtorsion
+ * never creates threads of its own. The parameters depend
+ * only on `entropy`, not on whether or how the jobs were
+ * run.
+ */
+
+TORSION_EXTERN int
+dsa_params_generate_with_runner(unsigned char *out,
+                                size_t *out_len,
+                                unsigned int bits,
+                                const unsigned char *entropy,
+                                dsa_run_f *run,
+                                void *arg);
+
 TORSION_EXTERN unsigned int
 dsa_params_bits(const unsigned char *params, size_t params_len);
 
@@ -200,6 +233,43 @@ dsa_derive(unsigned char *out, size_t *out_len,
            const unsigned char *pub, size_t pub_len,
            const unsigned char *priv, size_t priv_len);
 
+/*
+ * Domain Handles
+ */
+
+/* Handles hold a parsed set of domain parameters along
+ * with a precomputed fixed-base table for the generator.
+ * Key creation and signing with keys from that domain
+ * become several times cheaper once the table is built.
+ * Handles are never modified after creation and may be
+ * shared between threads.
+ */
+
+TORSION_EXTERN dsa_domain_t *
+dsa_domain_create(const unsigned char *params, size_t params_len);
+
+TORSION_EXTERN void
+dsa_domain_destroy(dsa_domain_t *domain);
+
+TORSION_EXTERN unsigned int
+dsa_domain_bits(const dsa_domain_t *domain);
+
+TORSION_EXTERN unsigned int
+dsa_domain_qbits(const dsa_domain_t *domain);
+
+TORSION_EXTERN int
+dsa_domain_privkey_create(unsigned char *out,
+                          size_t *out_len,
+                          const dsa_domain_t *domain,
+                          const unsigned char *entropy);
+
+TORSION_EXTERN int
+dsa_domain_sign(unsigned char *out, size_t *out_len,
+                const unsigned char *msg, size_t msg_len,
+                const unsigned char *key, size_t key_len,
+                const dsa_domain_t *domain,
+                const unsigned char *entropy);
+
 #ifdef __cplusplus
 }
 #endif
@@ -66,6 +66,7 @@ extern "C" {
 #define ecdsa_pubkey_export torsion_ecdsa_pubkey_export
 #define ecdsa_pubkey_import torsion_ecdsa_pubkey_import
 #define ecdsa_pubkey_tweak_add torsion_ecdsa_pubkey_tweak_add
+#define ecdsa_pubkey_tweak_add_batch torsion_ecdsa_pubkey_tweak_add_batch
 #define ecdsa_pubkey_tweak_mul torsion_ecdsa_pubkey_tweak_mul
 #define ecdsa_pubkey_add torsion_ecdsa_pubkey_add
 #define ecdsa_pubkey_combine torsion_ecdsa_pubkey_combine
@@ -77,8 +78,13 @@ extern "C" {
 #define ecdsa_is_low_s torsion_ecdsa_is_low_s
 #define ecdsa_sign torsion_ecdsa_sign
 #define ecdsa_sign_internal torsion_ecdsa_sign_internal
+#define ecdsa_presign_create torsion_ecdsa_presign_create
+#define ecdsa_presign_destroy torsion_ecdsa_presign_destroy
+#define ecdsa_presign_fill torsion_ecdsa_presign_fill
+#define ecdsa_sign_presigned torsion_ecdsa_sign_presigned
 #define ecdsa_verify torsion_ecdsa_verify
 #define ecdsa_recover torsion_ecdsa_recover
+#define ecdsa_recover_batch torsion_ecdsa_recover_batch
 #define ecdsa_derive torsion_ecdsa_derive
 
 #define bipschnorr_support torsion_bipschnorr_support
@@ -106,7 +112,9 @@ extern "C" {
 #define bip340_pubkey_export torsion_bip340_pubkey_export
 #define bip340_pubkey_import torsion_bip340_pubkey_import
 #define bip340_pubkey_tweak_add torsion_bip340_pubkey_tweak_add
+#define bip340_pubkey_tweak_add_batch torsion_bip340_pubkey_tweak_add_batch
 #define bip340_pubkey_tweak_add_check torsion_bip340_pubkey_tweak_add_check
+#define bip340_pubkey_tweak_check_batch torsion_bip340_pubkey_tweak_check_batch
 #define bip340_pubkey_tweak_mul torsion_bip340_pubkey_tweak_mul
 #define bip340_pubkey_tweak_mul_check torsion_bip340_pubkey_tweak_mul_check
 #define bip340_pubkey_add torsion_bip340_pubkey_add
@@ -134,6 +142,7 @@ extern "C" {
 #define ecdh_pubkey_is_small torsion_ecdh_pubkey_is_small
 #define ecdh_pubkey_has_torsion torsion_ecdh_pubkey_has_torsion
 #define ecdh_derive torsion_ecdh_derive
+#define ecdh_derive_batch torsion_ecdh_derive_batch
 
 #define eddsa_privkey_size torsion_eddsa_privkey_size
 #define eddsa_pubkey_size torsion_eddsa_pubkey_size
@@ -279,6 +288,7 @@ typedef enum edwards_curve_id {
 
 typedef struct wei_s wei_curve_t;
 typedef struct wei_scratch_s wei_scratch_t;
+typedef struct ecdsa_presign_s ecdsa_presign_t;
 typedef struct mont_s mont_curve_t;
 typedef struct edwards_s edwards_curve_t;
 typedef struct edwards_scratch_s edwards_scratch_t;
@@ -499,6 +509,17 @@ ecdsa_pubkey_tweak_add(const wei_curve_t *ec,
                        const unsigned char *tweak,
                        int compact);
 
+TORSION_EXTERN int
+ecdsa_pubkey_tweak_add_batch(const wei_curve_t *ec,
+                             unsigned char *const *outs,
+                             size_t *out_lens,
+                             const unsigned char *const *pubs,
+                             const size_t *pub_lens,
+                             const unsigned char *const *tweaks,
+                             int *results,
+                             size_t len,
+                             int compact);
+
 TORSION_EXTERN int
 ecdsa_pubkey_tweak_mul(const wei_curve_t *ec,
                        unsigned char *out,
@@ -578,6 +599,26 @@ ecdsa_sign_internal(const wei_curve_t *ec,
                     const unsigned char *priv,
                     ecdsa_redefine_f *redefine);
 
+TORSION_EXTERN ecdsa_presign_t *
+ecdsa_presign_create(const wei_curve_t *ec,
+                     size_t size,
+                     const unsigned char *entropy);
+
+TORSION_EXTERN void
+ecdsa_presign_destroy(const wei_curve_t *ec, ecdsa_presign_t *pool);
+
+TORSION_EXTERN size_t
+ecdsa_presign_fill(const wei_curve_t *ec, ecdsa_presign_t *pool, size_t n);
+
+TORSION_EXTERN int
+ecdsa_sign_presigned(const wei_curve_t *ec,
+                     unsigned char *sig,
+                     unsigned int *param,
+                     const unsigned char *msg,
+                     size_t msg_len,
+                     const unsigned char *priv,
+                     ecdsa_presign_t *pool);
+
 TORSION_EXTERN int
 ecdsa_verify(const wei_curve_t *ec,
              const unsigned char *msg,
@@ -596,6 +637,18 @@ ecdsa_recover(const wei_curve_t *ec,
               unsigned int param,
               int compact);
 
+TORSION_EXTERN int
+ecdsa_recover_batch(const wei_curve_t *ec,
+                    unsigned char *const *pubs,
+                    size_t *pub_lens,
+                    const unsigned char *const *msgs,
+                    const size_t *msg_lens,
+                    const unsigned char *const *sigs,
+                    const unsigned int *params,
+                    int *results,
+                    size_t len,
+                    int compact);
+
 TORSION_EXTERN int
 ecdsa_derive(const wei_curve_t *ec,
              unsigned char *secret,
@@ -771,6 +824,15 @@ bip340_pubkey_tweak_add(const wei_curve_t *ec,
                         const unsigned char *pub,
                         const unsigned char *tweak);
 
+TORSION_EXTERN int
+bip340_pubkey_tweak_add_batch(const wei_curve_t *ec,
+                              unsigned char *const *outs,
+                              int *negated,
+                              const unsigned char *const *pubs,
+                              const unsigned char *const *tweaks,
+                              int *results,
+                              size_t len);
+
 TORSION_EXTERN int
 bip340_pubkey_tweak_add_check(const wei_curve_t *ec,
                               const unsigned char *pub,
@@ -778,6 +840,15 @@ bip340_pubkey_tweak_add_check(const wei_curve_t *ec,
                               const unsigned char *expect,
                               int negated);
 
+TORSION_EXTERN int
+bip340_pubkey_tweak_check_batch(const wei_curve_t *ec,
+                                const unsigned char *const *pubs,
+                                const unsigned char *const *tweaks,
+                                const unsigned char *const *expects,
+                                const int *negated,
+                                size_t len,
+                                wei_scratch_t *scratch);
+
 TORSION_EXTERN int
 bip340_pubkey_tweak_mul(const wei_curve_t *ec,
                         unsigned char *out,
@@ -928,6 +999,13 @@ ecdh_derive(const mont_curve_t *ec,
             const unsigned char *pub,
             const unsigned char *priv);
 
+TORSION_EXTERN int
+ecdh_derive_batch(const mont_curve_t *ec,
+                  unsigned char *const *secrets,
+                  const unsigned char *const *pubs,
+                  const unsigned char *const *privs,
+                  size_t len);
+
 /*
  * EdDSA
  */
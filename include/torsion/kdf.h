@@ -23,6 +23,7 @@ extern "C" {
 #define bcrypt_hash192 torsion_bcrypt_hash192
 #define bcrypt_hash256 torsion_bcrypt_hash256
 #define bcrypt_pbkdf torsion_bcrypt_pbkdf
+#define bcrypt_pbkdf_with_runner torsion_bcrypt_pbkdf_with_runner
 #define bcrypt_derive torsion_bcrypt_derive
 #define bcrypt_generate torsion_bcrypt_generate
 #define bcrypt_generate_with_salt64 torsion_bcrypt_generate_with_salt64
@@ -35,6 +36,14 @@ extern "C" {
 #define pgpdf_derive_salted torsion_pgpdf_derive_salted
 #define pgpdf_derive_iterated torsion_pgpdf_derive_iterated
 #define scrypt_derive torsion_scrypt_derive
+#define scrypt_derive_with_runner torsion_scrypt_derive_with_runner
+
+/*
+ * Types
+ */
+
+typedef void kdf_job_f(void *);
+typedef void kdf_run_f(kdf_job_f *, void **, size_t, void *);
 
 /*
  * Bcrypt
@@ -58,6 +67,18 @@ bcrypt_pbkdf(unsigned char *key,
              const unsigned char *salt, size_t salt_len,
              unsigned int rounds, size_t size);
 
+/* The output strides of bcrypt_pbkdf are independent.
+ * A runner (see scrypt_derive_with_runner) is handed
+ * them as jobs of up to two strides each.
+ */
+
+TORSION_EXTERN int
+bcrypt_pbkdf_with_runner(unsigned char *key,
+                         const unsigned char *pass, size_t pass_len,
+                         const unsigned char *salt, size_t salt_len,
+                         unsigned int rounds, size_t size,
+                         kdf_run_f *run, void *arg);
+
 TORSION_EXTERN int
 bcrypt_derive(unsigned char *out,
               const unsigned char *pass, size_t pass_len,
@@ -172,6 +193,30 @@ scrypt_derive(unsigned char *out,
               uint32_t p,
               size_t len);
 
+/* The p smix computations of scrypt are independent.
+ * By default they run back to back on the calling
+ * thread; libtorsion never creates threads of its own.
+ * A runner is handed every smix as a job and must call
+ * `job(args[i])` for each `i < len` before returning.
+ * Jobs may run concurrently and in any order, and the
+ * derivation fails if one is not run. Each job needs
+ * its own scratch space, so a runner costs p times the
+ * memory of scrypt_derive (128 * r * N bytes per job).
+ */
+
+TORSION_EXTERN int
+scrypt_derive_with_runner(unsigned char *out,
+                          const unsigned char *pass,
+                          size_t pass_len,
+                          const unsigned char *salt,
+                          size_t salt_len,
+                          uint64_t N,
+                          uint32_t r,
+                          uint32_t p,
+                          size_t len,
+                          kdf_run_f *run,
+                          void *arg);
+
 #ifdef __cplusplus
 }
 #endif
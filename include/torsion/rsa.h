@@ -21,6 +21,8 @@ extern "C" {
  */
 
 #define rsa_privkey_generate torsion_rsa_privkey_generate
+#define rsa_privkey_generate_multi torsion_rsa_privkey_generate_multi
+#define rsa_privkey_generate_with_runner torsion_rsa_privkey_generate_with_runner
 #define rsa_privkey_bits torsion_rsa_privkey_bits
 #define rsa_privkey_verify torsion_rsa_privkey_verify
 #define rsa_privkey_import torsion_rsa_privkey_import
@@ -42,6 +44,20 @@ extern "C" {
 #define rsa_decrypt_raw torsion_rsa_decrypt_raw
 #define rsa_veil torsion_rsa_veil
 #define rsa_unveil torsion_rsa_unveil
+#define rsa_key_create_private torsion_rsa_key_create_private
+#define rsa_key_create_public torsion_rsa_key_create_public
+#define rsa_key_destroy torsion_rsa_key_destroy
+#define rsa_key_has_private torsion_rsa_key_has_private
+#define rsa_key_bits torsion_rsa_key_bits
+#define rsa_key_set_runner torsion_rsa_key_set_runner
+#define rsa_key_sign torsion_rsa_key_sign
+#define rsa_key_verify torsion_rsa_key_verify
+#define rsa_key_encrypt torsion_rsa_key_encrypt
+#define rsa_key_decrypt torsion_rsa_key_decrypt
+#define rsa_key_sign_pss torsion_rsa_key_sign_pss
+#define rsa_key_verify_pss torsion_rsa_key_verify_pss
+#define rsa_key_encrypt_oaep torsion_rsa_key_encrypt_oaep
+#define rsa_key_decrypt_oaep torsion_rsa_key_decrypt_oaep
 
 /*
  * Definitions
@@ -59,6 +75,7 @@ extern "C" {
 #define RSA_MAX_EXP_BITS 33
 #define RSA_MIN_EXP_SIZE 1
 #define RSA_MAX_EXP_SIZE 5
+#define RSA_MAX_PRIMES 5
 #define RSA_SALT_LENGTH_AUTO 0
 #define RSA_SALT_LENGTH_HASH -1
 
@@ -93,6 +110,15 @@ extern "C" {
   + 2 + 1 + RSA_MAX_EXP_SIZE /* e */ \
 )
 
+/*
+ * Types
+ */
+
+typedef struct rsa_key_s rsa_key_t;
+
+typedef void rsa_job_f(void *);
+typedef void rsa_run_f(rsa_job_f *, void **, size_t, void *);
+
 /*
  * RSA
  */
@@ -104,6 +130,30 @@ rsa_privkey_generate(unsigned char *out,
                      uint64_t exp,
                      const unsigned char *entropy);
 
+TORSION_EXTERN int
+rsa_privkey_generate_multi(unsigned char *out,
+                           size_t *out_len,
+                           unsigned int bits,
+                           uint64_t exp,
+                           unsigned int primes,
+                           const unsigned char *entropy);
+
+/* The prime searches of key generation are independent
+ * and may be handed to a runner (see rsa_key_set_runner),
+ * one job per prime. The key depends only on `entropy`,
+ * not on whether or how the jobs were run.
+ */
+
+TORSION_EXTERN int
+rsa_privkey_generate_with_runner(unsigned char *out,
+                                 size_t *out_len,
+                                 unsigned int bits,
+                                 uint64_t exp,
+                                 unsigned int primes,
+                                 const unsigned char *entropy,
+                                 rsa_run_f *run,
+                                 void *arg);
+
 TORSION_EXTERN unsigned int
 rsa_privkey_bits(const unsigned char *key, size_t key_len);
 
@@ -248,6 +298,121 @@ rsa_unveil(unsigned char *out,
            const unsigned char *key,
            size_t key_len);
 
+/*
+ * Key Handles
+ */
+
+/* Handles hold a parsed and validated key along with
+ * its Montgomery contexts and blinding state. Private
+ * key operations update the blinding state: a private
+ * handle must not be used from multiple threads at once
+ * (create one handle per thread instead). Public key
+ * operations do not modify the handle.
+ */
+
+TORSION_EXTERN rsa_key_t *
+rsa_key_create_private(const unsigned char *key, size_t key_len);
+
+TORSION_EXTERN rsa_key_t *
+rsa_key_create_public(const unsigned char *key, size_t key_len);
+
+TORSION_EXTERN void
+rsa_key_destroy(rsa_key_t *key);
+
+TORSION_EXTERN int
+rsa_key_has_private(const rsa_key_t *key);
+
+TORSION_EXTERN unsigned int
+rsa_key_bits(const rsa_key_t *key);
+
+/* The CRT exponentiations of a private key operation
+ * (one per prime) are independent. By default they run
+ * back to back on the calling thread; libtorsion never
+ * creates threads of its own. A caller who cares about
+ * the latency of a single operation may install a runner
+ * which is handed every exponentiation as a job and must
+ * call `job(args[i])` for each `i < len` before returning.
+ * Jobs may run concurrently and in any order. Pass NULL
+ * to restore the default.
+ */
+
+TORSION_EXTERN void
+rsa_key_set_runner(rsa_key_t *key, rsa_run_f *run, void *arg);
+
+TORSION_EXTERN int
+rsa_key_sign(unsigned char *out,
+             size_t *out_len,
+             hash_id_t type,
+             const unsigned char *msg,
+             size_t msg_len,
+             rsa_key_t *key,
+             const unsigned char *entropy);
+
+TORSION_EXTERN int
+rsa_key_verify(hash_id_t type,
+               const unsigned char *msg,
+               size_t msg_len,
+               const unsigned char *sig,
+               size_t sig_len,
+               const rsa_key_t *key);
+
+TORSION_EXTERN int
+rsa_key_encrypt(unsigned char *out,
+                size_t *out_len,
+                const unsigned char *msg,
+                size_t msg_len,
+                const rsa_key_t *key,
+                const unsigned char *entropy);
+
+TORSION_EXTERN int
+rsa_key_decrypt(unsigned char *out,
+                size_t *out_len,
+                const unsigned char *msg,
+                size_t msg_len,
+                rsa_key_t *key,
+                const unsigned char *entropy);
+
+TORSION_EXTERN int
+rsa_key_sign_pss(unsigned char *out,
+                 size_t *out_len,
+                 hash_id_t type,
+                 const unsigned char *msg,
+                 size_t msg_len,
+                 rsa_key_t *key,
+                 size_t salt_len,
+                 const unsigned char *entropy);
+
+TORSION_EXTERN int
+rsa_key_verify_pss(hash_id_t type,
+                   const unsigned char *msg,
+                   size_t msg_len,
+                   const unsigned char *sig,
+                   size_t sig_len,
+                   const rsa_key_t *key,
+                   size_t salt_len);
+
+TORSION_EXTERN int
+rsa_key_encrypt_oaep(unsigned char *out,
+                     size_t *out_len,
+                     hash_id_t type,
+                     const unsigned char *msg,
+                     size_t msg_len,
+                     const rsa_key_t *key,
+                     const unsigned char *label,
+                     size_t label_len,
+                     const unsigned char *entropy);
+
+TORSION_EXTERN int
+rsa_key_decrypt_oaep(unsigned char *out,
+                     size_t *out_len,
+                     hash_id_t type,
+                     const unsigned char *msg,
+                     size_t msg_len,
+                     rsa_key_t *key,
+                     const unsigned char *label,
+                     size_t label_len,
+                     const unsigned char *entropy);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,14 @@
  *   https://github.com/openssh/openssh-portable
  */
 
+/* Encryption and authentication are stitched
+ * together in strides small enough that the
+ * ciphertext is still in L1 when poly1305 reads
+ * it. This avoids a second pass over memory for
+ * large messages.
+ */
+#define CHACHAPOLY_STRIDE 512
+
 void
 chachapoly_init(chachapoly_t *aead,
                 const unsigned char *key,
@@ -57,8 +65,16 @@ chachapoly_encrypt(chachapoly_t *aead,
 
   aead->ctlen += len;
 
-  chacha20_crypt(&aead->chacha, dst, src, len);
-  poly1305_update(&aead->poly, dst, len);
+  while (len > 0) {
+    size_t n = len < CHACHAPOLY_STRIDE ? len : CHACHAPOLY_STRIDE;
+
+    chacha20_crypt(&aead->chacha, dst, src, n);
+    poly1305_update(&aead->poly, dst, n);
+
+    dst += n;
+    src += n;
+    len -= n;
+  }
 }
 
 void
@@ -71,8 +87,16 @@ chachapoly_decrypt(chachapoly_t *aead,
 
   aead->ctlen += len;
 
-  poly1305_update(&aead->poly, src, len);
-  chacha20_crypt(&aead->chacha, dst, src, len);
+  while (len > 0) {
+    size_t n = len < CHACHAPOLY_STRIDE ? len : CHACHAPOLY_STRIDE;
+
+    poly1305_update(&aead->poly, src, n);
+    chacha20_crypt(&aead->chacha, dst, src, n);
+
+    dst += n;
+    src += n;
+    len -= n;
+  }
 }
 
 void
@@ -96,3 +120,607 @@ chachapoly_final(chachapoly_t *aead, unsigned char *tag) {
   poly1305_update(&aead->poly, len, 16);
   poly1305_final(&aead->poly, tag);
 }
+
+void
+chachapoly_encrypt_iov(chachapoly_t *aead,
+                       const chachapoly_iov_t *iov,
+                       size_t iov_len) {
+  size_t i;
+
+  for (i = 0; i < iov_len; i++)
+    chachapoly_encrypt(aead, iov[i].data, iov[i].data, iov[i].len);
+}
+
+void
+chachapoly_decrypt_iov(chachapoly_t *aead,
+                       const chachapoly_iov_t *iov,
+                       size_t iov_len) {
+  size_t i;
+
+  for (i = 0; i < iov_len; i++)
+    chachapoly_decrypt(aead, iov[i].data, iov[i].data, iov[i].len);
+}
+
+void
+chachapoly_seal(unsigned char *tag,
+                const chachapoly_iov_t *iov,
+                size_t iov_len,
+                const unsigned char *aad,
+                size_t aad_len,
+                const unsigned char *key,
+                const unsigned char *iv,
+                size_t iv_len) {
+  chachapoly_t aead;
+
+  chachapoly_init(&aead, key, iv, iv_len);
+  chachapoly_aad(&aead, aad, aad_len);
+  chachapoly_encrypt_iov(&aead, iov, iov_len);
+  chachapoly_final(&aead, tag);
+
+  torsion_memzero(&aead, sizeof(aead));
+}
+
+int
+chachapoly_open(const unsigned char *tag,
+                const chachapoly_iov_t *iov,
+                size_t iov_len,
+                const unsigned char *aad,
+                size_t aad_len,
+                const unsigned char *key,
+                const unsigned char *iv,
+                size_t iv_len) {
+  unsigned char mac[16];
+  chachapoly_t aead;
+  size_t i;
+  int ret;
+
+  chachapoly_init(&aead, key, iv, iv_len);
+  chachapoly_aad(&aead, aad, aad_len);
+  chachapoly_decrypt_iov(&aead, iov, iov_len);
+  chachapoly_final(&aead, mac);
+
+  ret = torsion_memequal(mac, tag, 16);
+
+  /* Never release unauthenticated plaintext. */
+  if (!ret) {
+    for (i = 0; i < iov_len; i++)
+      torsion_memzero(iov[i].data, iov[i].len);
+  }
+
+  torsion_memzero(mac, sizeof(mac));
+  torsion_memzero(&aead, sizeof(aead));
+
+  return ret;
+}
+
+/*
+ * Batch ChaCha20-Poly1305
+ *
+ * Messages are processed in groups of four. The
+ * ChaCha20 states for a group are interleaved so
+ * that each round operates on all four lanes at
+ * once. With GNU C vector extensions available,
+ * the lanes map directly to 128-bit registers
+ * (SSE2 on x86-64, NEON on ARM). Poly1305 is laned
+ * the same way: the four accumulators are kept in
+ * radix 2^26 and each 16-byte block is multiplied
+ * by r two lanes per 64-bit vector (pmuludq on
+ * SSE2). Messages of different lengths simply drop
+ * out of the lanes (their accumulators are masked)
+ * once their input is exhausted.
+ *
+ * Unlike the single-message interface, the cipher
+ * and the authenticator are not stitched: the batch
+ * is aimed at short packets, which remain in cache
+ * between the two passes.
+ */
+
+#define LANES 4
+
+#if defined(__GNUC__) && (TORSION_GNUC_PREREQ(4, 7) || defined(__clang__))
+#  define CHACHA20_HAVE_VECTOR
+typedef uint32_t chacha20_vec_t __attribute__((vector_size(16)));
+typedef uint64_t poly1305_vec_t __attribute__((vector_size(16)));
+#else
+typedef uint64_t poly1305_vec_t;
+#endif
+
+#define POLY1305_WIDTH (sizeof(poly1305_vec_t) / sizeof(uint64_t))
+
+#if defined(CHACHA20_HAVE_VECTOR) && defined(__SSE2__)
+#  include <emmintrin.h>
+/* GCC does not reliably fold a masked 64-bit multiply into pmuludq. */
+#  define POLY1305_MUL(x, y) \
+     ((poly1305_vec_t)_mm_mul_epu32((__m128i)(x), (__m128i)(y)))
+#else
+#  define POLY1305_MUL(x, y) ((x) * (y))
+#endif
+
+#define ROTL32(x, y) (((x) << (y)) | ((x) >> (32 - (y))))
+
+#define LANEWISE(stmt) do {   \
+  int k;                      \
+  for (k = 0; k < LANES; k++) \
+    stmt;                     \
+} while (0)
+
+#if defined(CHACHA20_HAVE_VECTOR)
+#define QROUND4(x, a, b, c, d)                  \
+  x[a] += x[b]; x[d] = ROTL32(x[d] ^ x[a], 16); \
+  x[c] += x[d]; x[b] = ROTL32(x[b] ^ x[c], 12); \
+  x[a] += x[b]; x[d] = ROTL32(x[d] ^ x[a], 8);  \
+  x[c] += x[d]; x[b] = ROTL32(x[b] ^ x[c], 7)
+#else
+#define QROUND4(x, a, b, c, d)                       \
+  LANEWISE(x[a][k] += x[b][k]);                      \
+  LANEWISE(x[d][k] = ROTL32(x[d][k] ^ x[a][k], 16)); \
+  LANEWISE(x[c][k] += x[d][k]);                      \
+  LANEWISE(x[b][k] = ROTL32(x[b][k] ^ x[c][k], 12)); \
+  LANEWISE(x[a][k] += x[b][k]);                      \
+  LANEWISE(x[d][k] = ROTL32(x[d][k] ^ x[a][k], 8));  \
+  LANEWISE(x[c][k] += x[d][k]);                      \
+  LANEWISE(x[b][k] = ROTL32(x[b][k] ^ x[c][k], 7))
+#endif
+
+static void
+chacha20_block4(unsigned char stream[LANES][64], uint32_t state[16][LANES]) {
+#if defined(CHACHA20_HAVE_VECTOR)
+  chacha20_vec_t x[16], y[16];
+#else
+  uint32_t x[16][LANES];
+#endif
+  uint32_t out[16][LANES];
+  int i, j;
+
+#if defined(CHACHA20_HAVE_VECTOR)
+  for (i = 0; i < 16; i++) {
+    memcpy(&y[i], state[i], sizeof(y[i]));
+    x[i] = y[i];
+  }
+#else
+  for (i = 0; i < 16; i++)
+    LANEWISE(x[i][k] = state[i][k]);
+#endif
+
+  for (i = 0; i < 10; i++) {
+    QROUND4(x, 0, 4,  8, 12);
+    QROUND4(x, 1, 5,  9, 13);
+    QROUND4(x, 2, 6, 10, 14);
+    QROUND4(x, 3, 7, 11, 15);
+    QROUND4(x, 0, 5, 10, 15);
+    QROUND4(x, 1, 6, 11, 12);
+    QROUND4(x, 2, 7,  8, 13);
+    QROUND4(x, 3, 4,  9, 14);
+  }
+
+#if defined(CHACHA20_HAVE_VECTOR)
+  for (i = 0; i < 16; i++) {
+    x[i] += y[i];
+    memcpy(out[i], &x[i], sizeof(x[i]));
+  }
+#else
+  for (i = 0; i < 16; i++)
+    LANEWISE(out[i][k] = x[i][k] + state[i][k]);
+#endif
+
+  for (j = 0; j < LANES; j++) {
+    for (i = 0; i < 16; i++)
+      write32le(stream[j] + i * 4, out[i][j]);
+  }
+
+  LANEWISE(state[12][k] += 1);
+  LANEWISE(state[13][k] += (state[12][k] < 1));
+
+#if defined(CHACHA20_HAVE_VECTOR)
+  torsion_memzero(y, sizeof(y));
+#endif
+  torsion_memzero(x, sizeof(x));
+  torsion_memzero(out, sizeof(out));
+}
+
+typedef struct poly1305x4_s {
+  uint64_t h[5][LANES];
+  uint64_t r[5][LANES];
+  uint64_t s[5][LANES];
+  uint32_t pad[4][LANES];
+} poly1305x4_t;
+
+static void
+poly1305x4_init(poly1305x4_t *ctx, unsigned char keys[LANES][64]) {
+  int i;
+
+  for (i = 0; i < 5; i++)
+    LANEWISE(ctx->h[i][k] = 0);
+
+  /* r &= 0xffffffc0ffffffc0ffffffc0fffffff */
+  LANEWISE(ctx->r[0][k] = (read32le(keys[k] +  0) >> 0) & 0x3ffffff);
+  LANEWISE(ctx->r[1][k] = (read32le(keys[k] +  3) >> 2) & 0x3ffff03);
+  LANEWISE(ctx->r[2][k] = (read32le(keys[k] +  6) >> 4) & 0x3ffc0ff);
+  LANEWISE(ctx->r[3][k] = (read32le(keys[k] +  9) >> 6) & 0x3f03fff);
+  LANEWISE(ctx->r[4][k] = (read32le(keys[k] + 12) >> 8) & 0x00fffff);
+
+  for (i = 0; i < 5; i++)
+    LANEWISE(ctx->s[i][k] = ctx->r[i][k] * 5);
+
+  for (i = 0; i < 4; i++)
+    LANEWISE(ctx->pad[i][k] = read32le(keys[k] + 16 + i * 4));
+}
+
+static void
+poly1305x4_block(poly1305x4_t *ctx,
+                 unsigned char blocks[LANES][16],
+                 const uint64_t active[LANES]) {
+  poly1305_vec_t h0, h1, h2, h3, h4, r0, r1, r2, r3, r4;
+  poly1305_vec_t s1, s2, s3, s4, d0, d1, d2, d3, d4;
+  poly1305_vec_t c, m;
+  uint64_t t[5][LANES];
+  size_t j;
+  int i;
+
+  LANEWISE(t[0][k] = (read32le(blocks[k] +  0) >> 0) & 0x3ffffff);
+  LANEWISE(t[1][k] = (read32le(blocks[k] +  3) >> 2) & 0x3ffffff);
+  LANEWISE(t[2][k] = (read32le(blocks[k] +  6) >> 4) & 0x3ffffff);
+  LANEWISE(t[3][k] = (read32le(blocks[k] +  9) >> 6) & 0x3ffffff);
+  LANEWISE(t[4][k] = (read32le(blocks[k] + 12) >> 8) | (UINT32_C(1) << 24));
+
+  for (j = 0; j < LANES; j += POLY1305_WIDTH) {
+#define LOAD(x, y) memcpy(&(x), &(y)[j], sizeof(x))
+#define STORE(x, y) memcpy(&(x)[j], &(y), sizeof(y))
+    LOAD(h0, ctx->h[0]);
+    LOAD(h1, ctx->h[1]);
+    LOAD(h2, ctx->h[2]);
+    LOAD(h3, ctx->h[3]);
+    LOAD(h4, ctx->h[4]);
+    LOAD(r0, ctx->r[0]);
+    LOAD(r1, ctx->r[1]);
+    LOAD(r2, ctx->r[2]);
+    LOAD(r3, ctx->r[3]);
+    LOAD(r4, ctx->r[4]);
+    LOAD(s1, ctx->s[1]);
+    LOAD(s2, ctx->s[2]);
+    LOAD(s3, ctx->s[3]);
+    LOAD(s4, ctx->s[4]);
+    LOAD(m, active);
+
+    /* h += m[i] */
+    LOAD(c, t[0]); d0 = h0 + c;
+    LOAD(c, t[1]); d1 = h1 + c;
+    LOAD(c, t[2]); d2 = h2 + c;
+    LOAD(c, t[3]); d3 = h3 + c;
+    LOAD(c, t[4]); d4 = h4 + c;
+
+    /* h *= r */
+    h0 = POLY1305_MUL(d0, r0) + POLY1305_MUL(d1, s4) + POLY1305_MUL(d2, s3)
+       + POLY1305_MUL(d3, s2) + POLY1305_MUL(d4, s1);
+
+    h1 = POLY1305_MUL(d0, r1) + POLY1305_MUL(d1, r0) + POLY1305_MUL(d2, s4)
+       + POLY1305_MUL(d3, s3) + POLY1305_MUL(d4, s2);
+
+    h2 = POLY1305_MUL(d0, r2) + POLY1305_MUL(d1, r1) + POLY1305_MUL(d2, r0)
+       + POLY1305_MUL(d3, s4) + POLY1305_MUL(d4, s3);
+
+    h3 = POLY1305_MUL(d0, r3) + POLY1305_MUL(d1, r2) + POLY1305_MUL(d2, r1)
+       + POLY1305_MUL(d3, r0) + POLY1305_MUL(d4, s4);
+
+    h4 = POLY1305_MUL(d0, r4) + POLY1305_MUL(d1, r3) + POLY1305_MUL(d2, r2)
+       + POLY1305_MUL(d3, r1) + POLY1305_MUL(d4, r0);
+
+    /* (partial) h %= p */
+    c = h0 >> 26;
+    h0 &= 0x3ffffff;
+    h1 += c;
+
+    c = h1 >> 26;
+    h1 &= 0x3ffffff;
+    h2 += c;
+
+    c = h2 >> 26;
+    h2 &= 0x3ffffff;
+    h3 += c;
+
+    c = h3 >> 26;
+    h3 &= 0x3ffffff;
+    h4 += c;
+
+    c = h4 >> 26;
+    h4 &= 0x3ffffff;
+    h0 += (c << 2) + c;
+
+    c = h0 >> 26;
+    h0 &= 0x3ffffff;
+    h1 += c;
+
+    /* Exhausted lanes keep their accumulator. */
+    for (i = 0; i < 5; i++) {
+      LOAD(d0, ctx->h[i]);
+
+      switch (i) {
+        case 0: c = h0; break;
+        case 1: c = h1; break;
+        case 2: c = h2; break;
+        case 3: c = h3; break;
+        default: c = h4; break;
+      }
+
+      c = (c & m) | (d0 & ~m);
+
+      STORE(ctx->h[i], c);
+    }
+#undef LOAD
+#undef STORE
+  }
+
+  torsion_memzero(t, sizeof(t));
+}
+
+static void
+poly1305x4_final(poly1305x4_t *ctx, unsigned char *mac, int lane) {
+  uint32_t h0 = ctx->h[0][lane];
+  uint32_t h1 = ctx->h[1][lane];
+  uint32_t h2 = ctx->h[2][lane];
+  uint32_t h3 = ctx->h[3][lane];
+  uint32_t h4 = ctx->h[4][lane];
+  uint32_t g0, g1, g2, g3, g4, c, mask;
+  uint64_t f;
+
+  /* Fully carry h. */
+  c = h1 >> 26;
+  h1 &= 0x3ffffff;
+  h2 += c;
+
+  c = h2 >> 26;
+  h2 &= 0x3ffffff;
+  h3 += c;
+
+  c = h3 >> 26;
+  h3 &= 0x3ffffff;
+  h4 += c;
+
+  c = h4 >> 26;
+  h4 &= 0x3ffffff;
+  h0 += c * 5;
+
+  c = h0 >> 26;
+  h0 &= 0x3ffffff;
+
+  h1 += c;
+
+  /* Compute h + -p. */
+  g0 = h0 + 5;
+  c = g0 >> 26;
+  g0 &= 0x3ffffff;
+
+  g1 = h1 + c;
+  c = g1 >> 26;
+  g1 &= 0x3ffffff;
+
+  g2 = h2 + c;
+  c = g2 >> 26;
+  g2 &= 0x3ffffff;
+
+  g3 = h3 + c;
+  c = g3 >> 26;
+  g3 &= 0x3ffffff;
+  g4 = h4 + c - (UINT32_C(1) << 26);
+
+  /* Select h if h < p, or h + -p if h >= p. */
+  mask = (g4 >> 31) - 1;
+  g0 &= mask;
+  g1 &= mask;
+  g2 &= mask;
+  g3 &= mask;
+  g4 &= mask;
+  mask = ~mask;
+  h0 = (h0 & mask) | g0;
+  h1 = (h1 & mask) | g1;
+  h2 = (h2 & mask) | g2;
+  h3 = (h3 & mask) | g3;
+  h4 = (h4 & mask) | g4;
+
+  /* h = h % (2^128) */
+  h0 = (h0 | (h1 << 26)) & 0xffffffff;
+  h1 = ((h1 >> 6) | (h2 << 20)) & 0xffffffff;
+  h2 = ((h2 >> 12) | (h3 << 14)) & 0xffffffff;
+  h3 = ((h3 >> 18) | (h4 <<  8)) & 0xffffffff;
+
+  /* mac = (h + pad) % (2^128) */
+  f = (uint64_t)h0 + ctx->pad[0][lane];
+  h0 = (uint32_t)f;
+
+  f = (uint64_t)h1 + ctx->pad[1][lane] + (f >> 32);
+  h1 = (uint32_t)f;
+
+  f = (uint64_t)h2 + ctx->pad[2][lane] + (f >> 32);
+  h2 = (uint32_t)f;
+
+  f = (uint64_t)h3 + ctx->pad[3][lane] + (f >> 32);
+  h3 = (uint32_t)f;
+
+  write32le(mac +  0, h0);
+  write32le(mac +  4, h1);
+  write32le(mac +  8, h2);
+  write32le(mac + 12, h3);
+}
+
+static int
+chachapoly_block(unsigned char *block,
+                 const chachapoly_msg_t *msg,
+                 size_t index) {
+  /* Authenticated input: aad || pad || ct || pad || lens. */
+  size_t ad_blocks = (msg->aad_len + 15) / 16;
+  size_t ct_blocks = (msg->len + 15) / 16;
+  const unsigned char *raw;
+  size_t len;
+
+  if (index < ad_blocks) {
+    raw = msg->aad + index * 16;
+    len = msg->aad_len - index * 16;
+  } else if (index - ad_blocks < ct_blocks) {
+    index -= ad_blocks;
+    raw = msg->data + index * 16;
+    len = msg->len - index * 16;
+  } else if (index - ad_blocks == ct_blocks) {
+    write64le(block + 0, msg->aad_len);
+    write64le(block + 8, msg->len);
+    return 1;
+  } else {
+    memset(block, 0, 16);
+    return 0;
+  }
+
+  if (len >= 16) {
+    memcpy(block, raw, 16);
+  } else {
+    memcpy(block, raw, len);
+    memset(block + len, 0, 16 - len);
+  }
+
+  return 1;
+}
+
+static void
+chachapoly_auth4(poly1305x4_t *poly,
+                 const chachapoly_msg_t *msgs,
+                 size_t len) {
+  unsigned char blocks[LANES][16];
+  uint64_t active[LANES];
+  size_t i, j, n;
+  size_t max = 0;
+
+  for (j = 0; j < len; j++) {
+    n = (msgs[j].aad_len + 15) / 16 + (msgs[j].len + 15) / 16 + 1;
+
+    if (n > max)
+      max = n;
+  }
+
+  for (i = 0; i < max; i++) {
+    for (j = 0; j < LANES; j++) {
+      if (j < len)
+        active[j] = -(uint64_t)chachapoly_block(blocks[j], &msgs[j], i);
+      else
+        active[j] = 0;
+    }
+
+    poly1305x4_block(poly, blocks, active);
+  }
+
+  torsion_memzero(blocks, sizeof(blocks));
+}
+
+static int
+chachapoly_batch4(int *valid,
+                  const chachapoly_msg_t *msgs,
+                  size_t len,
+                  int encrypt) {
+  unsigned char stream[LANES][64];
+  uint32_t state[16][LANES];
+  poly1305x4_t poly;
+  unsigned char mac[16];
+  size_t max = 0;
+  size_t pos, n;
+  chacha20_t ctx;
+  int ret = 1;
+  size_t j;
+  int i, ok;
+
+  /* Unused lanes duplicate the first message. */
+  for (j = 0; j < LANES; j++) {
+    const chachapoly_msg_t *msg = &msgs[j < len ? j : 0];
+
+    chacha20_init(&ctx, msg->key, 32, msg->iv, msg->iv_len, 0);
+
+    for (i = 0; i < 16; i++)
+      state[i][j] = ctx.state[i];
+  }
+
+  chacha20_block4(stream, state);
+
+  poly1305x4_init(&poly, stream);
+
+  for (j = 0; j < len; j++) {
+    if (msgs[j].len > max)
+      max = msgs[j].len;
+  }
+
+  if (!encrypt)
+    chachapoly_auth4(&poly, msgs, len);
+
+  for (pos = 0; pos < max; pos += 64) {
+    chacha20_block4(stream, state);
+
+    for (j = 0; j < len; j++) {
+      if (pos >= msgs[j].len)
+        continue;
+
+      n = msgs[j].len - pos;
+
+      if (n > 64)
+        n = 64;
+
+      torsion_memxor(msgs[j].data + pos, stream[j], n);
+    }
+  }
+
+  if (encrypt)
+    chachapoly_auth4(&poly, msgs, len);
+
+  for (j = 0; j < len; j++) {
+    if (encrypt) {
+      poly1305x4_final(&poly, msgs[j].tag, j);
+    } else {
+      poly1305x4_final(&poly, mac, j);
+
+      ok = torsion_memequal(mac, msgs[j].tag, 16);
+
+      /* Never release unauthenticated plaintext. */
+      if (!ok)
+        torsion_memzero(msgs[j].data, msgs[j].len);
+
+      if (valid != NULL)
+        valid[j] = ok;
+
+      ret &= ok;
+    }
+  }
+
+  torsion_memzero(mac, sizeof(mac));
+  torsion_memzero(stream, sizeof(stream));
+  torsion_memzero(state, sizeof(state));
+  torsion_memzero(&poly, sizeof(poly));
+  torsion_memzero(&ctx, sizeof(ctx));
+
+  return ret;
+}
+
+void
+chachapoly_seal_batch(const chachapoly_msg_t *msgs, size_t len) {
+  size_t i, n;
+
+  for (i = 0; i < len; i += n) {
+    n = len - i < LANES ? len - i : LANES;
+
+    chachapoly_batch4(NULL, msgs + i, n, 1);
+  }
+}
+
+int
+chachapoly_open_batch(int *valid, const chachapoly_msg_t *msgs, size_t len) {
+  int ret = 1;
+  size_t i, n;
+
+  for (i = 0; i < len; i += n) {
+    n = len - i < LANES ? len - i : LANES;
+
+    ret &= chachapoly_batch4(valid != NULL ? valid + i : NULL, msgs + i, n, 0);
+  }
+
+  return ret;
+}
+
+#undef LANES
+#undef ROTL32
+#undef LANEWISE
+#undef QROUND4
+#undef POLY1305_WIDTH
+#undef POLY1305_MUL
@@ -13,6 +13,7 @@
 
 #define blowfish_stream2word torsion__blowfish_stream2word
 #define blowfish_expand0state torsion__blowfish_expand0state
+#define blowfish_expand0state2 torsion__blowfish_expand0state2
 #define blowfish_expandstate torsion__blowfish_expandstate
 #define blowfish_enc torsion__blowfish_enc
 #define blowfish_dec torsion__blowfish_dec
@@ -25,6 +26,14 @@ blowfish_expand0state(blowfish_t *ctx,
                       const unsigned char *key,
                       size_t key_len);
 
+void
+blowfish_expand0state2(blowfish_t *x,
+                       const unsigned char *xkey,
+                       size_t xkey_len,
+                       blowfish_t *y,
+                       const unsigned char *ykey,
+                       size_t ykey_len);
+
 void
 blowfish_expandstate(blowfish_t *ctx,
                      const unsigned char *key, size_t key_len,
@@ -1710,6 +1710,39 @@ blowfish_decipher(const blowfish_t *ctx, uint32_t *xl, uint32_t *xr) {
   *xr = l;
 }
 
+static void
+blowfish_encipher2(const blowfish_t *x, uint32_t *xl, uint32_t *xr,
+                   const blowfish_t *y, uint32_t *yl, uint32_t *yr) {
+  /* Two independent encipherments, interleaved. A
+     single Blowfish chain is bound by the latency of
+     its S-box lookups; running two at once lets the
+     second fill in the stalls of the first. */
+  uint32_t l0 = *xl ^ x->P[0];
+  uint32_t r0 = *xr;
+  uint32_t l1 = *yl ^ y->P[0];
+  uint32_t r1 = *yr;
+  int i;
+
+#define F(c, v) (((c->S[0][((v) >> 24) & 0xff]  \
+                 + c->S[1][((v) >> 16) & 0xff]) \
+                 ^ c->S[2][((v) >>  8) & 0xff]) \
+                 + c->S[3][((v) >>  0) & 0xff])
+
+  for (i = 1; i < 17; i += 2) {
+    r0 ^= F(x, l0) ^ x->P[i + 0];
+    r1 ^= F(y, l1) ^ y->P[i + 0];
+    l0 ^= F(x, r0) ^ x->P[i + 1];
+    l1 ^= F(y, r1) ^ y->P[i + 1];
+  }
+
+#undef F
+
+  *xl = r0 ^ x->P[17];
+  *xr = l0;
+  *yl = r1 ^ y->P[17];
+  *yr = l1;
+}
+
 #undef substitute
 
 uint32_t
@@ -1721,6 +1754,17 @@ blowfish_stream2word(const unsigned char *data, size_t len, size_t *off) {
     return 0;
   }
 
+  if (*off + 4 <= len) {
+    word = read32be(data + *off);
+
+    *off += 4;
+
+    if (*off == len)
+      *off = 0;
+
+    return word;
+  }
+
   word = ((uint32_t)data[(*off + 0) % len] << 24)
        | ((uint32_t)data[(*off + 1) % len] << 16)
        | ((uint32_t)data[(*off + 2) % len] <<  8)
@@ -1760,6 +1804,49 @@ blowfish_expand0state(blowfish_t *ctx,
   }
 }
 
+void
+blowfish_expand0state2(blowfish_t *x,
+                       const unsigned char *xkey,
+                       size_t xkey_len,
+                       blowfish_t *y,
+                       const unsigned char *ykey,
+                       size_t ykey_len) {
+  uint32_t xl = 0;
+  uint32_t xr = 0;
+  uint32_t yl = 0;
+  uint32_t yr = 0;
+  size_t xoff = 0;
+  size_t yoff = 0;
+  int i, k;
+
+  ASSERT(x != y);
+
+  for (i = 0; i < 18; i++) {
+    x->P[i] ^= blowfish_stream2word(xkey, xkey_len, &xoff);
+    y->P[i] ^= blowfish_stream2word(ykey, ykey_len, &yoff);
+  }
+
+  for (i = 0; i < 18; i += 2) {
+    blowfish_encipher2(x, &xl, &xr, y, &yl, &yr);
+
+    x->P[i + 0] = xl;
+    x->P[i + 1] = xr;
+    y->P[i + 0] = yl;
+    y->P[i + 1] = yr;
+  }
+
+  for (i = 0; i < 4; i++) {
+    for (k = 0; k < 256; k += 2) {
+      blowfish_encipher2(x, &xl, &xr, y, &yl, &yr);
+
+      x->S[i][k + 0] = xl;
+      x->S[i][k + 1] = xr;
+      y->S[i][k + 0] = yl;
+      y->S[i][k + 1] = yr;
+    }
+  }
+}
+
 void
 blowfish_expandstate(blowfish_t *ctx,
                      const unsigned char *key, size_t key_len,
@@ -6602,6 +6689,20 @@ ghash_pad(ghash_t *ctx) {
   }
 }
 
+static void
+ghash_reset(ghash_t *ctx) {
+  /* Keep the key table, reset everything else. */
+  ctx->state.lo = 0;
+  ctx->state.hi = 0;
+
+  /* Defensive memset. */
+  memset(ctx->block, 0, 16);
+
+  ctx->adlen = 0;
+  ctx->ctlen = 0;
+  ctx->pos = 0;
+}
+
 static void
 ghash_init(ghash_t *ctx, const unsigned char *key) {
   gfe_t x;
@@ -6610,7 +6711,6 @@ ghash_init(ghash_t *ctx, const unsigned char *key) {
   /* Zero for struct assignment. */
   memset(&x, 0, sizeof(x));
 
-  ctx->state = x;
   ctx->table[0] = x;
 
   x.lo = read64be(key + 0);
@@ -6623,12 +6723,7 @@ ghash_init(ghash_t *ctx, const unsigned char *key) {
     gfe_add(&ctx->table[revbits(i + 1)], &ctx->table[revbits(i)], &x);
   }
 
-  /* Defensive memset. */
-  memset(ctx->block, 0, 16);
-
-  ctx->adlen = 0;
-  ctx->ctlen = 0;
-  ctx->pos = 0;
+  ghash_reset(ctx);
 }
 
 static void
@@ -6679,10 +6774,35 @@ gcm_crypt(gcm_t *mode,
   stream_update(&mode->ctr, cipher, gcm_stream, ctr_xor, dst, src, len);
 }
 
+static void
+gcm_reset(gcm_t *mode, const cipher_t *cipher,
+          const unsigned char *iv, size_t iv_len) {
+  /* Assumes the hash key table is already computed. */
+  static const unsigned char initial[4] = {0, 0, 0, 1};
+  static const unsigned char zero16[16] = {0};
+  ctr_t *ctr = &mode->ctr;
+
+  /* Defensive memset. */
+  memset(ctr->state, 0, 16);
+
+  ctr->pos = 0;
+
+  if (iv_len == 12) {
+    memcpy(ctr->iv, iv, 12);
+    memcpy(ctr->iv + 12, initial, 4);
+  } else {
+    ghash_reset(&mode->hash);
+    ghash_update(&mode->hash, iv, iv_len);
+    ghash_final(&mode->hash, ctr->iv);
+  }
+
+  ghash_reset(&mode->hash);
+  gcm_crypt(mode, cipher, mode->mask, zero16, 16);
+}
+
 int
 gcm_init(gcm_t *mode, const cipher_t *cipher,
          const unsigned char *iv, size_t iv_len) {
-  static const unsigned char initial[4] = {0, 0, 0, 1};
   static const unsigned char zero16[16] = {0};
   ctr_t *ctr = &mode->ctr;
   unsigned char key[16];
@@ -6700,17 +6820,8 @@ gcm_init(gcm_t *mode, const cipher_t *cipher,
 
   gcm_crypt(mode, cipher, key, zero16, 16);
 
-  if (iv_len == 12) {
-    memcpy(ctr->iv, iv, 12);
-    memcpy(ctr->iv + 12, initial, 4);
-  } else {
-    ghash_init(&mode->hash, key);
-    ghash_update(&mode->hash, iv, iv_len);
-    ghash_final(&mode->hash, ctr->iv);
-  }
-
   ghash_init(&mode->hash, key);
-  gcm_crypt(mode, cipher, mode->mask, zero16, 16);
+  gcm_reset(mode, cipher, iv, iv_len);
 
   return 1;
 }
@@ -6744,6 +6855,78 @@ gcm_digest(gcm_t *mode, unsigned char *mac) {
     mac[i] ^= mode->mask[i];
 }
 
+/* Messages are processed serially. The batch only
+ * amortizes key setup: consecutive messages which
+ * share a cipher reuse its hash subkey and GHASH
+ * table. Our GHASH is a 4-bit table walk, which
+ * has nothing to gain from lanes; interleaving
+ * several messages would need carry-less multiply
+ * instructions, which we do not use.
+ */
+static int
+gcm_batch(int *valid, const gcm_msg_t *msgs, size_t len, int encrypt) {
+  const cipher_t *cipher = NULL;
+  unsigned char mac[16];
+  int ret = 1;
+  gcm_t mode;
+  size_t i;
+  int ok;
+
+  for (i = 0; i < len; i++) {
+    if (msgs[i].cipher->size != 16)
+      return 0;
+  }
+
+  for (i = 0; i < len; i++) {
+    const gcm_msg_t *msg = &msgs[i];
+
+    /* Runs of messages sharing a key skip the
+       hash subkey and table computation. */
+    if (msg->cipher != cipher) {
+      cipher = msg->cipher;
+      gcm_init(&mode, cipher, msg->iv, msg->iv_len);
+    } else {
+      gcm_reset(&mode, cipher, msg->iv, msg->iv_len);
+    }
+
+    gcm_aad(&mode, msg->aad, msg->aad_len);
+
+    if (encrypt) {
+      gcm_encrypt(&mode, cipher, msg->data, msg->data, msg->len);
+      gcm_digest(&mode, msg->tag);
+    } else {
+      gcm_decrypt(&mode, cipher, msg->data, msg->data, msg->len);
+      gcm_digest(&mode, mac);
+
+      ok = torsion_memequal(mac, msg->tag, 16);
+
+      /* Never release unauthenticated plaintext. */
+      if (!ok)
+        torsion_memzero(msg->data, msg->len);
+
+      if (valid != NULL)
+        valid[i] = ok;
+
+      ret &= ok;
+    }
+  }
+
+  torsion_memzero(mac, sizeof(mac));
+  torsion_memzero(&mode, sizeof(mode));
+
+  return ret;
+}
+
+int
+gcm_seal_batch(const gcm_msg_t *msgs, size_t len) {
+  return gcm_batch(NULL, msgs, len, 1);
+}
+
+int
+gcm_open_batch(int *valid, const gcm_msg_t *msgs, size_t len) {
+  return gcm_batch(valid, msgs, len, 0);
+}
+
 /*
  * CBC-MAC
  */
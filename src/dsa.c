@@ -49,6 +49,7 @@ typedef struct dsa_pub_s {
   mpz_t q;
   mpz_t g;
   mpz_t y;
+  mpz_mont_t mont_p;
 } dsa_pub_t;
 
 typedef struct dsa_priv_s {
@@ -57,6 +58,7 @@ typedef struct dsa_priv_s {
   mpz_t g;
   mpz_t y;
   mpz_t x;
+  mpz_mont_t mont_p;
 } dsa_priv_t;
 
 typedef struct dsa_sig_s {
@@ -164,18 +166,56 @@ dsa_group_export_dumb(unsigned char *out,
   *out_len = pos;
 }
 
+/* The search for p is split into windows of
+ * candidates which may be sieved concurrently.
+ * The lowest window holding a prime wins, which
+ * is the prime a serial search would have found.
+ */
+#define DSA_SIEVE_JOBS 8
+
+typedef struct dsa_sieve_job_s {
+  mpz_t z;
+  mpz_srcptr x;
+  mpz_srcptr d;
+  mp_limb_t start;
+  mp_limb_t max;
+  drbg_t rng;
+  int found;
+  int done;
+} dsa_sieve_job_t;
+
+static void
+dsa_sieve_job(void *ptr) {
+  dsa_sieve_job_t *job = (dsa_sieve_job_t *)ptr;
+
+  /* Search x + d * j for start <= j < start + max. */
+  mpz_mul_ui(job->z, job->d, job->start);
+  mpz_add(job->z, job->z, job->x);
+
+  job->found = mpz_sieveprime(job->z, job->z, job->d, job->max,
+                              64, drbg_rng, &job->rng);
+  job->done = 1;
+}
+
 static int
 dsa_group_generate(dsa_group_t *group, mp_bits_t bits,
-                   const unsigned char *entropy) {
+                   const unsigned char *entropy,
+                   dsa_run_f *run, void *arg) {
   /* [FIPS186] Page 31, Appendix A.1.
    *           Page 41, Appendix A.2.
    * [DSA] "Parameter generation".
    */
   mp_bits_t L = bits;
   mp_bits_t N = bits < 2048 ? 160 : 256;
+  dsa_sieve_job_t jobs[DSA_SIEVE_JOBS];
+  void *args[DSA_SIEVE_JOBS];
+  unsigned char seed[ENTROPY_SIZE];
   mpz_t q, p, t, h, pm1, e, g;
-  mp_bits_t i, b;
+  dsa_sieve_job_t *job;
+  mp_bits_t b;
+  int ret = 0;
   drbg_t rng;
+  int i;
 
   if (!(L == 1024 && N == 160)
       && !(L == 2048 && N == 224)
@@ -192,6 +232,9 @@ dsa_group_generate(dsa_group_t *group, mp_bits_t bits,
   mpz_init(e);
   mpz_init(g);
 
+  for (i = 0; i < DSA_SIEVE_JOBS; i++)
+    mpz_init(jobs[i].z);
+
   drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
 
   for (;;) {
@@ -200,32 +243,79 @@ dsa_group_generate(dsa_group_t *group, mp_bits_t bits,
     mpz_setbit(q, 0);
     mpz_setbit(q, N - 1);
 
-    if (!mpz_probab_prime_p(q, 64, drbg_rng, &rng))
+    mpz_set_ui(t, 2);
+
+    if (!mpz_sieveprime(q, q, t, MP_SIEVE_WINDOW, 64, drbg_rng, &rng))
+      continue;
+
+    if (mpz_bitlen(q) != N)
       continue;
 
-    for (i = 0; i < 4 * L; i++) {
-      mpz_urandomb(p, L, drbg_rng, &rng);
+    mpz_urandomb(p, L, drbg_rng, &rng);
+
+    mpz_setbit(p, L - 1);
+
+    /* p = 1 mod 2q */
+    mpz_mod(t, p, q);
+    mpz_sub_ui(t, t, 1);
+    mpz_sub(p, p, t);
+
+    if (mpz_even_p(p))
+      mpz_add(p, p, q);
 
-      mpz_setbit(p, 0);
-      mpz_setbit(p, L - 1);
+    /* Search p + 2q * j. */
+    mpz_mul_2exp(t, q, 1);
 
-      mpz_mod(t, p, q);
-      mpz_sub_ui(t, t, 1);
-      mpz_sub(p, p, t);
+    for (i = 0; i < DSA_SIEVE_JOBS; i++) {
+      job = &jobs[i];
 
-      b = mpz_bitlen(p);
+      drbg_generate(&rng, seed, sizeof(seed));
+      drbg_init(&job->rng, HASH_SHA256, seed, sizeof(seed));
 
-      if (b < L || b > DSA_MAX_BITS)
-        continue;
+      job->x = p;
+      job->d = t;
+      job->start = i * (4 * L / DSA_SIEVE_JOBS);
+      job->max = 4 * L / DSA_SIEVE_JOBS;
+      job->found = 0;
+      job->done = 0;
 
-      if (!mpz_probab_prime_p(p, 64, drbg_rng, &rng))
-        continue;
+      args[i] = job;
+    }
+
+    if (run != NULL) {
+      run(dsa_sieve_job, args, DSA_SIEVE_JOBS, arg);
+
+      for (i = 0; i < DSA_SIEVE_JOBS; i++) {
+        if (!jobs[i].done)
+          goto fail;
+      }
+    } else {
+      for (i = 0; i < DSA_SIEVE_JOBS; i++) {
+        dsa_sieve_job(&jobs[i]);
+
+        if (jobs[i].found)
+          break;
+      }
+    }
 
-      goto done;
+    for (i = 0; i < DSA_SIEVE_JOBS; i++) {
+      if (jobs[i].found)
+        break;
     }
+
+    if (i == DSA_SIEVE_JOBS)
+      continue;
+
+    mpz_set(p, jobs[i].z);
+
+    b = mpz_bitlen(p);
+
+    if (b != L)
+      continue;
+
+    break;
   }
 
-done:
   mpz_set_ui(h, 2);
   mpz_sub_ui(pm1, p, 1);
   mpz_quo(e, pm1, q);
@@ -245,6 +335,8 @@ done:
   mpz_set(group->q, q);
   mpz_set(group->g, g);
 
+  ret = 1;
+fail:
   mpz_cleanse(q);
   mpz_cleanse(p);
   mpz_cleanse(t);
@@ -253,9 +345,15 @@ done:
   mpz_cleanse(e);
   mpz_cleanse(g);
 
+  for (i = 0; i < DSA_SIEVE_JOBS; i++) {
+    mpz_cleanse(jobs[i].z);
+    torsion_memzero(&jobs[i].rng, sizeof(jobs[i].rng));
+  }
+
+  torsion_memzero(seed, sizeof(seed));
   torsion_memzero(&rng, sizeof(rng));
 
-  return 1;
+  return ret;
 }
 
 static int
@@ -321,6 +419,7 @@ dsa_pub_init(dsa_pub_t *k) {
   mpz_init(k->q);
   mpz_init(k->g);
   mpz_init(k->y);
+  mpz_mont_init(k->mont_p);
 }
 
 static void
@@ -329,6 +428,7 @@ dsa_pub_clear(dsa_pub_t *k) {
   mpz_cleanse(k->q);
   mpz_cleanse(k->g);
   mpz_cleanse(k->y);
+  mpz_mont_clear(k->mont_p);
 }
 
 static void
@@ -337,6 +437,13 @@ dsa_pub_roset_priv(dsa_pub_t *r, const dsa_priv_t *k) {
   mpz_roset(r->q, k->q);
   mpz_roset(r->g, k->g);
   mpz_roset(r->y, k->y);
+
+  *r->mont_p = *k->mont_p;
+}
+
+static int
+dsa_pub_precompute(dsa_pub_t *k) {
+  return mpz_mont_set(k->mont_p, k->p);
 }
 
 static int
@@ -468,6 +575,7 @@ dsa_priv_init(dsa_priv_t *k) {
   mpz_init(k->g);
   mpz_init(k->y);
   mpz_init(k->x);
+  mpz_mont_init(k->mont_p);
 }
 
 static void
@@ -477,6 +585,12 @@ dsa_priv_clear(dsa_priv_t *k) {
   mpz_cleanse(k->g);
   mpz_cleanse(k->y);
   mpz_cleanse(k->x);
+  mpz_mont_clear(k->mont_p);
+}
+
+static int
+dsa_priv_precompute(dsa_priv_t *k) {
+  return mpz_mont_set(k->mont_p, k->p);
 }
 
 static int
@@ -604,7 +718,7 @@ dsa_priv_verify(const dsa_priv_t *k) {
 }
 
 static void
-dsa_priv_create(dsa_priv_t *k,
+dsa_priv_choose(dsa_priv_t *k,
                 const dsa_group_t *group,
                 const unsigned char *entropy) {
   drbg_t rng;
@@ -619,11 +733,18 @@ dsa_priv_create(dsa_priv_t *k,
     mpz_urandomm(k->x, k->q, drbg_rng, &rng);
   } while (mpz_sgn(k->x) == 0);
 
-  mpz_powm_sec(k->y, k->g, k->x, k->p);
-
   torsion_memzero(&rng, sizeof(rng));
 }
 
+static void
+dsa_priv_create(dsa_priv_t *k,
+                const dsa_group_t *group,
+                const unsigned char *entropy) {
+  dsa_priv_choose(k, group, entropy);
+
+  mpz_powm_sec(k->y, k->g, k->x, k->p);
+}
+
 static int
 dsa_priv_generate(dsa_priv_t *k, mp_bits_t bits, const unsigned char *entropy) {
   unsigned char entropy1[ENTROPY_SIZE];
@@ -638,7 +759,7 @@ dsa_priv_generate(dsa_priv_t *k, mp_bits_t bits, const unsigned char *entropy) {
   drbg_generate(&rng, entropy2, ENTROPY_SIZE);
   drbg_generate(&rng, entropy1, ENTROPY_SIZE);
 
-  if (!dsa_group_generate(&group, bits, entropy1))
+  if (!dsa_group_generate(&group, bits, entropy1, NULL, NULL))
     goto fail;
 
   dsa_priv_create(k, &group, entropy2);
@@ -804,7 +925,32 @@ dsa_params_generate(unsigned char *out,
   if (bits > DSA_MAX_BITS)
     goto fail;
 
-  if (!dsa_group_generate(&group, bits, entropy))
+  if (!dsa_group_generate(&group, bits, entropy, NULL, NULL))
+    goto fail;
+
+  dsa_group_export(out, out_len, &group);
+  ret = 1;
+fail:
+  dsa_group_clear(&group);
+  return ret;
+}
+
+int
+dsa_params_generate_with_runner(unsigned char *out,
+                                size_t *out_len,
+                                unsigned int bits,
+                                const unsigned char *entropy,
+                                dsa_run_f *run,
+                                void *arg) {
+  dsa_group_t group;
+  int ret = 0;
+
+  dsa_group_init(&group);
+
+  if (bits > DSA_MAX_BITS)
+    goto fail;
+
+  if (!dsa_group_generate(&group, bits, entropy, run, arg))
     goto fail;
 
   dsa_group_export(out, out_len, &group);
@@ -1273,11 +1419,12 @@ dsa_reduce(mpz_t m, const unsigned char *msg, size_t msg_len, const mpz_t q) {
   return ret;
 }
 
-int
-dsa_sign(unsigned char *out, size_t *out_len,
-         const unsigned char *msg, size_t msg_len,
-         const unsigned char *key, size_t key_len,
-         const unsigned char *entropy) {
+static int
+dsa_sign_inner(unsigned char *out, size_t *out_len,
+               const unsigned char *msg, size_t msg_len,
+               const dsa_priv_t *priv,
+               const struct mpz_comb_s *comb,
+               const unsigned char *entropy) {
   /* DSA Signing.
    *
    * [FIPS186] Page 19, Section 4.6.
@@ -1330,7 +1477,6 @@ dsa_sign(unsigned char *out, size_t *out_len,
   unsigned char bytes[DSA_MAX_QSIZE * 2];
   mpz_t m, b, bx, bm, k, r, s;
   drbg_t drbg, rng;
-  dsa_priv_t priv;
   size_t qsize;
   dsa_sig_t S;
   int ret = 0;
@@ -1343,62 +1489,58 @@ dsa_sign(unsigned char *out, size_t *out_len,
   mpz_init(r);
   mpz_init(s);
 
-  dsa_priv_init(&priv);
+  qsize = mpz_bytelen(priv->q);
 
-  if (!dsa_priv_import(&priv, key, key_len))
-    goto fail;
+  dsa_reduce(m, msg, msg_len, priv->q);
 
-  if (!dsa_priv_is_sane(&priv))
-    goto fail;
-
-  qsize = mpz_bytelen(priv.q);
-
-  dsa_reduce(m, msg, msg_len, priv.q);
-
-  mpz_export(bytes, priv.x, qsize, 1);
+  mpz_export(bytes, priv->x, qsize, 1);
   mpz_export(bytes + qsize, m, qsize, 1);
 
   drbg_init(&drbg, HASH_SHA256, bytes, qsize * 2);
   drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
 
   for (;;) {
-    mpz_urandomm(b, priv.q, drbg_rng, &rng);
+    mpz_urandomm(b, priv->q, drbg_rng, &rng);
 
     if (mpz_sgn(b) == 0)
       continue;
 
     drbg_generate(&drbg, bytes, qsize);
 
-    if (!dsa_reduce(k, bytes, qsize, priv.q))
+    if (!dsa_reduce(k, bytes, qsize, priv->q))
       continue;
 
     if (mpz_sgn(k) == 0)
       continue;
 
-    mpz_powm_sec(r, priv.g, k, priv.p);
-    mpz_mod(r, r, priv.q);
+    if (comb != NULL)
+      mpz_comb_powm_sec(r, k, comb);
+    else
+      mpz_mont_powm_sec(r, priv->g, k, priv->mont_p);
+
+    mpz_mod(r, r, priv->q);
 
     if (mpz_sgn(r) == 0)
       continue;
 
     /* Blind. */
     mpz_mul(k, k, b);
-    mpz_mod(k, k, priv.q);
-    mpz_mul(bx, priv.x, b);
-    mpz_mod(bx, bx, priv.q);
+    mpz_mod(k, k, priv->q);
+    mpz_mul(bx, priv->x, b);
+    mpz_mod(bx, bx, priv->q);
     mpz_mul(bm, m, b);
-    mpz_mod(bm, bm, priv.q);
+    mpz_mod(bm, bm, priv->q);
 
     /* Can only fail if `q` is not prime. */
-    if (!mpz_invert(k, k, priv.q))
+    if (!mpz_invert(k, k, priv->q))
       goto fail;
 
     /* Sign. */
     mpz_mul(s, r, bx);
     mpz_add(s, s, bm);
-    mpz_mod(s, s, priv.q);
+    mpz_mod(s, s, priv->q);
     mpz_mul(s, s, k);
-    mpz_mod(s, s, priv.q);
+    mpz_mod(s, s, priv->q);
 
     if (mpz_sgn(s) == 0)
       continue;
@@ -1419,13 +1561,37 @@ fail:
   mpz_cleanse(k);
   mpz_cleanse(r);
   mpz_cleanse(s);
-  dsa_priv_clear(&priv);
   torsion_memzero(&drbg, sizeof(drbg));
   torsion_memzero(&rng, sizeof(rng));
   torsion_memzero(bytes, sizeof(bytes));
   return ret;
 }
 
+int
+dsa_sign(unsigned char *out, size_t *out_len,
+         const unsigned char *msg, size_t msg_len,
+         const unsigned char *key, size_t key_len,
+         const unsigned char *entropy) {
+  dsa_priv_t priv;
+  int ret = 0;
+
+  dsa_priv_init(&priv);
+
+  if (!dsa_priv_import(&priv, key, key_len))
+    goto fail;
+
+  if (!dsa_priv_is_sane(&priv))
+    goto fail;
+
+  if (!dsa_priv_precompute(&priv))
+    goto fail;
+
+  ret = dsa_sign_inner(out, out_len, msg, msg_len, &priv, NULL, entropy);
+fail:
+  dsa_priv_clear(&priv);
+  return ret;
+}
+
 int
 dsa_verify(const unsigned char *msg, size_t msg_len,
            const unsigned char *sig, size_t sig_len,
@@ -1450,7 +1616,7 @@ dsa_verify(const unsigned char *msg, size_t msg_len,
    *   r' = g^u1 * y^u2 mod p
    *   r == r' mod q
    */
-  mpz_t r, s, m, si, u1, u2, e1, e2, re;
+  mpz_t r, s, m, si, u1, u2, re;
   size_t qsize;
   dsa_pub_t k;
   dsa_sig_t S;
@@ -1460,8 +1626,6 @@ dsa_verify(const unsigned char *msg, size_t msg_len,
   mpz_init(si);
   mpz_init(u1);
   mpz_init(u2);
-  mpz_init(e1);
-  mpz_init(e2);
   mpz_init(re);
 
   dsa_pub_init(&k);
@@ -1473,6 +1637,9 @@ dsa_verify(const unsigned char *msg, size_t msg_len,
   if (!dsa_pub_is_sane(&k))
     goto fail;
 
+  if (!dsa_pub_precompute(&k))
+    goto fail;
+
   qsize = mpz_bytelen(k.q);
 
   if (!dsa_sig_import_rs(&S, sig, sig_len, qsize))
@@ -1499,10 +1666,7 @@ dsa_verify(const unsigned char *msg, size_t msg_len,
   mpz_mod(u1, u1, k.q);
   mpz_mul(u2, r, si);
   mpz_mod(u2, u2, k.q);
-  mpz_powm(e1, k.g, u1, k.p);
-  mpz_powm(e2, k.y, u2, k.p);
-  mpz_mul(re, e1, e2);
-  mpz_mod(re, re, k.p);
+  mpz_mont_powm2(re, k.g, u1, k.y, u2, k.mont_p);
   mpz_mod(re, re, k.q);
 
   ret = (mpz_cmp(re, r) == 0);
@@ -1511,8 +1675,6 @@ fail:
   mpz_cleanse(si);
   mpz_cleanse(u1);
   mpz_cleanse(u2);
-  mpz_cleanse(e1);
-  mpz_cleanse(e2);
   mpz_cleanse(re);
   dsa_pub_clear(&k);
   dsa_sig_clear(&S);
@@ -1551,7 +1713,10 @@ dsa_derive(unsigned char *out, size_t *out_len,
   if (!dsa_pub_verify(&k1))
     goto fail;
 
-  mpz_powm_sec(e, k1.y, k2.x, k1.p);
+  if (!dsa_pub_precompute(&k1))
+    goto fail;
+
+  mpz_mont_powm_sec(e, k1.y, k2.x, k1.mont_p);
 
   *out_len = mpz_bytelen(k1.p);
   mpz_export(out, e, *out_len, 1);
@@ -1562,3 +1727,109 @@ fail:
   mpz_cleanse(e);
   return ret;
 }
+
+/*
+ * Domain Handles
+ */
+
+struct dsa_domain_s {
+  dsa_group_t group;
+  mpz_comb_t comb;
+};
+
+dsa_domain_t *
+dsa_domain_create(const unsigned char *params, size_t params_len) {
+  dsa_domain_t *domain = (dsa_domain_t *)malloc(sizeof(dsa_domain_t));
+  mp_bits_t qbits;
+
+  if (domain == NULL)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  dsa_group_init(&domain->group);
+  mpz_comb_init(domain->comb);
+
+  if (!dsa_group_import(&domain->group, params, params_len))
+    goto fail;
+
+  if (!dsa_group_is_sane(&domain->group))
+    goto fail;
+
+  qbits = mpz_bitlen(domain->group.q);
+
+  if (!mpz_comb_set(domain->comb, domain->group.g, qbits, domain->group.p))
+    goto fail;
+
+  return domain;
+fail:
+  dsa_domain_destroy(domain);
+  return NULL;
+}
+
+void
+dsa_domain_destroy(dsa_domain_t *domain) {
+  if (domain != NULL) {
+    dsa_group_clear(&domain->group);
+    mpz_comb_clear(domain->comb);
+    torsion_memzero(domain, sizeof(*domain));
+    free(domain);
+  }
+}
+
+unsigned int
+dsa_domain_bits(const dsa_domain_t *domain) {
+  return mpz_bitlen(domain->group.p);
+}
+
+unsigned int
+dsa_domain_qbits(const dsa_domain_t *domain) {
+  return mpz_bitlen(domain->group.q);
+}
+
+int
+dsa_domain_privkey_create(unsigned char *out,
+                          size_t *out_len,
+                          const dsa_domain_t *domain,
+                          const unsigned char *entropy) {
+  dsa_priv_t k;
+
+  dsa_priv_init(&k);
+  dsa_priv_choose(&k, &domain->group, entropy);
+
+  mpz_comb_powm_sec(k.y, k.x, domain->comb);
+
+  dsa_priv_export(out, out_len, &k);
+  dsa_priv_clear(&k);
+
+  return 1;
+}
+
+int
+dsa_domain_sign(unsigned char *out, size_t *out_len,
+                const unsigned char *msg, size_t msg_len,
+                const unsigned char *key, size_t key_len,
+                const dsa_domain_t *domain,
+                const unsigned char *entropy) {
+  const dsa_group_t *group = &domain->group;
+  dsa_priv_t priv;
+  int ret = 0;
+
+  dsa_priv_init(&priv);
+
+  if (!dsa_priv_import(&priv, key, key_len))
+    goto fail;
+
+  if (mpz_cmp(priv.p, group->p) != 0
+      || mpz_cmp(priv.q, group->q) != 0
+      || mpz_cmp(priv.g, group->g) != 0) {
+    goto fail;
+  }
+
+  if (!dsa_priv_is_sane(&priv))
+    goto fail;
+
+  ret = dsa_sign_inner(out, out_len, msg, msg_len,
+                       &priv, domain->comb, entropy);
+fail:
+  dsa_priv_clear(&priv);
+  return ret;
+}
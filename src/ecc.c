@@ -159,6 +159,7 @@
 #include <torsion/util.h>
 
 #include "asn1.h"
+#include "entropy/entropy.h"
 #include "internal.h"
 #include "mpi.h"
 
@@ -191,11 +192,15 @@ TORSION_BARRIER(fe_word_t, fe_word)
 #define MAX_SIG_SIZE (MAX_FIELD_SIZE + MAX_SCALAR_SIZE)
 #define MAX_DER_SIZE (9 + MAX_SIG_SIZE)
 
+#ifdef TORSION_FIXED_WIDTH
+#define FIXED_WIDTH TORSION_FIXED_WIDTH /* 2-8 */
+#else
 #define FIXED_WIDTH 4
-#define FIXED_SIZE (1 << FIXED_WIDTH) /* 16 */
-#define FIXED_STEPS(bits) (((bits) + FIXED_WIDTH - 1) / FIXED_WIDTH) /* 64 */
-#define FIXED_LENGTH(bits) (FIXED_STEPS(bits) * FIXED_SIZE) /* 1024 */
-#define FIXED_MAX_LENGTH FIXED_LENGTH(MAX_SCALAR_BITS) /* 2096 */
+#endif
+#define FIXED_SIZE (1 << (FIXED_WIDTH - 1)) /* 8 */
+#define FIXED_STEPS(bits) (((bits) + FIXED_WIDTH) / FIXED_WIDTH) /* 64 */
+#define FIXED_LENGTH(bits) (FIXED_STEPS(bits) * FIXED_SIZE) /* 512 */
+#define FIXED_MAX_LENGTH FIXED_LENGTH(MAX_SCALAR_BITS) /* 1048 */
 
 #define WND_WIDTH 4
 #define WND_SIZE (1 << WND_WIDTH) /* 16 */
@@ -209,6 +214,10 @@ TORSION_BARRIER(fe_word_t, fe_word)
 
 #define JSF_SIZE 4
 
+#define WEI_BATCH 16
+#define MONT_BATCH 16
+#define ECDSA_PRESIGN_BATCH 16
+
 #define ECC_MIN(x, y) ((x) < (y) ? (x) : (y))
 #define ECC_MAX(x, y) ((x) > (y) ? (x) : (y))
 
@@ -337,6 +346,9 @@ typedef struct prime_def_s {
   fe_sqrt_f *sqrt;
   fe_isqrt_f *isqrt;
   fe_legendre_f *legendre;
+  fe_mul_f *mul_adx;
+  fe_sqr_f *square_adx;
+  const struct prime_def_s *adx;
 } prime_def_t;
 
 /*
@@ -385,6 +397,24 @@ typedef struct jge_s {
   int aff;
 } jge_t;
 
+struct wei_s;
+
+typedef void jge_dbl_f(const struct wei_s *, jge_t *, const jge_t *);
+
+typedef void jge_addsub_f(const struct wei_s *, jge_t *,
+                          const jge_t *, const jge_t *, int);
+
+typedef void jge_mixed_addsub_f(const struct wei_s *, jge_t *, const jge_t *,
+                                const fe_t, const fe_t, int);
+
+/* Group law instantiated against a constant field (see group.h). */
+typedef struct wei_group_s {
+  fe_mul_f *kernel;
+  jge_dbl_f *dbl_var;
+  jge_addsub_f *addsub_var;
+  jge_mixed_addsub_f *mixed_addsub_var;
+} wei_group_t;
+
 typedef struct wei_s {
   hash_id_t hash;
   hash_id_t xof;
@@ -408,7 +438,7 @@ typedef struct wei_s {
   wge_t g;
   sc_t blind;
   jge_t unblind;
-  wge_t wnd_fixed[FIXED_MAX_LENGTH]; /* 311.2kb */
+  wge_t wnd_fixed[FIXED_MAX_LENGTH]; /* 155.6kb */
   wge_t wnd_naf[NAF_SIZE_PRE]; /* 152kb */
   wge_t torsion[8];
   int endo;
@@ -420,6 +450,7 @@ typedef struct wei_s {
   sc_t g2;
   wge_t wnd_endo[NAF_SIZE_PRE]; /* 19kb */
   mp_bits_t prec;
+  const wei_group_t *group;
 } wei_t;
 
 typedef struct wei_def_s {
@@ -436,6 +467,7 @@ typedef struct wei_def_s {
   const unsigned char c[MAX_FIELD_SIZE];
   const subgroup_def_t *torsion;
   const endo_def_t *endo;
+  const wei_group_t *groups;
 } wei_def_t;
 
 typedef struct wei_scratch_s {
@@ -448,6 +480,19 @@ typedef struct wei_scratch_s {
   sc_t *coeffs;
 } wei__scratch_t;
 
+typedef struct ecdsa_nonce_s {
+  sc_t kinv;
+  sc_t r;
+  unsigned int param;
+} ecdsa_nonce_t;
+
+typedef struct ecdsa_presign_s {
+  size_t size;
+  size_t length;
+  drbg_t rng;
+  ecdsa_nonce_t *items;
+} ecdsa__presign_t;
+
 /*
  * Montgomery
  */
@@ -467,6 +512,16 @@ typedef struct pge_s {
   fe_t z;
 } pge_t;
 
+struct mont_s;
+
+typedef void mont_mul_f(const struct mont_s *, pge_t *,
+                        const pge_t *, const sc_t, int);
+
+typedef struct mont_group_s {
+  fe_mul_f *kernel;
+  mont_mul_f *mul;
+} mont_group_t;
+
 typedef struct mont_s {
   prime_field_t fe;
   scalar_field_t sc;
@@ -485,6 +540,8 @@ typedef struct mont_s {
   sc_t i16;
   mge_t g;
   mge_t torsion[8];
+  struct edwards_s *edwards;
+  const mont_group_t *group;
 } mont_t;
 
 typedef struct mont_def_s {
@@ -499,6 +556,8 @@ typedef struct mont_def_s {
   const unsigned char y[MAX_FIELD_SIZE];
   const unsigned char c[MAX_FIELD_SIZE];
   const subgroup_def_t *torsion;
+  const struct edwards_def_s *edwards;
+  const mont_group_t *groups;
 } mont_def_t;
 
 /*
@@ -544,6 +603,44 @@ typedef struct xge_s {
   fe_t t;
 } xge_t;
 
+/* nge = niels group element (affine, precomputed) */
+typedef struct nge_s {
+  /* 216 bytes */
+  fe_t x; /* y + x (a = -1), x (a != -1) */
+  fe_t y; /* y - x (a = -1), y (a != -1) */
+  fe_t t; /* 2 * d * t (a = -1), d * t (a != -1) */
+} nge_t;
+
+struct edwards_s;
+struct edwards_scratch_s;
+
+typedef void xge_dbl_f(const struct edwards_s *, xge_t *, const xge_t *, int);
+
+typedef void xge_add_f(const struct edwards_s *, xge_t *,
+                       const xge_t *, const xge_t *, int);
+
+typedef void xge_mul_g_f(const struct edwards_s *, xge_t *, const sc_t);
+
+typedef void xge_mul_double_f(const struct edwards_s *, xge_t *,
+                              const sc_t, const xge_t *, const sc_t);
+
+typedef void xge_mul_multi_f(const struct edwards_s *, xge_t *,
+                             const sc_t, const xge_t *, const sc_t *,
+                             size_t, struct edwards_scratch_s *);
+
+typedef struct edwards_group_s {
+  fe_mul_f *kernel;
+  xge_dbl_f *dbl_ext;
+  xge_add_f *add_a;
+  xge_add_f *sub_a;
+  xge_add_f *add_m1;
+  xge_add_f *sub_m1;
+  /* Lane-parallel multipliers (AVX2), or NULL. */
+  xge_mul_g_f *mul_g;
+  xge_mul_double_f *mul_double_var;
+  xge_mul_multi_f *mul_multi_var;
+} edwards_group_t;
+
 typedef struct edwards_s {
   hash_id_t hash;
   int context;
@@ -567,10 +664,11 @@ typedef struct edwards_s {
   xge_t g;
   sc_t blind;
   xge_t unblind;
-  xge_t wnd_fixed[FIXED_MAX_LENGTH]; /* 589.5kb */
-  xge_t wnd_naf[NAF_SIZE_PRE]; /* 288kb */
+  nge_t wnd_fixed[FIXED_MAX_LENGTH]; /* 221kb */
+  xge_t *wnd_naf; /* 288kb, NULL for fixed-base only */
   xge_t torsion[8];
   ristretto_t rs;
+  const edwards_group_t *group;
 } edwards_t;
 
 typedef struct edwards_def_s {
@@ -589,6 +687,7 @@ typedef struct edwards_def_s {
   const unsigned char c[MAX_FIELD_SIZE];
   const subgroup_def_t *torsion;
   const ristretto_def_t *ristretto;
+  const edwards_group_t *groups;
 } edwards_def_t;
 
 typedef struct edwards_scratch_s {
@@ -802,6 +901,27 @@ sc_get_bits(const scalar_field_t *sc, const sc_t x,
   return mpn_getbits(x, sc->limbs, pos, width);
 }
 
+static mp_limb_t
+sc_fixed_digit(mp_limb_t *b, int last) {
+  /* Recode a window (plus the previous carry) as a
+   * signed digit in [-2^(w-1), 2^(w-1)]. On return,
+   * `b` holds the absolute value. The result is both
+   * the sign and the carry into the next window. The
+   * last window never carries (see FIXED_STEPS).
+   */
+  mp_limb_t c = (*b + FIXED_SIZE) >> FIXED_WIDTH;
+  mp_limb_t m, v;
+
+  c &= (mp_limb_t)last - 1;
+
+  m = -c;
+  v = *b - (c << FIXED_WIDTH);
+
+  *b = (v ^ m) - m;
+
+  return c;
+}
+
 static int
 sc_reduce_weak(const scalar_field_t *sc, sc_t z, const sc_t x, mp_limb_t hi) {
   mp_limb_t scratch[MPN_REDUCE_WEAK_ITCH(MAX_SCALAR_LIMBS)]; /* 144 bytes */
@@ -2007,6 +2127,12 @@ prime_field_init(prime_field_t *fe, const prime_def_t *def, int endian) {
   /* Prime field using a fiat backend. */
   memset(fe, 0, sizeof(*fe));
 
+  /* Some fields have a representation of their
+   * own built around MULX/ADX kernels.
+   */
+  if (def->adx != NULL && torsion_has_adx())
+    def = def->adx;
+
   /* Field constants. */
   fe->endian = endian;
   fe->bits = def->bits;
@@ -2053,6 +2179,12 @@ prime_field_init(prime_field_t *fe, const prime_def_t *def, int endian) {
   fe->isqrt = def->isqrt;
   fe->legendre = def->legendre;
 
+  /* Hand-written MULX/ADX kernels, if the CPU has them. */
+  if (def->mul_adx != NULL && torsion_has_adx()) {
+    fe->mul = def->mul_adx;
+    fe->square = def->square_adx;
+  }
+
   /* Pre-montgomerized constants. */
   fe_set_word(fe, fe->zero, 0);
   fe_set_word(fe, fe->one, 1);
@@ -2707,6 +2839,45 @@ wge_set_jge_var(const wei_t *ec, wge_t *r, const jge_t *p) {
   r->inf = 0;
 }
 
+static void
+wge_set_jge_all(const wei_t *ec, wge_t *out, const jge_t *in, size_t len) {
+  /* Montgomery's trick (constant time). */
+  const prime_field_t *fe = &ec->fe;
+  fe_t acc, z, z2, z3;
+  size_t i;
+
+  fe_set(fe, acc, fe->one);
+
+  for (i = 0; i < len; i++) {
+    fe_select(fe, z, in[i].z, fe->one, in[i].inf);
+    fe_set(fe, out[i].x, acc);
+    fe_mul(fe, acc, acc, z);
+  }
+
+  fe_invert(fe, acc, acc);
+
+  for (i = len - 1; i != (size_t)-1; i--) {
+    fe_select(fe, z, in[i].z, fe->one, in[i].inf);
+    fe_mul(fe, out[i].x, out[i].x, acc);
+    fe_mul(fe, acc, acc, z);
+  }
+
+  for (i = 0; i < len; i++) {
+    fe_sqr(fe, z2, out[i].x);
+    fe_mul(fe, z3, z2, out[i].x);
+
+    fe_mul(fe, out[i].x, in[i].x, z2);
+    fe_mul(fe, out[i].y, in[i].y, z3);
+
+    out[i].inf = in[i].inf;
+  }
+
+  fe_cleanse(fe, acc);
+  fe_cleanse(fe, z);
+  fe_cleanse(fe, z2);
+  fe_cleanse(fe, z3);
+}
+
 static void
 wge_set_jge_all_var(const wei_t *ec, wge_t *out, const jge_t *in, size_t len) {
   /* Montgomery's trick. */
@@ -2756,7 +2927,7 @@ wge_fixed_points_var(const wei_t *ec, wge_t *out, const wge_t *p) {
   const scalar_field_t *sc = &ec->sc;
   mp_bits_t steps = FIXED_STEPS(sc->bits);
   mp_bits_t size = steps * FIXED_SIZE;
-  jge_t *wnds = (jge_t *)checked_malloc(size * sizeof(jge_t)); /* 442.2kb */
+  jge_t *wnds = (jge_t *)checked_malloc(size * sizeof(jge_t)); /* 221.1kb */
   mp_bits_t i, j;
   jge_t g;
 
@@ -2765,7 +2936,7 @@ wge_fixed_points_var(const wei_t *ec, wge_t *out, const wge_t *p) {
   for (i = 0; i < steps; i++) {
     jge_t *wnd = &wnds[i * FIXED_SIZE];
 
-    jge_zero(ec, &wnd[0]);
+    jge_set(ec, &wnd[0], &g);
 
     for (j = 1; j < FIXED_SIZE; j++)
       jge_add_var(ec, &wnd[j], &wnd[j - 1], &g);
@@ -2998,277 +3169,11 @@ jge_neg_cond(const wei_t *ec, jge_t *r, const jge_t *p, int flag) {
   r->aff = p->aff;
 }
 
-static void
-jge_dblj(const wei_t *ec, jge_t *p3, const jge_t *p1) {
-  /* https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#doubling-dbl-1998-cmo-2
-   * 3M + 6S + 4A + 1*a + 2*2 + 1*3 + 1*4 + 1*8
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t xx, yy, zz, s, m, t;
-
-  /* XX = X1^2 */
-  fe_sqr(fe, xx, p1->x);
-
-  /* YY = Y1^2 */
-  fe_sqr(fe, yy, p1->y);
-
-  /* ZZ = Z1^2 */
-  fe_sqr(fe, zz, p1->z);
-
-  /* S = 4 * X1 * YY */
-  fe_mul4(fe, s, p1->x);
-  fe_mul(fe, s, s, yy);
-
-  /* M = 3 * XX + a * ZZ^2 */
-  fe_sqr(fe, t, zz);
-  fe_mul(fe, t, t, ec->a);
-  fe_mul3(fe, m, xx);
-  fe_add_nc(fe, m, m, t);
-
-  /* T = M^2 - 2 * S */
-  fe_sqr(fe, t, m);
-  fe_sub(fe, t, t, s);
-  fe_sub(fe, t, t, s);
-
-  /* Z3 = 2 * Y1 * Z1 */
-  fe_add_nc(fe, xx, p1->y, p1->y);
-  fe_mul(fe, p3->z, p1->z, xx);
-
-  /* X3 = T */
-  fe_set(fe, p3->x, t);
-
-  /* Y3 = M * (S - T) - 8 * YY^2 */
-  fe_sub_nc(fe, s, s, t);
-  fe_sqr(fe, yy, yy);
-  fe_mul8(fe, yy, yy);
-  fe_mul(fe, p3->y, m, s);
-  fe_sub(fe, p3->y, p3->y, yy);
-}
-
-static void
-jge_dbl0(const wei_t *ec, jge_t *p3, const jge_t *p1) {
-  /* Assumes a = 0.
-   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html#doubling-dbl-2009-l
-   * 2M + 5S + 6A + 3*2 + 1*3 + 1*8
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t a, b, c, d, e, f;
-
-  /* A = X1^2 */
-  fe_sqr(fe, a, p1->x);
-
-  /* B = Y1^2 */
-  fe_sqr(fe, b, p1->y);
-
-  /* C = B^2 */
-  fe_sqr(fe, c, b);
-
-  /* D = 2 * ((X1 + B)^2 - A - C) */
-  fe_add_nc(fe, d, p1->x, b);
-  fe_sqr(fe, d, d);
-  fe_sub(fe, d, d, a);
-  fe_sub(fe, d, d, c);
-  fe_add(fe, d, d, d);
-
-  /* E = 3 * A */
-  fe_mul3(fe, e, a);
-
-  /* F = E^2 */
-  fe_sqr(fe, f, e);
-
-  /* Z3 = 2 * Y1 * Z1 */
-  fe_add_nc(fe, a, p1->y, p1->y);
-  fe_mul(fe, p3->z, p1->z, a);
-
-  /* X3 = F - 2 * D */
-  fe_sub(fe, p3->x, f, d);
-  fe_sub(fe, p3->x, p3->x, d);
-
-  /* Y3 = E * (D - X3) - 8 * C */
-  fe_sub_nc(fe, d, d, p3->x);
-  fe_mul8(fe, c, c);
-  fe_mul(fe, p3->y, e, d);
-  fe_sub(fe, p3->y, p3->y, c);
-}
-
-static void
-jge_dbl3(const wei_t *ec, jge_t *p3, const jge_t *p1) {
-  /* Assumes a = -3.
-   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#doubling-dbl-2001-b
-   * 3M + 5S + 8A + 1*3 + 1*4 + 2*8
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t delta, gamma, beta, alpha, theta;
-
-  /* delta = Z1^2 */
-  fe_sqr(fe, delta, p1->z);
-
-  /* gamma = Y1^2 */
-  fe_sqr(fe, gamma, p1->y);
-
-  /* beta = X1 * gamma */
-  fe_mul(fe, beta, p1->x, gamma);
-
-  /* alpha = 3 * (X1 - delta) * (X1 + delta) */
-  fe_sub_nc(fe, alpha, p1->x, delta);
-  fe_add_nc(fe, theta, p1->x, delta);
-  fe_mul3(fe, alpha, alpha);
-  fe_mul(fe, alpha, alpha, theta);
-
-  /* Z3 = (Y1 + Z1)^2 - gamma - delta */
-  fe_add_nc(fe, p3->z, p1->y, p1->z);
-  fe_sqr(fe, p3->z, p3->z);
-  fe_sub(fe, p3->z, p3->z, gamma);
-  fe_sub(fe, p3->z, p3->z, delta);
-
-  /* X3 = alpha^2 - 8 * beta */
-  fe_mul4(fe, theta, beta);
-  fe_sqr(fe, p3->x, alpha);
-  fe_sub(fe, p3->x, p3->x, theta);
-  fe_sub(fe, p3->x, p3->x, theta);
-
-  /* Y3 = alpha * (4 * beta - X3) - 8 * gamma^2 */
-  fe_sub_nc(fe, theta, theta, p3->x);
-  fe_sqr(fe, gamma, gamma);
-  fe_mul8(fe, gamma, gamma);
-  fe_mul(fe, p3->y, alpha, theta);
-  fe_sub(fe, p3->y, p3->y, gamma);
-}
-
-static void
-jge_dbl_var(const wei_t *ec, jge_t *p3, const jge_t *p1) {
-  const prime_field_t *fe = &ec->fe;
-
-  /* P = O */
-  if (p1->inf) {
-    jge_zero(ec, p3);
-    return;
-  }
-
-  /* Y1 = 0 */
-  if (ec->h > 1 && fe_is_zero(fe, p1->y)) {
-    jge_zero(ec, p3);
-    return;
-  }
-
-  if (ec->zero_a)
-    jge_dbl0(ec, p3, p1);
-  else if (ec->three_a)
-    jge_dbl3(ec, p3, p1);
-  else
-    jge_dblj(ec, p3, p1);
-
-  p3->inf = 0;
-  p3->aff = 0;
-}
-
-static void
-jge_addsub_var(const wei_t *ec, jge_t *p3,
-               const jge_t *p1, const jge_t *p2, int sign) {
-  /* No assumptions.
-   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-add-1998-cmo-2
-   * 12M + 4S + 6A + 1*2
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t t1, t2, t3, t4, t5, t6;
-
-#define z1z1 t1
-#define z2z2 t2
-#define u1   t3
-#define u2   t4
-#define s1   t5
-#define s2   t6
-#define h    t1 /* <- z1z1 */
-#define r    t2 /* <- z2z2 */
-#define hh   t4 /* <- u2 */
-#define hhh  t6 /* <- s2 */
-#define v    t3 /* <- u1 */
-
-  /* Z1Z1 = Z1^2 */
-  fe_sqr(fe, z1z1, p1->z);
-
-  /* Z2Z2 = Z2^2 */
-  fe_sqr(fe, z2z2, p2->z);
-
-  /* U1 = X1 * Z2Z2 */
-  fe_mul(fe, u1, p1->x, z2z2);
-
-  /* U2 = X2 * Z1Z1 */
-  fe_mul(fe, u2, p2->x, z1z1);
-
-  /* S1 = Y1 * Z2 * Z2Z2 */
-  fe_mul(fe, s1, p1->y, p2->z);
-  fe_mul(fe, s1, s1, z2z2);
-
-  /* S2 = Y2 * Z1 * Z1Z1 */
-  fe_mul(fe, s2, p2->y, p1->z);
-  fe_mul(fe, s2, s2, z1z1);
-
-  /* H = U2 - U1 */
-  fe_sub(fe, h, u2, u1);
-
-  /* r = S2 - S1 */
-  if (sign)
-    fe_sub_nc(fe, r, s2, s1);
-  else
-    fe_add_nc(fe, r, s2, s1);
-
-  /* H = 0 */
-  if (fe_is_zero(fe, h)) {
-    fe_carry(fe, r, r);
-
-    if (fe_is_zero(fe, r))
-      jge_dbl_var(ec, p3, p1);
-    else
-      jge_zero(ec, p3);
-
-    return;
-  }
-
-  /* HH = H^2 */
-  fe_sqr(fe, hh, h);
-
-  /* HHH = H * HH */
-  fe_mul(fe, hhh, h, hh);
-
-  /* V = U1 * HH */
-  fe_mul(fe, v, u1, hh);
-
-  /* X3 = r^2 - HHH - 2 * V */
-  fe_sqr(fe, p3->x, r);
-  fe_sub(fe, p3->x, p3->x, hhh);
-  fe_sub(fe, p3->x, p3->x, v);
-  fe_sub(fe, p3->x, p3->x, v);
-
-  /* Y3 = r * (V - X3) - S1 * HHH */
-  if (sign)
-    fe_sub_nc(fe, v, v, p3->x);
-  else
-    fe_sub_nc(fe, v, p3->x, v);
-
-  fe_mul(fe, s1, s1, hhh);
-  fe_mul(fe, p3->y, r, v);
-  fe_sub(fe, p3->y, p3->y, s1);
-
-  /* Z3 = Z1 * Z2 * H */
-  fe_mul(fe, p3->z, p1->z, p2->z);
-  fe_mul(fe, p3->z, p3->z, h);
-
-  p3->inf = 0;
-  p3->aff = 0;
-
-#undef z1z1
-#undef z2z2
-#undef u1
-#undef u2
-#undef s1
-#undef s2
-#undef h
-#undef r
-#undef hh
-#undef hhh
-#undef v
-}
+#define GROUP(name) name
+#define GROUP_FE(ec) (&(ec)->fe)
+#define GROUP_DISPATCH
+#define GROUP_WEI
+#include "group.h"
 
 static void
 jge_add_var(const wei_t *ec, jge_t *p3, const jge_t *p1, const jge_t *p2) {
@@ -3316,100 +3221,6 @@ jge_sub_var(const wei_t *ec, jge_t *p3, const jge_t *p1, const jge_t *p2) {
   jge_addsub_var(ec, p3, p1, p2, 0);
 }
 
-static void
-jge_mixed_addsub_var(const wei_t *ec, jge_t *p3, const jge_t *p1,
-                     const fe_t x2, const fe_t y2, int sign) {
-  /* Assumes Z2 = 1.
-   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-madd
-   * 8M + 3S + 6A + 5*2
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t t1, t2, t3, t4;
-
-#define z1z1 t1
-#define u2   t2
-#define s2   t3
-#define h    t4
-#define r    t1 /* <- z1z1 */
-#define i    t2 /* <- u2 */
-#define j    t3 /* <- s2 */
-#define v    t2 /* <- i */
-
-  /* Z1Z1 = Z1^2 */
-  fe_sqr(fe, z1z1, p1->z);
-
-  /* U2 = X2 * Z1Z1 */
-  fe_mul(fe, u2, x2, z1z1);
-
-  /* S2 = Y2 * Z1 * Z1Z1 */
-  fe_mul(fe, s2, y2, p1->z);
-  fe_mul(fe, s2, s2, z1z1);
-
-  /* H = U2 - X1 */
-  fe_sub(fe, h, u2, p1->x);
-
-  /* r = 2 * (S2 - Y1) */
-  if (sign)
-    fe_sub(fe, r, s2, p1->y);
-  else
-    fe_add(fe, r, s2, p1->y);
-
-  /* H = 0 */
-  if (fe_is_zero(fe, h)) {
-    if (fe_is_zero(fe, r))
-      jge_dbl_var(ec, p3, p1);
-    else
-      jge_zero(ec, p3);
-
-    return;
-  }
-
-  fe_add_nc(fe, r, r, r);
-
-  /* I = (2 * H)^2 */
-  fe_add_nc(fe, i, h, h);
-  fe_mul(fe, p3->z, p1->z, i);
-  fe_sqr(fe, i, i);
-
-  /* J = H * I */
-  fe_mul(fe, j, h, i);
-
-  /* V = X1 * I */
-  fe_mul(fe, v, i, p1->x);
-
-  /* X3 = r^2 - J - 2 * V */
-  fe_sqr(fe, p3->x, r);
-  fe_sub(fe, p3->x, p3->x, j);
-  fe_sub(fe, p3->x, p3->x, v);
-  fe_sub(fe, p3->x, p3->x, v);
-
-  /* Y3 = r * (V - X3) - 2 * Y1 * J */
-  if (sign)
-    fe_sub_nc(fe, v, v, p3->x);
-  else
-    fe_sub_nc(fe, v, p3->x, v);
-
-  fe_mul(fe, j, j, p1->y);
-  fe_mul(fe, p3->y, r, v);
-  fe_sub(fe, p3->y, p3->y, j);
-  fe_sub(fe, p3->y, p3->y, j);
-
-  /* Z3 = 2 * Z1 * H */
-  /* Computed above. */
-
-  p3->inf = 0;
-  p3->aff = 0;
-
-#undef z1z1
-#undef u2
-#undef s2
-#undef h
-#undef r
-#undef i
-#undef j
-#undef v
-}
-
 static void
 jge_mixed_add_var(const wei_t *ec, jge_t *p3,
                   const jge_t *p1, const wge_t *p2) {
@@ -3999,6 +3810,7 @@ wei_init(wei_t *ec, const wei_def_t *def) {
   prime_field_t *fe = &ec->fe;
   scalar_field_t *sc = &ec->sc;
   unsigned int i;
+  const wei_group_t *group;
   fe_t m3;
 
   memset(ec, 0, sizeof(*ec));
@@ -4010,6 +3822,14 @@ wei_init(wei_t *ec, const wei_def_t *def) {
   prime_field_init(fe, def->fe, 1);
   scalar_field_init(sc, def->sc, 1);
 
+  /* Use the group law instantiated for our field kernel. */
+  for (group = def->groups; group != NULL && group->kernel != NULL; group++) {
+    if (group->kernel == fe->mul) {
+      ec->group = group;
+      break;
+    }
+  }
+
   sc_mod(sc, ec->sc_p, fe->p, fe->limbs);
   fe_mod(fe, ec->fe_n, sc->n, sc->limbs);
 
@@ -4231,11 +4051,15 @@ wei_jmul_g(const wei_t *ec, jge_t *r, const sc_t k) {
    * Windows are appropriately shifted to avoid any
    * doublings. This reduces a 256 bit multiplication
    * down to 64 additions with a window size of 4.
+   *
+   * Digits are recoded to be signed in [-2^(w-1), 2^(w-1)]
+   * such that each window stores only the positive half.
    */
   const scalar_field_t *sc = &ec->sc;
   const wge_t *wnds = ec->wnd_fixed;
   mp_bits_t steps = FIXED_STEPS(sc->bits);
-  mp_bits_t i, j, b;
+  mp_limb_t j, b, carry;
+  mp_bits_t i;
   sc_t k0;
   wge_t t;
 
@@ -4244,13 +4068,20 @@ wei_jmul_g(const wei_t *ec, jge_t *r, const sc_t k) {
 
   /* Multiply in constant time. */
   jge_set(ec, r, &ec->unblind);
-  wge_zero(ec, &t);
+
+  carry = 0;
 
   for (i = 0; i < steps; i++) {
-    b = sc_get_bits(sc, k0, i * FIXED_WIDTH, FIXED_WIDTH);
+    b = sc_get_bits(sc, k0, i * FIXED_WIDTH, FIXED_WIDTH) + carry;
+
+    carry = sc_fixed_digit(&b, i == steps - 1);
+
+    wge_zero(ec, &t);
 
     for (j = 0; j < FIXED_SIZE; j++)
-      wge_select(ec, &t, &t, &wnds[i * FIXED_SIZE + j], j == b);
+      wge_select(ec, &t, &t, &wnds[i * FIXED_SIZE + j], j + 1 == b);
+
+    wge_neg_cond(ec, &t, &t, carry);
 
     jge_mixed_add(ec, r, r, &t);
   }
@@ -4259,6 +4090,7 @@ wei_jmul_g(const wei_t *ec, jge_t *r, const sc_t k) {
   sc_cleanse(sc, k0);
 
   cleanse(&b, sizeof(b));
+  cleanse(&carry, sizeof(carry));
 }
 
 static void
@@ -5296,6 +5128,12 @@ _mont_to_edwards(const prime_field_t *fe, xge_t *r,
 static void
 mont_mul(const mont_t *ec, pge_t *r, const pge_t *p, const sc_t k, int affine);
 
+static void
+xge_cleanse(const edwards_t *ec, xge_t *r);
+
+static void
+edwards_mul_g(const edwards_t *ec, xge_t *r, const sc_t k);
+
 /*
  * Montgomery Affine Point
  */
@@ -5680,28 +5518,71 @@ pge_export(const mont_t *ec,
   return ret;
 }
 
-static void
-pge_import_unsafe(const mont_t *ec, pge_t *r, const unsigned char *raw) {
-  /* [RFC7748] Section 5. */
-  const prime_field_t *fe = &ec->fe;
+static int
+pge_export_all(const mont_t *ec,
+               unsigned char *const *raws,
+               const pge_t *points,
+               size_t len) {
+  /* Montgomery's trick (constant time). */
+  const prime_field_t *fe = &ec->fe;
+  fe_t zs[MONT_BATCH];
+  fe_t invs[MONT_BATCH];
+  int infs[MONT_BATCH];
+  fe_t acc, x;
+  int ret = 1;
+  size_t i;
 
-  fe_import(fe, r->x, raw);
-  fe_set(fe, r->z, fe->one);
-}
+  ASSERT(len <= MONT_BATCH);
 
-static void
-pge_swap(const mont_t *ec, pge_t *p1, pge_t *p2, int flag) {
-  const prime_field_t *fe = &ec->fe;
+  fe_set(fe, acc, fe->one);
 
-  fe_swap(fe, p1->x, p2->x, flag);
-  fe_swap(fe, p1->z, p2->z, flag);
-}
+  for (i = 0; i < len; i++) {
+    infs[i] = fe_is_zero(fe, points[i].z);
 
-static void
-pge_set(const mont_t *ec, pge_t *r, const pge_t *p) {
-  const prime_field_t *fe = &ec->fe;
+    fe_select(fe, zs[i], points[i].z, fe->one, infs[i]);
+    fe_set(fe, invs[i], acc);
+    fe_mul(fe, acc, acc, zs[i]);
 
-  fe_set(fe, r->x, p->x);
+    ret &= infs[i] ^ 1;
+  }
+
+  ASSERT(fe_invert(fe, acc, acc));
+
+  for (i = len - 1; i != (size_t)-1; i--) {
+    fe_mul(fe, invs[i], invs[i], acc);
+    fe_mul(fe, acc, acc, zs[i]);
+  }
+
+  for (i = 0; i < len; i++) {
+    /* Infinity exports as zero (see pge_export). */
+    fe_mul(fe, x, points[i].x, invs[i]);
+    fe_select(fe, x, x, fe->zero, infs[i]);
+    fe_export(fe, raws[i], x);
+  }
+
+  cleanse(zs, len * sizeof(fe_t));
+  cleanse(invs, len * sizeof(fe_t));
+  cleanse(infs, len * sizeof(int));
+  cleanse(acc, sizeof(fe_t));
+  cleanse(x, sizeof(fe_t));
+
+  return ret;
+}
+
+static void
+pge_import_unsafe(const mont_t *ec, pge_t *r, const unsigned char *raw) {
+  /* [RFC7748] Section 5. */
+  const prime_field_t *fe = &ec->fe;
+
+  fe_import(fe, r->x, raw);
+  fe_set(fe, r->z, fe->one);
+}
+
+static void
+pge_set(const mont_t *ec, pge_t *r, const pge_t *p) {
+  const prime_field_t *fe = &ec->fe;
+
+  fe_set(fe, r->x, p->x);
   fe_set(fe, r->z, p->z);
 }
 
@@ -5768,76 +5649,34 @@ pge_dbl(const mont_t *ec, pge_t *p3, const pge_t *p1) {
 }
 
 static void
-pge_ladder(const mont_t *ec,
-           pge_t *p4,
-           pge_t *p5,
-           const pge_t *p1,
-           const pge_t *p2,
-           const pge_t *p3,
-           int affine) {
-  /* https://hyperelliptic.org/EFD/g1p/auto-montgom-xz.html#ladder-ladd-1987-m-3
-   * 6M + 4S + 8A + 1*a24
-   */
+pge_set_mge(const mont_t *ec, pge_t *r, const mge_t *p) {
   const prime_field_t *fe = &ec->fe;
-  fe_t a, aa, b, bb, e, c, d, da, cb;
-
-  ASSERT(p1 != p5);
-  ASSERT(p4 != p5);
 
-  /* A = X2 + Z2 */
-  fe_add_nc(fe, a, p2->x, p2->z);
-
-  /* AA = A^2 */
-  fe_sqr(fe, aa, a);
-
-  /* B = X2 - Z2 */
-  fe_sub_nc(fe, b, p2->x, p2->z);
-
-  /* BB = B^2 */
-  fe_sqr(fe, bb, b);
-
-  /* E = AA - BB */
-  fe_sub_nc(fe, e, aa, bb);
-
-  /* C = X3 + Z3 */
-  fe_add_nc(fe, c, p3->x, p3->z);
-
-  /* D = X3 - Z3 */
-  fe_sub_nc(fe, d, p3->x, p3->z);
-
-  /* DA = D * A */
-  fe_mul(fe, da, d, a);
-
-  /* CB = C * B */
-  fe_mul(fe, cb, c, b);
-
-  /* X5 = Z1 * (DA + CB)^2 */
-  fe_add_nc(fe, p5->x, da, cb);
-  fe_sqr(fe, p5->x, p5->x);
-
-  if (!affine)
-    fe_mul(fe, p5->x, p5->x, p1->z);
-
-  /* Z5 = X1 * (DA - CB)^2 */
-  fe_sub_nc(fe, p5->z, da, cb);
-  fe_sqr(fe, p5->z, p5->z);
-  fe_mul(fe, p5->z, p5->z, p1->x);
-
-  /* X4 = AA * BB */
-  fe_mul(fe, p4->x, aa, bb);
-
-  /* Z4 = E * (BB + a24 * E) */
-  mont_mul_a24(ec, p4->z, e);
-  fe_add_nc(fe, p4->z, p4->z, bb);
-  fe_mul(fe, p4->z, p4->z, e);
+  fe_select(fe, r->x, p->x, fe->one, p->inf);
+  fe_select(fe, r->z, fe->one, fe->zero, p->inf);
 }
 
 static void
-pge_set_mge(const mont_t *ec, pge_t *r, const mge_t *p) {
+pge_set_xge(const mont_t *ec, pge_t *r, const xge_t *p) {
+  /* Compute u only (see _edwards_to_mont). */
   const prime_field_t *fe = &ec->fe;
 
-  fe_select(fe, r->x, p->x, fe->one, p->inf);
-  fe_select(fe, r->z, fe->one, fe->zero, p->inf);
+  if (fe->bits == 448) {
+    /* u = y^2 / x^2 */
+    fe_sqr(fe, r->x, p->y);
+    fe_sqr(fe, r->z, p->x);
+  } else if (ec->invert) {
+    /* u = (y + 1) / (y - 1) */
+    fe_add(fe, r->x, p->y, p->z);
+    fe_sub(fe, r->z, p->y, p->z);
+  } else {
+    /* u = (1 + y) / (1 - y) */
+    fe_add(fe, r->x, p->z, p->y);
+    fe_sub(fe, r->z, p->z, p->y);
+  }
+
+  /* P = O (x = 0, y = 1) maps to z = 0. */
+  fe_select(fe, r->x, r->x, fe->one, fe_is_zero(fe, r->z));
 }
 
 static void
@@ -5896,6 +5735,7 @@ mont_init(mont_t *ec, const mont_def_t *def) {
   prime_field_t *fe = &ec->fe;
   scalar_field_t *sc = &ec->sc;
   unsigned int i;
+  const mont_group_t *group;
 
   memset(ec, 0, sizeof(*ec));
 
@@ -5904,6 +5744,14 @@ mont_init(mont_t *ec, const mont_def_t *def) {
   prime_field_init(fe, def->fe, -1);
   scalar_field_init(sc, def->sc, -1);
 
+  /* Use the group law instantiated for our field kernel. */
+  for (group = def->groups; group != NULL && group->kernel != NULL; group++) {
+    if (group->kernel == fe->mul) {
+      ec->group = group;
+      break;
+    }
+  }
+
   ASSERT(sc->limbs >= fe->limbs);
 
   fe_import_be(fe, ec->a, def->a);
@@ -6023,16 +5871,6 @@ mont_div_b(const mont_t *ec, fe_t z, const fe_t x) {
     fe_mul(fe, z, x, ec->bi);
 }
 
-static void
-mont_mul_a24(const mont_t *ec, fe_t z, const fe_t x) {
-  const prime_field_t *fe = &ec->fe;
-
-  if (fe->scmul_a24 != NULL)
-    fe->scmul_a24(z, x);
-  else
-    fe_mul(fe, z, x, ec->a24);
-}
-
 static void
 mont_solve_y2(const mont_t *ec, fe_t y2, const fe_t x) {
   /* [MONT3] Page 3, Section 2. */
@@ -6072,60 +5910,30 @@ mont_validate_x(const mont_t *ec, const fe_t x) {
   return fe_is_square(fe, y2);
 }
 
-static void
-mont_mul(const mont_t *ec, pge_t *r, const pge_t *p, const sc_t k, int affine) {
-  /* Multiply with the Montgomery Ladder.
-   *
-   * [MONT3] Algorithm 7, Page 16, Section 5.3.
-   *         Algorithm 8, Page 16, Section 5.3.
-   *
-   * [RFC7748] Page 7, Section 5.
-   *
-   * Note that any clamping is meant to
-   * be done _outside_ of this function.
-   */
-  const prime_field_t *fe = &ec->fe;
-  const scalar_field_t *sc = &ec->sc;
-  mp_limb_t swap = 0;
-  mp_limb_t bit = 0;
-  mp_bits_t i;
-  pge_t a, b;
-
-  pge_zero(ec, &a);
-  pge_set(ec, &b, p);
-
-  /* Climb the ladder. */
-  for (i = fe->bits - 1; i >= 0; i--) {
-    bit = sc_get_bit(sc, k, i);
-
-    /* Maybe swap. */
-    pge_swap(ec, &a, &b, swap ^ bit);
-
-    /* Single coordinate add+double. */
-    pge_ladder(ec, &a, &b, p, &a, &b, affine);
-
-    swap = bit;
-  }
-
-  /* Finalize loop. */
-  pge_swap(ec, &a, &b, swap);
-  pge_set(ec, r, &a);
-
-  /* Ensure (1, 0) for infinity. */
-  fe_select(fe, r->x, r->x, fe->one, fe_is_zero(fe, r->z));
-
-  /* Cleanse. */
-  cleanse(&bit, sizeof(bit));
-  cleanse(&swap, sizeof(swap));
-}
+#define GROUP(name) name
+#define GROUP_FE(ec) (&(ec)->fe)
+#define GROUP_DISPATCH
+#define GROUP_MONT
+#include "group.h"
 
 static void
 mont_mul_g(const mont_t *ec, pge_t *r, const sc_t k) {
-  pge_t g;
+  /* Fixed-base multiplication on the birationally
+   * equivalent Edwards curve, mapped back to the
+   * Montgomery u-line. This replaces a full ladder
+   * with the windowed method used for EdDSA keys.
+   *
+   * For Curve448 the map is a 4-isogeny, but the
+   * base points correspond ([RFC7748] Section 4.2)
+   * so no scalar adjustment is necessary.
+   */
+  xge_t P;
 
-  pge_set_mge(ec, &g, &ec->g);
+  edwards_mul_g(ec->edwards, &P, k);
 
-  mont_mul(ec, r, &g, k, 1);
+  pge_set_xge(ec, r, &P);
+
+  xge_cleanse(ec->edwards, &P);
 }
 
 static void
@@ -6690,291 +6498,21 @@ xge_neg_cond(const edwards_t *ec, xge_t *r, const xge_t *p, int flag) {
   fe_neg_cond(fe, r->t, p->t, flag);
 }
 
-static void
-xge_dbl(const edwards_t *ec, xge_t *p3, const xge_t *p1) {
-  /* https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#doubling-dbl-2008-hwcd
-   * 4M + 4S + 6A + 1*a + 1*2
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t a, b, c, d, e, g, f, h;
-
-  /* A = X1^2 */
-  fe_sqr(fe, a, p1->x);
-
-  /* B = Y1^2 */
-  fe_sqr(fe, b, p1->y);
-
-  /* C = 2 * Z1^2 */
-  fe_sqr(fe, c, p1->z);
-  fe_add(fe, c, c, c);
-
-  /* D = a * A */
-  edwards_mul_a(ec, d, a);
-
-  /* E = (X1 + Y1)^2 - A - B */
-  fe_add_nc(fe, e, p1->x, p1->y);
-  fe_sqr(fe, e, e);
-  fe_sub(fe, e, e, a);
-  fe_sub_nc(fe, e, e, b);
-
-  /* G = D + B */
-  fe_add(fe, g, d, b);
-
-  /* F = G - C */
-  fe_sub_nc(fe, f, g, c);
-
-  /* H = D - B */
-  fe_sub_nc(fe, h, d, b);
-
-  /* X3 = E * F */
-  fe_mul(fe, p3->x, e, f);
-
-  /* Y3 = G * H */
-  fe_mul(fe, p3->y, g, h);
-
-  /* T3 = E * H */
-  fe_mul(fe, p3->t, e, h);
-
-  /* Z3 = F * G */
-  fe_mul(fe, p3->z, f, g);
-}
-
-static void
-xge_add_a(const edwards_t *ec, xge_t *p3,
-          const xge_t *p1, const xge_t *p2, int affine) {
-  /* https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-add-2008-hwcd
-   * 9M + 7A + 1*a + 1*d
-   *
-   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-madd-2008-hwcd
-   * 8M + 7A + 1*a + 1*d
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t a, b, c, d, e, f, g, h;
-
-  /* A = X1 * X2 */
-  fe_mul(fe, a, p1->x, p2->x);
-
-  /* B = Y1 * Y2 */
-  fe_mul(fe, b, p1->y, p2->y);
-
-  /* C = T1 * d * T2 */
-  fe_mul(fe, c, p1->t, p2->t);
-  edwards_mul_d(ec, c, c);
-
-  /* D = Z1 * Z2 */
-  if (affine)
-    fe_set(fe, d, p1->z);
-  else
-    fe_mul(fe, d, p1->z, p2->z);
-
-  /* E = (X1 + Y1) * (X2 + Y2) - A - B */
-  fe_add_nc(fe, f, p1->x, p1->y);
-  fe_add_nc(fe, g, p2->x, p2->y);
-  fe_mul(fe, e, f, g);
-  fe_sub(fe, e, e, a);
-  fe_sub_nc(fe, e, e, b);
-
-  /* F = D - C */
-  fe_sub_nc(fe, f, d, c);
-
-  /* G = D + C */
-  fe_add_nc(fe, g, d, c);
-
-  /* H = B - a * A */
-  edwards_mul_a(ec, h, a);
-  fe_sub_nc(fe, h, b, h);
-
-  /* X3 = E * F */
-  fe_mul(fe, p3->x, e, f);
-
-  /* Y3 = G * H */
-  fe_mul(fe, p3->y, g, h);
-
-  /* T3 = E * H */
-  fe_mul(fe, p3->t, e, h);
-
-  /* Z3 = F * G */
-  fe_mul(fe, p3->z, f, g);
-}
-
-static void
-xge_sub_a(const edwards_t *ec, xge_t *p3,
-          const xge_t *p1, const xge_t *p2, int affine) {
-  /* https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-add-2008-hwcd
-   * 9M + 7A + 1*a + 1*d
-   *
-   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-madd-2008-hwcd
-   * 8M + 7A + 1*a + 1*d
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t a, b, c, d, e, f, g, h;
-
-  /* A = X1 * X2 */
-  fe_mul(fe, a, p1->x, p2->x);
-
-  /* B = Y1 * Y2 */
-  fe_mul(fe, b, p1->y, p2->y);
-
-  /* C = T1 * d * T2 */
-  fe_mul(fe, c, p1->t, p2->t);
-  edwards_mul_d(ec, c, c);
-
-  /* D = Z1 * Z2 */
-  if (affine)
-    fe_set(fe, d, p1->z);
-  else
-    fe_mul(fe, d, p1->z, p2->z);
-
-  /* E = (Y1 + X1) * (Y2 - X2) + A - B */
-  fe_add_nc(fe, f, p1->y, p1->x);
-  fe_sub_nc(fe, g, p2->y, p2->x);
-  fe_mul(fe, e, f, g);
-  fe_add(fe, e, e, a);
-  fe_sub_nc(fe, e, e, b);
-
-  /* F = D + C */
-  fe_add_nc(fe, f, d, c);
-
-  /* G = D - C */
-  fe_sub_nc(fe, g, d, c);
-
-  /* H = B + a * A */
-  edwards_mul_a(ec, h, a);
-  fe_add_nc(fe, h, b, h);
-
-  /* X3 = E * F */
-  fe_mul(fe, p3->x, e, f);
-
-  /* Y3 = G * H */
-  fe_mul(fe, p3->y, g, h);
-
-  /* T3 = E * H */
-  fe_mul(fe, p3->t, e, h);
-
-  /* Z3 = F * G */
-  fe_mul(fe, p3->z, f, g);
-}
+#define GROUP(name) name
+#define GROUP_FE(ec) (&(ec)->fe)
+#define GROUP_DISPATCH
+#define GROUP_EDWARDS
+#include "group.h"
 
 static void
-xge_add_m1(const edwards_t *ec, xge_t *p3,
-           const xge_t *p1, const xge_t *p2, int affine) {
-  /* Assumes a = -1.
-   *
-   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-add-2008-hwcd-3
-   * 8M + 8A + 1*k + 1*2
-   *
-   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-madd-2008-hwcd-3
-   * 7M + 8A + 1*k + 1*2
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t a, b, c, d, e, f, g, h;
-
-  /* A = (Y1 - X1) * (Y2 - X2) */
-  fe_sub_nc(fe, c, p1->y, p1->x);
-  fe_sub_nc(fe, d, p2->y, p2->x);
-  fe_mul(fe, a, c, d);
-
-  /* B = (Y1 + X1) * (Y2 + X2) */
-  fe_add_nc(fe, c, p1->y, p1->x);
-  fe_add_nc(fe, d, p2->y, p2->x);
-  fe_mul(fe, b, c, d);
-
-  /* C = T1 * k * T2 */
-  fe_mul(fe, c, p1->t, p2->t);
-  fe_mul(fe, c, c, ec->k);
-
-  /* D = Z1 * 2 * Z2 */
-  if (affine) {
-    fe_add(fe, d, p1->z, p1->z);
-  } else {
-    fe_add_nc(fe, d, p1->z, p1->z);
-    fe_mul(fe, d, d, p2->z);
-  }
-
-  /* E = B - A */
-  fe_sub_nc(fe, e, b, a);
-
-  /* F = D - C */
-  fe_sub_nc(fe, f, d, c);
-
-  /* G = D + C */
-  fe_add_nc(fe, g, d, c);
-
-  /* H = B + A */
-  fe_add_nc(fe, h, b, a);
-
-  /* X3 = E * F */
-  fe_mul(fe, p3->x, e, f);
-
-  /* Y3 = G * H */
-  fe_mul(fe, p3->y, g, h);
-
-  /* T3 = E * H */
-  fe_mul(fe, p3->t, e, h);
-
-  /* Z3 = F * G */
-  fe_mul(fe, p3->z, f, g);
+xge_dbl(const edwards_t *ec, xge_t *p3, const xge_t *p1) {
+  xge_dbl_ext(ec, p3, p1, 1);
 }
 
 static void
-xge_sub_m1(const edwards_t *ec, xge_t *p3,
-           const xge_t *p1, const xge_t *p2, int affine) {
-  /* Assumes a = -1.
-   *
-   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-add-2008-hwcd-3
-   * 8M + 8A + 1*k + 1*2
-   *
-   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-madd-2008-hwcd-3
-   * 7M + 8A + 1*k + 1*2
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t a, b, c, d, e, f, g, h;
-
-  /* A = (Y1 - X1) * (Y2 + X2) */
-  fe_sub_nc(fe, c, p1->y, p1->x);
-  fe_add_nc(fe, d, p2->y, p2->x);
-  fe_mul(fe, a, c, d);
-
-  /* B = (Y1 + X1) * (Y2 - X2) */
-  fe_add_nc(fe, c, p1->y, p1->x);
-  fe_sub_nc(fe, d, p2->y, p2->x);
-  fe_mul(fe, b, c, d);
-
-  /* C = T1 * k * T2 */
-  fe_mul(fe, c, p1->t, p2->t);
-  fe_mul(fe, c, c, ec->k);
-
-  /* D = Z1 * 2 * Z2 */
-  if (affine) {
-    fe_add(fe, d, p1->z, p1->z);
-  } else {
-    fe_add_nc(fe, d, p1->z, p1->z);
-    fe_mul(fe, d, d, p2->z);
-  }
-
-  /* E = B - A */
-  fe_sub_nc(fe, e, b, a);
-
-  /* F = D + C */
-  fe_add_nc(fe, f, d, c);
-
-  /* G = D - C */
-  fe_sub_nc(fe, g, d, c);
-
-  /* H = B + A */
-  fe_add_nc(fe, h, b, a);
-
-  /* X3 = E * F */
-  fe_mul(fe, p3->x, e, f);
-
-  /* Y3 = G * H */
-  fe_mul(fe, p3->y, g, h);
-
-  /* T3 = E * H */
-  fe_mul(fe, p3->t, e, h);
-
-  /* Z3 = F * G */
-  fe_mul(fe, p3->z, f, g);
+xge_dbl_proj(const edwards_t *ec, xge_t *p3, const xge_t *p1) {
+  /* Result has no valid T. Must be doubled again. */
+  xge_dbl_ext(ec, p3, p1, 0);
 }
 
 static void
@@ -7084,38 +6622,13 @@ xge_normalize_all_var(const edwards_t *ec, xge_t *out,
 }
 
 static void
-xge_fixed_points(const edwards_t *ec, xge_t *out, const xge_t *p) {
-  const scalar_field_t *sc = &ec->sc;
-  mp_bits_t steps = FIXED_STEPS(sc->bits);
-  mp_bits_t size = steps * FIXED_SIZE;
-  mp_bits_t i, j;
-  xge_t g;
+xge_naf_points(const edwards_t *ec, xge_t *out, const xge_t *p, int width) {
+  int size = 1 << (width - 2);
+  xge_t dbl;
+  int i;
 
-  xge_set(ec, &g, p);
-
-  for (i = 0; i < steps; i++) {
-    xge_t *wnd = &out[i * FIXED_SIZE];
-
-    xge_zero(ec, &wnd[0]);
-
-    for (j = 1; j < FIXED_SIZE; j++)
-      xge_add(ec, &wnd[j], &wnd[j - 1], &g);
-
-    for (j = 0; j < FIXED_WIDTH; j++)
-      xge_dbl(ec, &g, &g);
-  }
-
-  xge_normalize_all_var(ec, out, out, size);
-}
-
-static void
-xge_naf_points(const edwards_t *ec, xge_t *out, const xge_t *p, int width) {
-  int size = 1 << (width - 2);
-  xge_t dbl;
-  int i;
-
-  xge_dbl(ec, &dbl, p);
-  xge_set(ec, &out[0], p);
+  xge_dbl(ec, &dbl, p);
+  xge_set(ec, &out[0], p);
 
   for (i = 1; i < size; i++)
     xge_add(ec, &out[i], &out[i - 1], &dbl);
@@ -7145,6 +6658,177 @@ xge_export_mge(const edwards_t *ec, mge_t *r, const xge_t *p) {
   _edwards_to_mont(&ec->fe, r, p, ec->c, ec->invert, 1);
 }
 
+/*
+ * Edwards Niels Point
+ */
+
+static void
+nge_zero(const edwards_t *ec, nge_t *r) {
+  const prime_field_t *fe = &ec->fe;
+
+  if (ec->mone_a)
+    fe_set(fe, r->x, fe->one);
+  else
+    fe_zero(fe, r->x);
+
+  fe_set(fe, r->y, fe->one);
+  fe_zero(fe, r->t);
+}
+
+static void
+nge_select(const edwards_t *ec,
+           nge_t *p3,
+           const nge_t *p1,
+           const nge_t *p2,
+           int flag) {
+  const prime_field_t *fe = &ec->fe;
+
+  fe_select(fe, p3->x, p1->x, p2->x, flag);
+  fe_select(fe, p3->y, p1->y, p2->y, flag);
+  fe_select(fe, p3->t, p1->t, p2->t, flag);
+}
+
+static void
+nge_neg_cond(const edwards_t *ec, nge_t *r, int flag) {
+  const prime_field_t *fe = &ec->fe;
+
+  if (ec->mone_a)
+    fe_swap(fe, r->x, r->y, flag);
+  else
+    fe_neg_cond(fe, r->x, r->x, flag);
+
+  fe_neg_cond(fe, r->t, r->t, flag);
+}
+
+static void
+nge_set_xge(const edwards_t *ec, nge_t *r, const xge_t *p) {
+  /* Assumes Z = 1. */
+  const prime_field_t *fe = &ec->fe;
+
+  if (ec->mone_a) {
+    fe_add(fe, r->x, p->y, p->x);
+    fe_sub(fe, r->y, p->y, p->x);
+    fe_mul(fe, r->t, p->t, ec->k);
+  } else {
+    fe_set(fe, r->x, p->x);
+    fe_set(fe, r->y, p->y);
+    edwards_mul_d(ec, r->t, p->t);
+  }
+}
+
+static void
+nge_fixed_points(const edwards_t *ec, nge_t *out, const xge_t *p) {
+  const scalar_field_t *sc = &ec->sc;
+  mp_bits_t steps = FIXED_STEPS(sc->bits);
+  mp_bits_t size = steps * FIXED_SIZE;
+  xge_t *wnds = (xge_t *)checked_malloc(size * sizeof(xge_t)); /* 294.8kb */
+  mp_bits_t i, j;
+  xge_t g;
+
+  xge_set(ec, &g, p);
+
+  for (i = 0; i < steps; i++) {
+    xge_t *wnd = &wnds[i * FIXED_SIZE];
+
+    xge_set(ec, &wnd[0], &g);
+
+    for (j = 1; j < FIXED_SIZE; j++)
+      xge_add(ec, &wnd[j], &wnd[j - 1], &g);
+
+    for (j = 0; j < FIXED_WIDTH; j++)
+      xge_dbl(ec, &g, &g);
+  }
+
+  xge_normalize_all_var(ec, wnds, wnds, size);
+
+  for (i = 0; i < size; i++)
+    nge_set_xge(ec, &out[i], &wnds[i]);
+
+  free(wnds);
+}
+
+static void
+xge_niels_add(const edwards_t *ec, xge_t *p3,
+              const xge_t *p1, const nge_t *p2) {
+  /* Mixed addition with a precomputed point.
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-madd-2008-hwcd-3
+   * 7M + 6A + 1*2 (a = -1)
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-madd-2008-hwcd
+   * 8M + 7A + 1*a (a != -1)
+   *
+   * The multiplications by `2 * d` (or `d`) and
+   * the sum and difference of the coordinates are
+   * absorbed into the precomputation.
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t a, b, c, d, e, f, g, h;
+
+  if (ec->mone_a) {
+    /* A = (Y1 - X1) * (Y2 - X2) */
+    fe_sub_nc(fe, c, p1->y, p1->x);
+    fe_mul(fe, a, c, p2->y);
+
+    /* B = (Y1 + X1) * (Y2 + X2) */
+    fe_add_nc(fe, c, p1->y, p1->x);
+    fe_mul(fe, b, c, p2->x);
+
+    /* C = T1 * k * T2 */
+    fe_mul(fe, c, p1->t, p2->t);
+
+    /* D = Z1 * 2 */
+    fe_add(fe, d, p1->z, p1->z);
+
+    /* E = B - A */
+    fe_sub_nc(fe, e, b, a);
+
+    /* H = B + A */
+    fe_add_nc(fe, h, b, a);
+  } else {
+    /* A = X1 * X2 */
+    fe_mul(fe, a, p1->x, p2->x);
+
+    /* B = Y1 * Y2 */
+    fe_mul(fe, b, p1->y, p2->y);
+
+    /* C = T1 * d * T2 */
+    fe_mul(fe, c, p1->t, p2->t);
+
+    /* D = Z1 */
+    fe_set(fe, d, p1->z);
+
+    /* E = (X1 + Y1) * (X2 + Y2) - A - B */
+    fe_add_nc(fe, f, p1->x, p1->y);
+    fe_add_nc(fe, g, p2->x, p2->y);
+    fe_mul(fe, e, f, g);
+    fe_sub(fe, e, e, a);
+    fe_sub_nc(fe, e, e, b);
+
+    /* H = B - a * A */
+    edwards_mul_a(ec, h, a);
+    fe_sub_nc(fe, h, b, h);
+  }
+
+  /* F = D - C */
+  fe_sub_nc(fe, f, d, c);
+
+  /* G = D + C */
+  fe_add_nc(fe, g, d, c);
+
+  /* X3 = E * F */
+  fe_mul(fe, p3->x, e, f);
+
+  /* Y3 = G * H */
+  fe_mul(fe, p3->y, g, h);
+
+  /* T3 = E * H */
+  fe_mul(fe, p3->t, e, h);
+
+  /* Z3 = F * G */
+  fe_mul(fe, p3->z, f, g);
+}
+
 /*
  * Edwards Curve
  */
@@ -7156,10 +6840,11 @@ static void
 ristretto_init(edwards_t *ec, const ristretto_def_t *def);
 
 static void
-edwards_init(edwards_t *ec, const edwards_def_t *def) {
+edwards_init_fixed(edwards_t *ec, const edwards_def_t *def) {
+  /* Everything `edwards_mul_g` needs. */
   prime_field_t *fe = &ec->fe;
   scalar_field_t *sc = &ec->sc;
-  unsigned int i;
+  const edwards_group_t *group;
 
   memset(ec, 0, sizeof(*ec));
 
@@ -7171,6 +6856,18 @@ edwards_init(edwards_t *ec, const edwards_def_t *def) {
   prime_field_init(fe, def->fe, -1);
   scalar_field_init(sc, def->sc, -1);
 
+  /* Use the group law instantiated for our field kernel. */
+  for (group = def->groups; group != NULL && group->kernel != NULL; group++) {
+    if (group->kernel == fe->mul) {
+      /* Lane-parallel groups need AVX2 at runtime. */
+      if (group->mul_g != NULL && !torsion_has_avx2())
+        continue;
+
+      ec->group = group;
+      break;
+    }
+  }
+
   ASSERT(sc->limbs >= fe->limbs);
 
   fe_import_be(fe, ec->a, def->a);
@@ -7191,7 +6888,18 @@ edwards_init(edwards_t *ec, const edwards_def_t *def) {
   sc_zero(sc, ec->blind);
   xge_zero(ec, &ec->unblind);
 
-  xge_fixed_points(ec, ec->wnd_fixed, &ec->g);
+  nge_fixed_points(ec, ec->wnd_fixed, &ec->g);
+}
+
+static void
+edwards_init(edwards_t *ec, const edwards_def_t *def) {
+  const prime_field_t *fe = &ec->fe;
+  unsigned int i;
+
+  edwards_init_fixed(ec, def);
+
+  ec->wnd_naf = (xge_t *)checked_malloc(NAF_SIZE_PRE * sizeof(xge_t));
+
   xge_fixed_naf_points(ec, ec->wnd_naf, &ec->g, NAF_WIDTH_PRE);
 
   for (i = 0; i < ec->h; i++) {
@@ -7294,28 +7002,6 @@ edwards_clamp(const edwards_t *ec,
   out[sc->size - 1] |= 1 << (top - 1);
 }
 
-static void
-edwards_mul_a(const edwards_t *ec, fe_t z, const fe_t x) {
-  const prime_field_t *fe = &ec->fe;
-
-  if (ec->mone_a)
-    fe_neg(fe, z, x); /* a = -1 */
-  else if (ec->one_a)
-    fe_set(fe, z, x); /* a = 1 */
-  else
-    fe_mul(fe, z, x, ec->a);
-}
-
-static void
-edwards_mul_d(const edwards_t *ec, fe_t z, const fe_t x) {
-  const prime_field_t *fe = &ec->fe;
-
-  if (fe->scmul_d != NULL)
-    fe->scmul_d(z, x);
-  else
-    fe_mul(fe, z, x, ec->d);
-}
-
 static int
 edwards_validate_xy(const edwards_t *ec, const fe_t x, const fe_t y) {
   /* [TWISTED] Definition 2.1, Page 3, Section 2. */
@@ -7347,34 +7033,51 @@ edwards_mul_g(const edwards_t *ec, xge_t *r, const sc_t k) {
    * Windows are appropriately shifted to avoid any
    * doublings. This reduces a 256 bit multiplication
    * down to 64 additions with a window size of 4.
+   *
+   * Digits are signed (see `wei_jmul_g`) and windows
+   * are stored in Niels form.
    */
   const scalar_field_t *sc = &ec->sc;
-  const xge_t *wnds = ec->wnd_fixed;
+  const nge_t *wnds = ec->wnd_fixed;
   mp_bits_t steps = FIXED_STEPS(sc->bits);
-  mp_bits_t i, j, b;
+  mp_limb_t j, b, carry;
+  mp_bits_t i;
   sc_t k0;
-  xge_t t;
+  nge_t t;
+
+  if (ec->group != NULL && ec->group->mul_g != NULL) {
+    ec->group->mul_g(ec, r, k);
+    return;
+  }
 
   /* Blind if available. */
   sc_add(sc, k0, k, ec->blind);
 
   /* Multiply in constant time. */
   xge_set(ec, r, &ec->unblind);
-  xge_zero(ec, &t);
+
+  carry = 0;
 
   for (i = 0; i < steps; i++) {
-    b = sc_get_bits(sc, k0, i * FIXED_WIDTH, FIXED_WIDTH);
+    b = sc_get_bits(sc, k0, i * FIXED_WIDTH, FIXED_WIDTH) + carry;
+
+    carry = sc_fixed_digit(&b, i == steps - 1);
+
+    nge_zero(ec, &t);
 
     for (j = 0; j < FIXED_SIZE; j++)
-      xge_select(ec, &t, &t, &wnds[i * FIXED_SIZE + j], j == b);
+      nge_select(ec, &t, &t, &wnds[i * FIXED_SIZE + j], j + 1 == b);
 
-    xge_mixed_add(ec, r, r, &t);
+    nge_neg_cond(ec, &t, carry);
+
+    xge_niels_add(ec, r, r, &t);
   }
 
   /* Cleanse. */
   sc_cleanse(sc, k0);
 
   cleanse(&b, sizeof(b));
+  cleanse(&carry, sizeof(carry));
 }
 
 static void
@@ -7413,9 +7116,10 @@ edwards_mul(const edwards_t *ec, xge_t *r, const xge_t *p, const sc_t k) {
     if (i == steps - 1) {
       xge_set(ec, r, &t);
     } else {
-      for (j = 0; j < WND_WIDTH; j++)
-        xge_dbl(ec, r, r);
+      for (j = 0; j < WND_WIDTH - 1; j++)
+        xge_dbl_proj(ec, r, r);
 
+      xge_dbl(ec, r, r);
       xge_add(ec, r, r, &t);
     }
   }
@@ -7442,6 +7146,11 @@ edwards_mul_double_var(const edwards_t *ec,
   xge_t wnd2[NAF_SIZE]; /* 2304 bytes */
   mp_bits_t i, max, max1, max2;
 
+  if (ec->group != NULL && ec->group->mul_double_var != NULL) {
+    ec->group->mul_double_var(ec, r, k1, p2, k2);
+    return;
+  }
+
   /* Compute NAFs. */
   max1 = sc_naf_var(sc, naf1, k1, NAF_WIDTH_PRE);
   max2 = sc_naf_var(sc, naf2, k2, NAF_WIDTH);
@@ -7457,8 +7166,13 @@ edwards_mul_double_var(const edwards_t *ec,
     int z1 = naf1[i];
     int z2 = naf2[i];
 
-    if (i != max - 1)
-      xge_dbl(ec, r, r);
+    /* T is only needed by an addition. */
+    if (i != max - 1) {
+      if (z1 | z2 | (i == 0))
+        xge_dbl(ec, r, r);
+      else
+        xge_dbl_proj(ec, r, r);
+    }
 
     if (z1 > 0)
       xge_mixed_add(ec, r, r, &wnd1[(z1 - 1) >> 1]);
@@ -7496,6 +7210,11 @@ edwards_mul_multi_var(const edwards_t *ec,
   mp_bits_t i, max, size;
   size_t j;
 
+  if (ec->group != NULL && ec->group->mul_multi_var != NULL) {
+    ec->group->mul_multi_var(ec, r, k0, points, coeffs, len, scratch);
+    return;
+  }
+
   ASSERT(len <= scratch->size);
 
   /* Compute fixed NAF. */
@@ -7534,9 +7253,18 @@ edwards_mul_multi_var(const edwards_t *ec,
   for (i = max - 1; i >= 0; i--) {
     int z0 = naf0[i];
     int z1 = naf1[i];
+    int ext = z0 | z1 | (i == 0);
 
-    if (i != max - 1)
-      xge_dbl(ec, r, r);
+    for (j = 0; j < len && ext == 0; j++)
+      ext |= nafs[j][i];
+
+    /* T is only needed by an addition. */
+    if (i != max - 1) {
+      if (ext)
+        xge_dbl(ec, r, r);
+      else
+        xge_dbl_proj(ec, r, r);
+    }
 
     if (z0 > 0)
       xge_mixed_add(ec, r, r, &wnd0[(z0 - 1) >> 1]);
@@ -9070,6 +8798,9 @@ static const prime_def_t field_p192 = {
   p192_fe_invert,
   p192_fe_sqrt,
   p192_fe_isqrt,
+  NULL,
+  NULL,
+  NULL,
   NULL
 };
 
@@ -9119,7 +8850,10 @@ static const prime_def_t field_p224 = {
   p224_fe_invert,
   p224_fe_sqrt,
   NULL,
-  p224_fe_legendre
+  p224_fe_legendre,
+  NULL,
+  NULL,
+  NULL
 };
 
 static const scalar_def_t field_q224 = {
@@ -9169,6 +8903,14 @@ static const prime_def_t field_p256 = {
   p256_fe_invert,
   p256_fe_sqrt,
   p256_fe_isqrt,
+  NULL,
+#if defined(P256_HAVE_ADX)
+  p256_fe_mul_adx,
+  p256_fe_sqr_adx,
+#else
+  NULL,
+  NULL,
+#endif
   NULL
 };
 
@@ -9221,6 +8963,9 @@ static const prime_def_t field_p384 = {
   p384_fe_invert,
   p384_fe_sqrt,
   p384_fe_isqrt,
+  NULL,
+  NULL,
+  NULL,
   NULL
 };
 
@@ -9278,6 +9023,9 @@ static const prime_def_t field_p521 = {
   p521_fe_invert,
   p521_fe_sqrt,
   p521_fe_isqrt,
+  NULL,
+  NULL,
+  NULL,
   NULL
 };
 
@@ -9303,6 +9051,44 @@ static const scalar_def_t field_q521 = {
 
 #include "fields/secp256k1.h"
 
+#if defined(SECP256K1_HAVE_52)
+static const prime_def_t field_secp256k1_52 = {
+  256,
+  5,
+  /* 2^256 - 2^32 - 977 (= 3 mod 4) */
+  {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x2f
+  },
+  secp256k1_52_add,
+  secp256k1_52_sub,
+  secp256k1_52_opp,
+  secp256k1_52_carry,
+  secp256k1_52_carry_mul,
+  secp256k1_52_carry_square,
+  secp256k1_52_carry_scmul_3,
+  secp256k1_52_carry_scmul_4,
+  secp256k1_52_carry_scmul_8,
+  NULL,
+  NULL,
+  NULL,
+  secp256k1_52_selectznz,
+  NULL,
+  NULL,
+  secp256k1_52_to_bytes,
+  secp256k1_52_from_bytes,
+  secp256k1_52_fe_invert,
+  secp256k1_52_fe_sqrt,
+  secp256k1_52_fe_isqrt,
+  NULL,
+  NULL,
+  NULL,
+  NULL
+};
+#endif
+
 static const prime_def_t field_secp256k1 = {
   256,
   SECP256K1_FIELD_WORDS,
@@ -9333,7 +9119,14 @@ static const prime_def_t field_secp256k1 = {
   secp256k1_fe_invert,
   secp256k1_fe_sqrt,
   secp256k1_fe_isqrt,
+  NULL,
+  NULL,
+  NULL,
+#if defined(SECP256K1_HAVE_52)
+  &field_secp256k1_52
+#else
   NULL
+#endif
 };
 
 static const scalar_def_t field_secq256k1 = {
@@ -9383,6 +9176,9 @@ static const prime_def_t field_p25519 = {
   p25519_fe_invert,
   p25519_fe_sqrt,
   p25519_fe_isqrt,
+  NULL,
+  NULL,
+  NULL,
   NULL
 };
 
@@ -9436,6 +9232,9 @@ static const prime_def_t field_p448 = {
   p448_fe_invert,
   p448_fe_sqrt,
   p448_fe_isqrt,
+  NULL,
+  NULL,
+  NULL,
   NULL
 };
 
@@ -9489,6 +9288,9 @@ static const prime_def_t field_p251 = {
   p251_fe_invert,
   p251_fe_sqrt,
   p251_fe_isqrt,
+  NULL,
+  NULL,
+  NULL,
   NULL
 };
 
@@ -9549,26 +9351,604 @@ static const endo_def_t endo_secp256k1 = {
 };
 
 /*
- * Torsion Points
+ * Specialized Groups
  */
 
-#include "subgroups.h"
-
-/*
- * Ristretto
+/* The generic group law reaches every field operation
+ * through a function pointer, which keeps the field
+ * arithmetic from being inlined into the formulas.
+ * With TORSION_SPECIALIZE, group.h is instantiated
+ * once more per hot field against a constant field
+ * table, and the curve picks the instance matching
+ * its field's multiplication kernel at init time.
  */
 
-static const ristretto_def_t ristretto_ed25519 = {
-  {
-    0x2b, 0x83, 0x24, 0x80, 0x4f, 0xc1, 0xdf, 0x0b,
-    0x2b, 0x4d, 0x00, 0x99, 0x3d, 0xfb, 0xd7, 0xa7,
-    0x2f, 0x43, 0x18, 0x06, 0xad, 0x2f, 0xe4, 0x78,
-    0xc4, 0xee, 0x1b, 0x27, 0x4a, 0x0e, 0xa0, 0xb0
-  },
-  {
-    0x7a, 0x4c, 0xaa, 0xa7, 0x0b, 0x84, 0x14, 0x68,
-    0x8a, 0xcb, 0xab, 0x66, 0x8c, 0x14, 0x91, 0xea,
-    0x32, 0x43, 0x56, 0xd2, 0xf1, 0x15, 0x92, 0x55,
+#if defined(TORSION_SPECIALIZE)
+
+#define FE_CONST(name, endian, bits, words,                                \
+                 add, sub, opp, carry, mul, square,                        \
+                 scmul_3, scmul_4, scmul_8, scmul_a24, scmul_d,            \
+                 nonzero, selectznz, to_mont, from_mont,                   \
+                 to_bytes, from_bytes, invert, sqrt, isqrt, legendre)      \
+static const prime_field_t name = {                                        \
+  (endian),                                                                \
+  (bits),                                                                  \
+  (words),                                                                 \
+  ((bits) + MP_LIMB_BITS - 1) / MP_LIMB_BITS,                              \
+  ((bits) + 7) / 8,                                                        \
+  ((bits) + 7) / 8 + (((bits) & 7) == 0),                                  \
+  ((bits) & 7) ? (1 << ((bits) & 7)) - 1 : 0xff,                           \
+  {0},                                                                     \
+  {0},                                                                     \
+  add, sub, opp, carry, mul, square,                                       \
+  scmul_3, scmul_4, scmul_8, scmul_a24, scmul_d,                           \
+  nonzero, selectznz, to_mont, from_mont,                                  \
+  to_bytes, from_bytes, invert, sqrt, isqrt, legendre,                     \
+  {0}, {0}, {0}, {0}, {0}, {0}                                             \
+}
+
+FE_CONST(field_p256_const, 1, 256, P256_FIELD_WORDS,
+         fiat_p256_add,
+         fiat_p256_sub,
+         fiat_p256_opp,
+         NULL,
+         fiat_p256_mul,
+         fiat_p256_square,
+         fiat_p256_scmul_3,
+         fiat_p256_scmul_4,
+         fiat_p256_scmul_8,
+         NULL,
+         NULL,
+         fiat_p256_nonzero,
+         fiat_p256_selectznz,
+         fiat_p256_to_montgomery,
+         fiat_p256_from_montgomery,
+         fiat_p256_to_bytes,
+         fiat_p256_from_bytes,
+         p256_fe_invert,
+         p256_fe_sqrt,
+         p256_fe_isqrt,
+         NULL);
+
+#define GROUP(name) p256_ ## name
+#define GROUP_FE(ec) (&field_p256_const)
+#define GROUP_WEI
+#include "group.h"
+
+#if defined(P256_HAVE_ADX)
+FE_CONST(field_p256_adx_const, 1, 256, P256_FIELD_WORDS,
+         fiat_p256_add,
+         fiat_p256_sub,
+         fiat_p256_opp,
+         NULL,
+         p256_fe_mul_adx,
+         p256_fe_sqr_adx,
+         fiat_p256_scmul_3,
+         fiat_p256_scmul_4,
+         fiat_p256_scmul_8,
+         NULL,
+         NULL,
+         fiat_p256_nonzero,
+         fiat_p256_selectznz,
+         fiat_p256_to_montgomery,
+         fiat_p256_from_montgomery,
+         fiat_p256_to_bytes,
+         fiat_p256_from_bytes,
+         p256_fe_invert,
+         p256_fe_sqrt,
+         p256_fe_isqrt,
+         NULL);
+
+#define GROUP(name) p256_adx_ ## name
+#define GROUP_FE(ec) (&field_p256_adx_const)
+#define GROUP_WEI
+#include "group.h"
+#endif /* P256_HAVE_ADX */
+
+FE_CONST(field_secp256k1_const, 1, 256, SECP256K1_FIELD_WORDS,
+         fiat_secp256k1_add,
+         fiat_secp256k1_sub,
+         fiat_secp256k1_opp,
+         fiat_secp256k1_carry,
+         fiat_secp256k1_carry_mul,
+         fiat_secp256k1_carry_square,
+         fiat_secp256k1_carry_scmul_3,
+         fiat_secp256k1_carry_scmul_4,
+         fiat_secp256k1_carry_scmul_8,
+         NULL,
+         NULL,
+         NULL,
+         fiat_secp256k1_selectznz,
+         NULL,
+         NULL,
+         fiat_secp256k1_to_bytes,
+         fiat_secp256k1_from_bytes,
+         secp256k1_fe_invert,
+         secp256k1_fe_sqrt,
+         secp256k1_fe_isqrt,
+         NULL);
+
+#define GROUP(name) secp256k1_ ## name
+#define GROUP_FE(ec) (&field_secp256k1_const)
+#define GROUP_WEI
+#include "group.h"
+
+#if defined(SECP256K1_HAVE_52)
+FE_CONST(field_secp256k1_52_const, 1, 256, 5,
+         secp256k1_52_add,
+         secp256k1_52_sub,
+         secp256k1_52_opp,
+         secp256k1_52_carry,
+         secp256k1_52_carry_mul,
+         secp256k1_52_carry_square,
+         secp256k1_52_carry_scmul_3,
+         secp256k1_52_carry_scmul_4,
+         secp256k1_52_carry_scmul_8,
+         NULL,
+         NULL,
+         NULL,
+         secp256k1_52_selectznz,
+         NULL,
+         NULL,
+         secp256k1_52_to_bytes,
+         secp256k1_52_from_bytes,
+         secp256k1_52_fe_invert,
+         secp256k1_52_fe_sqrt,
+         secp256k1_52_fe_isqrt,
+         NULL);
+
+#define GROUP(name) secp256k1_52_ ## name
+#define GROUP_FE(ec) (&field_secp256k1_52_const)
+#define GROUP_WEI
+#include "group.h"
+#endif /* SECP256K1_HAVE_52 */
+
+FE_CONST(field_p25519_const, -1, 255, P25519_FIELD_WORDS,
+         fiat_p25519_add,
+         fiat_p25519_sub,
+         fiat_p25519_opp,
+         fiat_p25519_carry,
+         fiat_p25519_carry_mul,
+         fiat_p25519_carry_square,
+         fiat_p25519_carry_scmul_3,
+         fiat_p25519_carry_scmul_4,
+         fiat_p25519_carry_scmul_8,
+         fiat_p25519_carry_scmul_121666,
+         NULL,
+         NULL,
+         fiat_p25519_selectznz,
+         NULL,
+         NULL,
+         fiat_p25519_to_bytes,
+         fiat_p25519_from_bytes,
+         p25519_fe_invert,
+         p25519_fe_sqrt,
+         p25519_fe_isqrt,
+         NULL);
+
+#define GROUP(name) p25519_ ## name
+#define GROUP_FE(ec) (&field_p25519_const)
+#define GROUP_MONT
+#define GROUP_EDWARDS
+#include "group.h"
+
+#if defined(P25519_HAVE_AVX2)
+
+P25519X4_TARGET static void
+p25519_avx2_xge_load(p25519x4_fe_t r, const xge_t *p) {
+  const p25519_fe_word_t *xs[4];
+
+  xs[0] = p->x;
+  xs[1] = p->y;
+  xs[2] = p->z;
+  xs[3] = p->t;
+
+  p25519x4_fe_load(r, xs);
+}
+
+P25519X4_TARGET static void
+p25519_avx2_xge_store(xge_t *r, const p25519x4_fe_t p) {
+  p25519_fe_word_t *zs[4];
+
+  zs[0] = r->x;
+  zs[1] = r->y;
+  zs[2] = r->z;
+  zs[3] = r->t;
+
+  p25519x4_fe_store(zs, p);
+}
+
+P25519X4_TARGET static void
+p25519_avx2_xge_cache(p25519x4_fe_t r, const xge_t *p, const p25519x4_fe_t k) {
+  p25519x4_fe_t t;
+
+  p25519_avx2_xge_load(t, p);
+  p25519x4_xge_cache(r, t, k);
+}
+
+P25519X4_TARGET static void
+p25519_avx2_edwards_mul_g(const edwards_t *ec, xge_t *r, const sc_t k) {
+  /* See `edwards_mul_g`. A Niels point is already
+     cached: (Y - X, Y + X, 2, 2 * d * T). */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  const nge_t *wnds = ec->wnd_fixed;
+  mp_bits_t steps = FIXED_STEPS(sc->bits);
+  const p25519_fe_word_t *xs[4];
+  p25519x4_fe_t acc, q;
+  mp_limb_t j, b, carry;
+  mp_bits_t i;
+  sc_t k0;
+  nge_t t;
+
+  /* Blind if available. */
+  sc_add(sc, k0, k, ec->blind);
+
+  /* Multiply in constant time. */
+  p25519_avx2_xge_load(acc, &ec->unblind);
+
+  xs[0] = t.y;
+  xs[1] = t.x;
+  xs[2] = fe->two;
+  xs[3] = t.t;
+
+  carry = 0;
+
+  for (i = 0; i < steps; i++) {
+    b = sc_get_bits(sc, k0, i * FIXED_WIDTH, FIXED_WIDTH) + carry;
+
+    carry = sc_fixed_digit(&b, i == steps - 1);
+
+    nge_zero(ec, &t);
+
+    for (j = 0; j < FIXED_SIZE; j++)
+      nge_select(ec, &t, &t, &wnds[i * FIXED_SIZE + j], j + 1 == b);
+
+    nge_neg_cond(ec, &t, carry);
+
+    p25519x4_fe_load(q, xs);
+    p25519x4_xge_add(acc, acc, q);
+  }
+
+  p25519_avx2_xge_store(r, acc);
+
+  /* Cleanse. */
+  sc_cleanse(sc, k0);
+
+  cleanse(&b, sizeof(b));
+  cleanse(&carry, sizeof(carry));
+  cleanse(&t, sizeof(t));
+  cleanse(acc, sizeof(acc));
+  cleanse(q, sizeof(q));
+}
+
+P25519X4_TARGET static void
+p25519_avx2_xge_k(const edwards_t *ec, p25519x4_fe_t k) {
+  /* k = (1, 1, 2, 2 * d) */
+  const prime_field_t *fe = &ec->fe;
+  const p25519_fe_word_t *xs[4];
+
+  xs[0] = fe->one;
+  xs[1] = fe->one;
+  xs[2] = fe->two;
+  xs[3] = ec->k;
+
+  p25519x4_fe_load(k, xs);
+}
+
+P25519X4_TARGET static void
+p25519_avx2_xge_addsub_var(p25519x4_fe_t acc,
+                           const xge_t *wnd,
+                           const p25519x4_fe_t k,
+                           int z) {
+  p25519x4_fe_t q;
+
+  if (z > 0) {
+    p25519_avx2_xge_cache(q, &wnd[(z - 1) >> 1], k);
+  } else {
+    p25519_avx2_xge_cache(q, &wnd[(-z - 1) >> 1], k);
+    p25519x4_xge_cache_neg(q, q);
+  }
+
+  p25519x4_xge_add(acc, acc, q);
+}
+
+P25519X4_TARGET static void
+p25519_avx2_edwards_mul_double_var(const edwards_t *ec,
+                                   xge_t *r,
+                                   const sc_t k1,
+                                   const xge_t *p2,
+                                   const sc_t k2) {
+  /* See `edwards_mul_double_var`. */
+  const scalar_field_t *sc = &ec->sc;
+  const xge_t *wnd1 = ec->wnd_naf;
+  int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  int naf2[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  xge_t wnd2[NAF_SIZE]; /* 2304 bytes */
+  p25519x4_fe_t pos2[NAF_SIZE]; /* 2560 bytes */
+  p25519x4_fe_t neg2[NAF_SIZE]; /* 2560 bytes */
+  p25519x4_fe_t acc, k;
+  mp_bits_t i, max, max1, max2;
+  xge_t zero;
+
+  /* Compute NAFs. */
+  max1 = sc_naf_var(sc, naf1, k1, NAF_WIDTH_PRE);
+  max2 = sc_naf_var(sc, naf2, k2, NAF_WIDTH);
+  max = ECC_MAX(max1, max2);
+
+  /* Compute NAF points. */
+  xge_naf_points(ec, wnd2, p2, NAF_WIDTH);
+
+  p25519_avx2_xge_k(ec, k);
+
+  for (i = 0; i < NAF_SIZE; i++) {
+    p25519_avx2_xge_cache(pos2[i], &wnd2[i], k);
+    p25519x4_xge_cache_neg(neg2[i], pos2[i]);
+  }
+
+  /* Multiply and add. */
+  xge_zero(ec, &zero);
+  p25519_avx2_xge_load(acc, &zero);
+
+  for (i = max - 1; i >= 0; i--) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+
+    if (i != max - 1)
+      p25519x4_xge_dbl(acc, acc);
+
+    if (z1 != 0)
+      p25519_avx2_xge_addsub_var(acc, wnd1, k, z1);
+
+    if (z2 > 0)
+      p25519x4_xge_add(acc, acc, pos2[(z2 - 1) >> 1]);
+    else if (z2 < 0)
+      p25519x4_xge_add(acc, acc, neg2[(-z2 - 1) >> 1]);
+  }
+
+  p25519_avx2_xge_store(r, acc);
+}
+
+P25519X4_TARGET static void
+p25519_avx2_edwards_mul_multi_var(const edwards_t *ec,
+                                  xge_t *r,
+                                  const sc_t k0,
+                                  const xge_t *points,
+                                  const sc_t *coeffs,
+                                  size_t len,
+                                  edwards__scratch_t *scratch) {
+  /* See `edwards_mul_multi_var`. */
+  const scalar_field_t *sc = &ec->sc;
+  const xge_t *wnd0 = ec->wnd_naf;
+  xge_t wnd1[NAF_SIZE]; /* 2304 bytes */
+  int naf0[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  xge_t **wnds = scratch->wnds;
+  int **nafs = scratch->nafs;
+  p25519x4_fe_t acc, k;
+  mp_bits_t i, max, size;
+  xge_t zero;
+  size_t j;
+
+  ASSERT(len <= scratch->size);
+
+  /* Compute fixed NAF. */
+  max = sc_naf_var(sc, naf0, k0, NAF_WIDTH_PRE);
+
+  for (j = 0; j < len - (len & 1); j += 2) {
+    /* Compute JSF.*/
+    size = sc_jsf_var(sc, nafs[j / 2], coeffs[j], coeffs[j + 1]);
+
+    /* Create comb for JSF. */
+    xge_jsf_points(ec, wnds[j / 2], &points[j], &points[j + 1]);
+
+    /* Calculate max. */
+    max = ECC_MAX(max, size);
+  }
+
+  if (len & 1) {
+    /* Compute NAF.*/
+    size = sc_naf_var(sc, naf1, coeffs[j], NAF_WIDTH);
+
+    /* Compute NAF points. */
+    xge_naf_points(ec, wnd1, &points[j], NAF_WIDTH);
+
+    /* Calculate max. */
+    max = ECC_MAX(max, size);
+  } else {
+    for (i = 0; i < max; i++)
+      naf1[i] = 0;
+  }
+
+  len /= 2;
+
+  p25519_avx2_xge_k(ec, k);
+
+  /* Multiply and add. */
+  xge_zero(ec, &zero);
+  p25519_avx2_xge_load(acc, &zero);
+
+  for (i = max - 1; i >= 0; i--) {
+    int z0 = naf0[i];
+    int z1 = naf1[i];
+
+    if (i != max - 1)
+      p25519x4_xge_dbl(acc, acc);
+
+    if (z0 != 0)
+      p25519_avx2_xge_addsub_var(acc, wnd0, k, z0);
+
+    for (j = 0; j < len; j++) {
+      int z = nafs[j][i];
+
+      if (z != 0)
+        p25519_avx2_xge_addsub_var(acc, wnds[j], k, z);
+    }
+
+    if (z1 != 0)
+      p25519_avx2_xge_addsub_var(acc, wnd1, k, z1);
+  }
+
+  p25519_avx2_xge_store(r, acc);
+}
+
+#endif /* P25519_HAVE_AVX2 */
+
+FE_CONST(field_p448_const, -1, 448, P448_FIELD_WORDS,
+         fiat_p448_add,
+         fiat_p448_sub,
+         fiat_p448_opp,
+         fiat_p448_carry,
+         fiat_p448_carry_mul,
+         fiat_p448_carry_square,
+         fiat_p448_carry_scmul_3,
+         fiat_p448_carry_scmul_4,
+         fiat_p448_carry_scmul_8,
+         fiat_p448_carry_scmul_39082,
+         fiat_p448_carry_scmul_m39081,
+         NULL,
+         fiat_p448_selectznz,
+         NULL,
+         NULL,
+         fiat_p448_to_bytes,
+         fiat_p448_from_bytes,
+         p448_fe_invert,
+         p448_fe_sqrt,
+         p448_fe_isqrt,
+         NULL);
+
+#define GROUP(name) p448_ ## name
+#define GROUP_FE(ec) (&field_p448_const)
+#define GROUP_MONT
+#define GROUP_EDWARDS
+#include "group.h"
+
+#undef FE_CONST
+
+#endif /* TORSION_SPECIALIZE */
+
+static const wei_group_t groups_p256[] = {
+#if defined(TORSION_SPECIALIZE)
+  {
+    fiat_p256_mul,
+    p256_jge_dbl_var,
+    p256_jge_addsub_var,
+    p256_jge_mixed_addsub_var
+  },
+#if defined(P256_HAVE_ADX)
+  {
+    p256_fe_mul_adx,
+    p256_adx_jge_dbl_var,
+    p256_adx_jge_addsub_var,
+    p256_adx_jge_mixed_addsub_var
+  },
+#endif
+#endif
+  {NULL, NULL, NULL, NULL}
+};
+
+static const wei_group_t groups_secp256k1[] = {
+#if defined(TORSION_SPECIALIZE)
+  {
+    fiat_secp256k1_carry_mul,
+    secp256k1_jge_dbl_var,
+    secp256k1_jge_addsub_var,
+    secp256k1_jge_mixed_addsub_var
+  },
+#if defined(SECP256K1_HAVE_52)
+  {
+    secp256k1_52_carry_mul,
+    secp256k1_52_jge_dbl_var,
+    secp256k1_52_jge_addsub_var,
+    secp256k1_52_jge_mixed_addsub_var
+  },
+#endif
+#endif
+  {NULL, NULL, NULL, NULL}
+};
+
+static const mont_group_t groups_x25519[] = {
+#if defined(TORSION_SPECIALIZE)
+  {fiat_p25519_carry_mul, p25519_mont_mul},
+#endif
+  {NULL, NULL}
+};
+
+static const mont_group_t groups_x448[] = {
+#if defined(TORSION_SPECIALIZE)
+  {fiat_p448_carry_mul, p448_mont_mul},
+#endif
+  {NULL, NULL}
+};
+
+static const edwards_group_t groups_ed25519[] = {
+#if defined(TORSION_SPECIALIZE)
+#if defined(P25519_HAVE_AVX2)
+  {
+    fiat_p25519_carry_mul,
+    p25519_xge_dbl_ext,
+    p25519_xge_add_a,
+    p25519_xge_sub_a,
+    p25519_xge_add_m1,
+    p25519_xge_sub_m1,
+    p25519_avx2_edwards_mul_g,
+    p25519_avx2_edwards_mul_double_var,
+    p25519_avx2_edwards_mul_multi_var
+  },
+#endif
+  {
+    fiat_p25519_carry_mul,
+    p25519_xge_dbl_ext,
+    p25519_xge_add_a,
+    p25519_xge_sub_a,
+    p25519_xge_add_m1,
+    p25519_xge_sub_m1,
+    NULL,
+    NULL,
+    NULL
+  },
+#endif
+  {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL}
+};
+
+static const edwards_group_t groups_ed448[] = {
+#if defined(TORSION_SPECIALIZE)
+  {
+    fiat_p448_carry_mul,
+    p448_xge_dbl_ext,
+    p448_xge_add_a,
+    p448_xge_sub_a,
+    p448_xge_add_m1,
+    p448_xge_sub_m1,
+    NULL,
+    NULL,
+    NULL
+  },
+#endif
+  {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL}
+};
+
+/*
+ * Torsion Points
+ */
+
+#include "subgroups.h"
+
+/*
+ * Ristretto
+ */
+
+static const ristretto_def_t ristretto_ed25519 = {
+  {
+    0x2b, 0x83, 0x24, 0x80, 0x4f, 0xc1, 0xdf, 0x0b,
+    0x2b, 0x4d, 0x00, 0x99, 0x3d, 0xfb, 0xd7, 0xa7,
+    0x2f, 0x43, 0x18, 0x06, 0xad, 0x2f, 0xe4, 0x78,
+    0xc4, 0xee, 0x1b, 0x27, 0x4a, 0x0e, 0xa0, 0xb0
+  },
+  {
+    0x7a, 0x4c, 0xaa, 0xa7, 0x0b, 0x84, 0x14, 0x68,
+    0x8a, 0xcb, 0xab, 0x66, 0x8c, 0x14, 0x91, 0xea,
+    0x32, 0x43, 0x56, 0xd2, 0xf1, 0x15, 0x92, 0x55,
     0x8a, 0xcf, 0xd5, 0x34, 0xb5, 0xa3, 0xe4, 0x45
   },
   {
@@ -9729,6 +10109,7 @@ static const wei_def_t curve_p192 = {
   },
   {0},
   subgroups_prime,
+  NULL,
   NULL
 };
 
@@ -9768,6 +10149,7 @@ static const wei_def_t curve_p224 = {
   },
   {0},
   subgroups_prime,
+  NULL,
   NULL
 };
 
@@ -9807,7 +10189,8 @@ static const wei_def_t curve_p256 = {
   },
   {0},
   subgroups_prime,
-  NULL
+  NULL,
+  groups_p256
 };
 
 static const wei_def_t curve_p384 = {
@@ -9854,6 +10237,7 @@ static const wei_def_t curve_p384 = {
   },
   {0},
   subgroups_prime,
+  NULL,
   NULL
 };
 
@@ -9913,6 +10297,7 @@ static const wei_def_t curve_p521 = {
   },
   {0},
   subgroups_prime,
+  NULL,
   NULL
 };
 
@@ -9946,128 +10331,20 @@ static const wei_def_t curve_secp256k1 = {
   {
     0x48, 0x3a, 0xda, 0x77, 0x26, 0xa3, 0xc4, 0x65,
     0x5d, 0xa4, 0xfb, 0xfc, 0x0e, 0x11, 0x08, 0xa8,
-    0xfd, 0x17, 0xb4, 0x48, 0xa6, 0x85, 0x54, 0x19,
-    0x9c, 0x47, 0xd0, 0x8f, 0xfb, 0x10, 0xd4, 0xb8
-  },
-  /* Shallue-van de Woestijne constant (c). */
-  {
-    /* sqrt(-3) */
-    0x0a, 0x2d, 0x2b, 0xa9, 0x35, 0x07, 0xf1, 0xdf,
-    0x23, 0x37, 0x70, 0xc2, 0xa7, 0x97, 0x96, 0x2c,
-    0xc6, 0x1f, 0x6d, 0x15, 0xda, 0x14, 0xec, 0xd4,
-    0x7d, 0x8d, 0x27, 0xae, 0x1c, 0xd5, 0xf8, 0x52
-  },
-  subgroups_prime,
-  &endo_secp256k1
-};
-
-/*
- * Mont Curves
- */
-
-static const mont_def_t curve_x25519 = {
-  &field_p25519,
-  &field_q25519,
-  8,
-  2,
-  0,
-  /* Coefficients (A, B). */
-  {
-    /* 486662 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x06
-  },
-  {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
-  },
-  /* Base point coordinates (u, v). */
-  {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09
-  },
-  {
-    /* See: https://www.rfc-editor.org/errata/eid4730 */
-    0x5f, 0x51, 0xe6, 0x5e, 0x47, 0x5f, 0x79, 0x4b,
-    0x1f, 0xe1, 0x22, 0xd3, 0x88, 0xb7, 0x2e, 0xb3,
-    0x6d, 0xc2, 0xb2, 0x81, 0x92, 0x83, 0x9e, 0x4d,
-    0xd6, 0x16, 0x3a, 0x5d, 0x81, 0x31, 0x2c, 0x14
-  },
-  /* Isomorphism scaling factor (c). */
-  {
-    /* sqrt(-486664) */
-    /* See: https://github.com/cfrg/draft-irtf-cfrg-hash-to-curve/issues/206 */
-    0x0f, 0x26, 0xed, 0xf4, 0x60, 0xa0, 0x06, 0xbb,
-    0xd2, 0x7b, 0x08, 0xdc, 0x03, 0xfc, 0x4f, 0x7e,
-    0xc5, 0xa1, 0xd3, 0xd1, 0x4b, 0x7d, 0x1a, 0x82,
-    0xcc, 0x6e, 0x04, 0xaa, 0xff, 0x45, 0x7e, 0x06
-  },
-  subgroups_x25519
-};
-
-static const mont_def_t curve_x448 = {
-  &field_p448,
-  &field_q448,
-  4,
-  -1,
-  1,
-  /* Coefficients (A, B). */
-  {
-    /* 156326 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x62, 0xa6
-  },
-  {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
-  },
-  /* Base point coordinates (u, v). */
-  {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05
-  },
-  {
-    0x7d, 0x23, 0x5d, 0x12, 0x95, 0xf5, 0xb1, 0xf6,
-    0x6c, 0x98, 0xab, 0x6e, 0x58, 0x32, 0x6f, 0xce,
-    0xcb, 0xae, 0x5d, 0x34, 0xf5, 0x55, 0x45, 0xd0,
-    0x60, 0xf7, 0x5d, 0xc2, 0x8d, 0xf3, 0xf6, 0xed,
-    0xb8, 0x02, 0x7e, 0x23, 0x46, 0x43, 0x0d, 0x21,
-    0x13, 0x12, 0xc4, 0xb1, 0x50, 0x67, 0x7a, 0xf7,
-    0x6f, 0xd7, 0x22, 0x3d, 0x45, 0x7b, 0x5b, 0x1a
+    0xfd, 0x17, 0xb4, 0x48, 0xa6, 0x85, 0x54, 0x19,
+    0x9c, 0x47, 0xd0, 0x8f, 0xfb, 0x10, 0xd4, 0xb8
   },
-  /* Isomorphism scaling factor (c). */
+  /* Shallue-van de Woestijne constant (c). */
   {
-    /* IsoEd448 scaling factor. */
-    0x45, 0xb2, 0xc5, 0xf7, 0xd6, 0x49, 0xee, 0xd0,
-    0x77, 0xed, 0x1a, 0xe4, 0x5f, 0x44, 0xd5, 0x41,
-    0x43, 0xe3, 0x4f, 0x71, 0x4b, 0x71, 0xaa, 0x96,
-    0xc9, 0x45, 0xaf, 0x01, 0x2d, 0x18, 0x29, 0x75,
-    0x07, 0x34, 0xcd, 0xe9, 0xfa, 0xdd, 0xbd, 0xa4,
-    0xc0, 0x66, 0xf7, 0xed, 0x54, 0x41, 0x9c, 0xa5,
-    0x2c, 0x85, 0xde, 0x1e, 0x8a, 0xae, 0x4e, 0x6c
+    /* sqrt(-3) */
+    0x0a, 0x2d, 0x2b, 0xa9, 0x35, 0x07, 0xf1, 0xdf,
+    0x23, 0x37, 0x70, 0xc2, 0xa7, 0x97, 0x96, 0x2c,
+    0xc6, 0x1f, 0x6d, 0x15, 0xda, 0x14, 0xec, 0xd4,
+    0x7d, 0x8d, 0x27, 0xae, 0x1c, 0xd5, 0xf8, 0x52
   },
-  subgroups_x448
+  subgroups_prime,
+  &endo_secp256k1,
+  groups_secp256k1
 };
 
 /*
@@ -10122,7 +10399,8 @@ static const edwards_def_t curve_ed25519 = {
     0xcc, 0x6e, 0x04, 0xaa, 0xff, 0x45, 0x7e, 0x06
   },
   subgroups_ed25519,
-  &ristretto_ed25519
+  &ristretto_ed25519,
+  groups_ed25519
 };
 
 static const edwards_def_t curve_ed448 = {
@@ -10186,7 +10464,8 @@ static const edwards_def_t curve_ed448 = {
     0x4b, 0xf3, 0x8e, 0x82, 0xb0, 0xe1, 0xe0, 0x28
   },
   subgroups_ed448,
-  &ristretto_ed448
+  &ristretto_ed448,
+  groups_ed448
 };
 
 static const edwards_def_t curve_ed1174 = {
@@ -10235,7 +10514,121 @@ static const edwards_def_t curve_ed1174 = {
     0x82, 0x76, 0xac, 0xe6, 0xbb, 0xe7, 0xdf, 0xd2
   },
   subgroups_ed1174,
-  &ristretto_ed1174
+  &ristretto_ed1174,
+  NULL
+};
+
+/*
+ * Mont Curves
+ */
+
+static const mont_def_t curve_x25519 = {
+  &field_p25519,
+  &field_q25519,
+  8,
+  2,
+  0,
+  /* Coefficients (A, B). */
+  {
+    /* 486662 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x6d, 0x06
+  },
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+  },
+  /* Base point coordinates (u, v). */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09
+  },
+  {
+    /* See: https://www.rfc-editor.org/errata/eid4730 */
+    0x5f, 0x51, 0xe6, 0x5e, 0x47, 0x5f, 0x79, 0x4b,
+    0x1f, 0xe1, 0x22, 0xd3, 0x88, 0xb7, 0x2e, 0xb3,
+    0x6d, 0xc2, 0xb2, 0x81, 0x92, 0x83, 0x9e, 0x4d,
+    0xd6, 0x16, 0x3a, 0x5d, 0x81, 0x31, 0x2c, 0x14
+  },
+  /* Isomorphism scaling factor (c). */
+  {
+    /* sqrt(-486664) */
+    /* See: https://github.com/cfrg/draft-irtf-cfrg-hash-to-curve/issues/206 */
+    0x0f, 0x26, 0xed, 0xf4, 0x60, 0xa0, 0x06, 0xbb,
+    0xd2, 0x7b, 0x08, 0xdc, 0x03, 0xfc, 0x4f, 0x7e,
+    0xc5, 0xa1, 0xd3, 0xd1, 0x4b, 0x7d, 0x1a, 0x82,
+    0xcc, 0x6e, 0x04, 0xaa, 0xff, 0x45, 0x7e, 0x06
+  },
+  subgroups_x25519,
+  &curve_ed25519,
+  groups_x25519
+};
+
+static const mont_def_t curve_x448 = {
+  &field_p448,
+  &field_q448,
+  4,
+  -1,
+  1,
+  /* Coefficients (A, B). */
+  {
+    /* 156326 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x62, 0xa6
+  },
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+  },
+  /* Base point coordinates (u, v). */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05
+  },
+  {
+    0x7d, 0x23, 0x5d, 0x12, 0x95, 0xf5, 0xb1, 0xf6,
+    0x6c, 0x98, 0xab, 0x6e, 0x58, 0x32, 0x6f, 0xce,
+    0xcb, 0xae, 0x5d, 0x34, 0xf5, 0x55, 0x45, 0xd0,
+    0x60, 0xf7, 0x5d, 0xc2, 0x8d, 0xf3, 0xf6, 0xed,
+    0xb8, 0x02, 0x7e, 0x23, 0x46, 0x43, 0x0d, 0x21,
+    0x13, 0x12, 0xc4, 0xb1, 0x50, 0x67, 0x7a, 0xf7,
+    0x6f, 0xd7, 0x22, 0x3d, 0x45, 0x7b, 0x5b, 0x1a
+  },
+  /* Isomorphism scaling factor (c). */
+  {
+    /* IsoEd448 scaling factor. */
+    0x45, 0xb2, 0xc5, 0xf7, 0xd6, 0x49, 0xee, 0xd0,
+    0x77, 0xed, 0x1a, 0xe4, 0x5f, 0x44, 0xd5, 0x41,
+    0x43, 0xe3, 0x4f, 0x71, 0x4b, 0x71, 0xaa, 0x96,
+    0xc9, 0x45, 0xaf, 0x01, 0x2d, 0x18, 0x29, 0x75,
+    0x07, 0x34, 0xcd, 0xe9, 0xfa, 0xdd, 0xbd, 0xa4,
+    0xc0, 0x66, 0xf7, 0xed, 0x54, 0x41, 0x9c, 0xa5,
+    0x2c, 0x85, 0xde, 0x1e, 0x8a, 0xae, 0x4e, 0x6c
+  },
+  subgroups_x448,
+  &curve_ed448,
+  groups_x448
 };
 
 /*
@@ -10369,13 +10762,19 @@ mont_curve_create(mont_curve_id_t type) {
 
   mont_init(ec, mont_curves[type]);
 
+  ec->edwards = (edwards_t *)checked_malloc(sizeof(edwards_t));
+
+  edwards_init_fixed(ec->edwards, mont_curves[type]->edwards);
+
   return ec;
 }
 
 void
 mont_curve_destroy(mont_t *ec) {
-  if (ec != NULL)
+  if (ec != NULL) {
+    free(ec->edwards);
     free(ec);
+  }
 }
 
 size_t
@@ -10421,6 +10820,7 @@ edwards_curve_destroy(edwards_t *ec) {
   if (ec != NULL) {
     sc_cleanse(&ec->sc, ec->blind);
     xge_cleanse(ec, &ec->unblind);
+    free(ec->wnd_naf);
     free(ec);
   }
 }
@@ -10842,6 +11242,67 @@ ecdsa_pubkey_tweak_add(const wei_t *ec,
   return ret;
 }
 
+int
+ecdsa_pubkey_tweak_add_batch(const wei_t *ec,
+                             unsigned char *const *outs,
+                             size_t *out_lens,
+                             const unsigned char *const *pubs,
+                             const size_t *pub_lens,
+                             const unsigned char *const *tweaks,
+                             int *results,
+                             size_t len,
+                             int compact) {
+  /* Identical to `ecdsa_pubkey_tweak_add`, but the
+   * affine conversions are shared across WEI_BATCH
+   * items at a time with Montgomery's trick.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  jge_t points[WEI_BATCH];
+  wge_t out[WEI_BATCH];
+  int oks[WEI_BATCH];
+  size_t i, j, n;
+  int ret = 1;
+  wge_t A;
+  sc_t t;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, WEI_BATCH);
+
+    for (j = 0; j < n; j++) {
+      oks[j] = wge_import(ec, &A, pubs[i + j], pub_lens[i + j]);
+      oks[j] &= sc_import(sc, t, tweaks[i + j]);
+
+      wei_jmul_g(ec, &points[j], t);
+
+      jge_mixed_add(ec, &points[j], &points[j], &A);
+    }
+
+    wge_set_jge_all(ec, out, points, n);
+
+    for (j = 0; j < n; j++) {
+      size_t *out_len = out_lens != NULL ? &out_lens[i + j] : NULL;
+
+      oks[j] &= wge_export(ec, outs[i + j], out_len, &out[j], compact);
+
+      if (results != NULL)
+        results[i + j] = oks[j];
+
+      ret &= oks[j];
+    }
+  }
+
+  sc_cleanse(sc, t);
+
+  wge_cleanse(ec, &A);
+
+  for (j = 0; j < WEI_BATCH; j++) {
+    jge_cleanse(ec, &points[j]);
+    wge_cleanse(ec, &out[j]);
+  }
+
+  return ret;
+}
+
 int
 ecdsa_pubkey_tweak_mul(const wei_t *ec,
                        unsigned char *out,
@@ -11257,6 +11718,198 @@ ecdsa_sign_internal(const wei_t *ec,
   return ret;
 }
 
+ecdsa__presign_t *
+ecdsa_presign_create(const wei_t *ec,
+                     size_t size,
+                     const unsigned char *entropy) {
+  ecdsa__presign_t *pool =
+    (ecdsa__presign_t *)checked_malloc(sizeof(ecdsa__presign_t));
+
+  (void)ec;
+
+  pool->size = size;
+  pool->length = 0;
+  pool->items = (ecdsa_nonce_t *)checked_malloc(size * sizeof(ecdsa_nonce_t));
+
+  drbg_init(&pool->rng, HASH_SHA256, entropy, ENTROPY_SIZE);
+
+  return pool;
+}
+
+void
+ecdsa_presign_destroy(const wei_t *ec, ecdsa__presign_t *pool) {
+  (void)ec;
+
+  if (pool != NULL) {
+    cleanse(pool->items, pool->size * sizeof(ecdsa_nonce_t));
+    cleanse(&pool->rng, sizeof(pool->rng));
+    free(pool->items);
+    free(pool);
+  }
+}
+
+size_t
+ecdsa_presign_fill(const wei_t *ec, ecdsa__presign_t *pool, size_t n) {
+  /* Offline phase of ECDSA signing.
+   *
+   * Computation:
+   *
+   *   k = random integer in [1,n-1]
+   *   R = G * k
+   *   r = x(R) mod n
+   *   t = 1 / k mod n
+   *
+   * Nonces are drawn from the pool's DRBG rather
+   * than RFC6979, as the message is not yet known.
+   *
+   * Both the scalar and the field inversions are
+   * shared across a batch with Montgomery's trick.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  sc_t ks[ECDSA_PRESIGN_BATCH];
+  sc_t ts[ECDSA_PRESIGN_BATCH];
+  fe_t zs[ECDSA_PRESIGN_BATCH];
+  jge_t Rs[ECDSA_PRESIGN_BATCH];
+  unsigned int sign, high;
+  size_t i, len;
+  sc_t sacc, r;
+  fe_t facc, a, aa, x, y;
+
+  if (n > pool->size - pool->length)
+    n = pool->size - pool->length;
+
+  while (n > 0) {
+    len = ECC_MIN(n, ECDSA_PRESIGN_BATCH);
+
+    sc_set(sc, sacc, sc_one);
+    fe_set(fe, facc, fe->one);
+
+    for (i = 0; i < len; i++) {
+      sc_random(sc, ks[i], &pool->rng);
+
+      wei_jmul_g(ec, &Rs[i], ks[i]);
+
+      sc_set(sc, ts[i], sacc);
+      sc_mul(sc, sacc, sacc, ks[i]);
+
+      fe_set(fe, zs[i], facc);
+      fe_mul(fe, facc, facc, Rs[i].z);
+    }
+
+    ASSERT(sc_invert(sc, sacc, sacc));
+    ASSERT(fe_invert(fe, facc, facc));
+
+    for (i = len - 1; i != (size_t)-1; i--) {
+      sc_mul(sc, ts[i], ts[i], sacc);
+      sc_mul(sc, sacc, sacc, ks[i]);
+
+      fe_mul(fe, zs[i], zs[i], facc);
+      fe_mul(fe, facc, facc, Rs[i].z);
+    }
+
+    for (i = 0; i < len; i++) {
+      ecdsa_nonce_t *item = &pool->items[pool->length];
+
+      fe_sqr(fe, aa, zs[i]);
+      fe_mul(fe, a, aa, zs[i]);
+      fe_mul(fe, x, Rs[i].x, aa);
+      fe_mul(fe, y, Rs[i].y, a);
+
+      sign = fe_is_odd(fe, y);
+      high = sc_set_fe(sc, fe, r, x) ^ 1;
+
+      /* Negligible, but r is public anyway. */
+      if (UNLIKELY(sc_is_zero(sc, r)))
+        continue;
+
+      sc_set(sc, item->kinv, ts[i]);
+      sc_set(sc, item->r, r);
+
+      item->param = (high << 1) | sign;
+
+      pool->length += 1;
+    }
+
+    n -= len;
+  }
+
+  cleanse(ks, sizeof(ks));
+  cleanse(ts, sizeof(ts));
+  cleanse(zs, sizeof(zs));
+  cleanse(Rs, sizeof(Rs));
+
+  sc_cleanse(sc, sacc);
+  sc_cleanse(sc, r);
+
+  fe_cleanse(fe, facc);
+  fe_cleanse(fe, a);
+  fe_cleanse(fe, aa);
+  fe_cleanse(fe, x);
+  fe_cleanse(fe, y);
+
+  return pool->length;
+}
+
+int
+ecdsa_sign_presigned(const wei_t *ec,
+                     unsigned char *sig,
+                     unsigned int *param,
+                     const unsigned char *msg,
+                     size_t msg_len,
+                     const unsigned char *priv,
+                     ecdsa__presign_t *pool) {
+  /* Online phase of ECDSA signing.
+   *
+   * Computation:
+   *
+   *   s = (r * a + m) * t mod n
+   *   s = -s mod n, if s > n / 2
+   *   S = (r, s)
+   *
+   * The nonce is popped from the pool and
+   * cleansed, so it is never used twice.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  ecdsa_nonce_t *item;
+  unsigned int sign, high;
+  sc_t a, m, s;
+  int ret = 1;
+
+  if (pool->length == 0)
+    return 0;
+
+  item = &pool->items[--pool->length];
+
+  ret &= sc_import(sc, a, priv);
+  ret &= sc_is_zero(sc, a) ^ 1;
+
+  ecdsa_reduce(ec, m, msg, msg_len);
+
+  sc_mul(sc, s, item->r, a);
+  sc_add(sc, s, s, m);
+  sc_mul(sc, s, s, item->kinv);
+
+  sign = item->param & 1;
+  high = item->param >> 1;
+
+  sign ^= sc_minimize(sc, s, s);
+
+  sc_export(sc, sig, item->r);
+  sc_export(sc, sig + sc->size, s);
+
+  if (param != NULL)
+    *param = (high << 1) | sign;
+
+  cleanse(item, sizeof(*item));
+
+  sc_cleanse(sc, a);
+  sc_cleanse(sc, m);
+  sc_cleanse(sc, s);
+
+  return ret;
+}
+
 int
 ecdsa_verify(const wei_t *ec,
              const unsigned char *msg,
@@ -11340,6 +11993,47 @@ ecdsa_verify(const wei_t *ec,
   return sc_equal(sc, x, r);
 }
 
+static int
+ecdsa_recover_r(const wei_t *ec,
+                wge_t *R,
+                sc_t r,
+                sc_t s,
+                const unsigned char *sig,
+                unsigned int param) {
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  unsigned int sign = param & 1;
+  unsigned int high = param >> 1;
+  fe_t x;
+
+  if (!sc_import(sc, r, sig))
+    return 0;
+
+  if (!sc_import(sc, s, sig + sc->size))
+    return 0;
+
+  if (sc_is_zero(sc, r) || sc_is_zero(sc, s))
+    return 0;
+
+  if (sc_is_high_var(sc, s))
+    return 0;
+
+  if (!fe_set_sc(fe, sc, x, r))
+    return 0;
+
+  if (high) {
+    if (ec->high_order)
+      return 0;
+
+    if (sc_cmp_var(sc, r, ec->sc_p) >= 0)
+      return 0;
+
+    fe_add(fe, x, x, ec->fe_n);
+  }
+
+  return wge_set_x(ec, R, x, sign);
+}
+
 int
 ecdsa_recover(const wei_t *ec,
               unsigned char *pub,
@@ -11378,42 +12072,13 @@ ecdsa_recover(const wei_t *ec,
    * Note that this implementation will have
    * trouble on curves where `p / n > 1`.
    */
-  const prime_field_t *fe = &ec->fe;
   const scalar_field_t *sc = &ec->sc;
-  unsigned int sign = param & 1;
-  unsigned int high = param >> 1;
   sc_t m, r, s, s1, s2;
   wge_t R, A;
-  fe_t x;
 
   wge_zero(ec, &A);
 
-  if (!sc_import(sc, r, sig))
-    goto fail;
-
-  if (!sc_import(sc, s, sig + sc->size))
-    goto fail;
-
-  if (sc_is_zero(sc, r) || sc_is_zero(sc, s))
-    goto fail;
-
-  if (sc_is_high_var(sc, s))
-    goto fail;
-
-  if (!fe_set_sc(fe, sc, x, r))
-    goto fail;
-
-  if (high) {
-    if (ec->high_order)
-      goto fail;
-
-    if (sc_cmp_var(sc, r, ec->sc_p) >= 0)
-      goto fail;
-
-    fe_add(fe, x, x, ec->fe_n);
-  }
-
-  if (!wge_set_x(ec, &R, x, sign))
+  if (!ecdsa_recover_r(ec, &R, r, s, sig, param))
     goto fail;
 
   ecdsa_reduce(ec, m, msg, msg_len);
@@ -11430,6 +12095,85 @@ fail:
   return wge_export(ec, pub, pub_len, &A, compact);
 }
 
+int
+ecdsa_recover_batch(const wei_t *ec,
+                    unsigned char *const *pubs,
+                    size_t *pub_lens,
+                    const unsigned char *const *msgs,
+                    const size_t *msg_lens,
+                    const unsigned char *const *sigs,
+                    const unsigned int *params,
+                    int *results,
+                    size_t len,
+                    int compact) {
+  /* Identical to `ecdsa_recover`, but the
+   * inversions of `r` and the final affine
+   * conversions are each shared across
+   * WEI_BATCH items with Montgomery's trick.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  sc_t rs[WEI_BATCH], ss[WEI_BATCH], ts[WEI_BATCH];
+  wge_t Rs[WEI_BATCH], As[WEI_BATCH];
+  jge_t Js[WEI_BATCH];
+  int oks[WEI_BATCH];
+  sc_t m, acc, s1, s2;
+  size_t i, j, n;
+  int ret = 1;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, WEI_BATCH);
+
+    sc_set(sc, acc, sc_one);
+
+    for (j = 0; j < n; j++) {
+      oks[j] = ecdsa_recover_r(ec, &Rs[j], rs[j], ss[j],
+                               sigs[i + j], params[i + j]);
+
+      if (!oks[j])
+        sc_set(sc, rs[j], sc_one);
+
+      sc_set(sc, ts[j], acc);
+      sc_mul(sc, acc, acc, rs[j]);
+    }
+
+    ASSERT(sc_invert_var(sc, acc, acc));
+
+    for (j = n - 1; j != (size_t)-1; j--) {
+      sc_mul(sc, ts[j], ts[j], acc);
+      sc_mul(sc, acc, acc, rs[j]);
+    }
+
+    for (j = 0; j < n; j++) {
+      if (!oks[j]) {
+        jge_zero(ec, &Js[j]);
+        continue;
+      }
+
+      ecdsa_reduce(ec, m, msgs[i + j], msg_lens[i + j]);
+
+      sc_mul(sc, s1, m, ts[j]);
+      sc_mul(sc, s2, ss[j], ts[j]);
+      sc_neg(sc, s1, s1);
+
+      wei_jmul_double_var(ec, &Js[j], s1, &Rs[j], s2);
+    }
+
+    wge_set_jge_all_var(ec, As, Js, n);
+
+    for (j = 0; j < n; j++) {
+      size_t *pub_len = pub_lens != NULL ? &pub_lens[i + j] : NULL;
+      int ok = wge_export(ec, pubs[i + j], pub_len, &As[j], compact);
+
+      if (results != NULL)
+        results[i + j] = ok;
+
+      ret &= ok;
+    }
+  }
+
+  return ret;
+}
+
 int
 ecdsa_derive(const wei_t *ec,
              unsigned char *secret,
@@ -12119,6 +12863,66 @@ bip340_pubkey_tweak_add(const wei_t *ec,
   return ret;
 }
 
+int
+bip340_pubkey_tweak_add_batch(const wei_t *ec,
+                              unsigned char *const *outs,
+                              int *negated,
+                              const unsigned char *const *pubs,
+                              const unsigned char *const *tweaks,
+                              int *results,
+                              size_t len) {
+  /* Identical to `bip340_pubkey_tweak_add`, but the
+   * affine conversions are shared across WEI_BATCH
+   * items at a time with Montgomery's trick.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  jge_t points[WEI_BATCH];
+  wge_t out[WEI_BATCH];
+  int oks[WEI_BATCH];
+  size_t i, j, n;
+  int ret = 1;
+  wge_t A;
+  sc_t t;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, WEI_BATCH);
+
+    for (j = 0; j < n; j++) {
+      oks[j] = wge_import_even(ec, &A, pubs[i + j]);
+      oks[j] &= sc_import(sc, t, tweaks[i + j]);
+
+      wei_jmul_g(ec, &points[j], t);
+
+      jge_mixed_add(ec, &points[j], &points[j], &A);
+    }
+
+    wge_set_jge_all(ec, out, points, n);
+
+    for (j = 0; j < n; j++) {
+      oks[j] &= wge_export_x(ec, outs[i + j], &out[j]);
+
+      if (negated != NULL)
+        negated[i + j] = wge_is_even(ec, &out[j]) ^ 1;
+
+      if (results != NULL)
+        results[i + j] = oks[j];
+
+      ret &= oks[j];
+    }
+  }
+
+  sc_cleanse(sc, t);
+
+  wge_cleanse(ec, &A);
+
+  for (j = 0; j < WEI_BATCH; j++) {
+    jge_cleanse(ec, &points[j]);
+    wge_cleanse(ec, &out[j]);
+  }
+
+  return ret;
+}
+
 int
 bip340_pubkey_tweak_add_check(const wei_t *ec,
                               const unsigned char *pub,
@@ -12137,6 +12941,144 @@ bip340_pubkey_tweak_add_check(const wei_t *ec,
   return ret;
 }
 
+int
+bip340_pubkey_tweak_check_batch(const wei_t *ec,
+                                const unsigned char *const *pubs,
+                                const unsigned char *const *tweaks,
+                                const unsigned char *const *expects,
+                                const int *negated,
+                                size_t len,
+                                wei__scratch_t *scratch) {
+  /* BIP341 Batch Tweak Verification.
+   *
+   * [BIP341] "Script validation rules".
+   *
+   * Assumptions:
+   *
+   *   - Let `x` and `q` be field elements.
+   *   - Let `t` be a scalar.
+   *   - Let `i` be the batch item index.
+   *   - x^3 + a * x + b is square in F(p).
+   *   - q^3 + a * q + b is square in F(p).
+   *   - x < p, q < p, t < n.
+   *   - a1 = 1 mod n.
+   *
+   * Computation:
+   *
+   *   Pi = (xi, sqrt(xi^3 + a * xi + b)), even
+   *   Qi = (qi, sqrt(qi^3 + a * qi + b)), odd if negated
+   *   Di = Qi - Pi
+   *   ai = random integer in [1,n-1]
+   *   lhs = ti * ai + ... mod n
+   *   rhs = Di * ai + ...
+   *   G * -lhs + rhs == O
+   *
+   * The differences are normalized WEI_BATCH
+   * at a time with a single inversion, leaving
+   * one point per item for the multiplication.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  wge_t *points = scratch->points;
+  sc_t *coeffs = scratch->coeffs;
+  jge_t diffs[WEI_BATCH];
+  sc_t sum, t, a;
+  drbg_t rng;
+  wge_t P, Q;
+  jge_t r;
+  fe_t x;
+  size_t j = 0;
+  size_t k = 0;
+  size_t i;
+
+  CHECK(scratch->size >= 1);
+
+  /* Seed RNG. */
+  {
+    unsigned char bytes[32];
+    sha256_t outer;
+
+    sha256_init(&outer);
+
+    for (i = 0; i < len; i++) {
+      bytes[0] = (negated[i] != 0);
+
+      sha256_update(&outer, pubs[i], fe->size);
+      sha256_update(&outer, tweaks[i], sc->size);
+      sha256_update(&outer, expects[i], fe->size);
+      sha256_update(&outer, bytes, 1);
+    }
+
+    sha256_final(&outer, bytes);
+
+    drbg_init(&rng, HASH_SHA256, bytes, 32);
+  }
+
+  /* Intialize sum. */
+  sc_zero(sc, sum);
+
+  /* Verify tweaks. */
+  for (i = 0; i < len; i++) {
+    if (!sc_import(sc, t, tweaks[i]))
+      return 0;
+
+    if (!wge_import_even(ec, &P, pubs[i]))
+      return 0;
+
+    if (!fe_import(fe, x, expects[i]))
+      return 0;
+
+    if (!wge_set_x(ec, &Q, x, negated[i] != 0))
+      return 0;
+
+    if (j + k == 0)
+      sc_set_word(sc, a, 1);
+    else
+      sc_random(sc, a, &rng);
+
+    sc_mul(sc, t, t, a);
+    sc_add(sc, sum, sum, t);
+
+    jge_set_wge(ec, &diffs[k], &Q);
+    jge_mixed_sub_var(ec, &diffs[k], &diffs[k], &P);
+
+    sc_set(sc, coeffs[j + k], a);
+
+    k += 1;
+
+    if (k == WEI_BATCH || j + k == scratch->size || i == len - 1) {
+      wge_set_jge_all_var(ec, &points[j], diffs, k);
+
+      j += k;
+      k = 0;
+    }
+
+    if (j == scratch->size) {
+      sc_neg(sc, sum, sum);
+
+      wei_jmul_multi_var(ec, &r, sum, points, (const sc_t *)coeffs, j, scratch);
+
+      if (!jge_is_zero(ec, &r))
+        return 0;
+
+      sc_zero(sc, sum);
+
+      j = 0;
+    }
+  }
+
+  if (j > 0) {
+    sc_neg(sc, sum, sum);
+
+    wei_jmul_multi_var(ec, &r, sum, points, (const sc_t *)coeffs, j, scratch);
+
+    if (!jge_is_zero(ec, &r))
+      return 0;
+  }
+
+  return 1;
+}
+
 int
 bip340_pubkey_tweak_mul(const wei_t *ec,
                         unsigned char *out,
@@ -12792,7 +13734,7 @@ ecdh_pubkey_create(const mont_t *ec,
 
   mont_clamp(ec, clamped, priv);
 
-  sc_import_raw(sc, a, clamped);
+  sc_import_reduce(sc, a, clamped);
 
   mont_mul_g(ec, &A, a);
 
@@ -13019,6 +13961,104 @@ ecdh_derive(const mont_t *ec,
   return ret;
 }
 
+#if defined(P25519_HAVE_AVX2)
+static void
+ecdh_derive_x4(const mont_t *ec,
+               pge_t *points,
+               const unsigned char *const *pubs,
+               const unsigned char *const *privs,
+               size_t len) {
+  /* Runs the ladders four at a time in AVX2 lanes.
+     A short final group repeats its first input. */
+  unsigned char clamped[4][MAX_SCALAR_SIZE];
+  const p25519_fe_word_t *us[4];
+  const unsigned char *ks[4];
+  p25519_fe_word_t *xs[4];
+  p25519_fe_word_t *zs[4];
+  pge_t pad[4];
+  size_t i, j, k;
+  pge_t *p;
+
+  for (i = 0; i < len; i += 4) {
+    for (j = 0; j < 4; j++) {
+      k = (i + j < len) ? i + j : i;
+      p = (i + j < len) ? &points[i + j] : &pad[j];
+
+      mont_clamp(ec, clamped[j], privs[k]);
+
+      pge_import_unsafe(ec, p, pubs[k]);
+
+      us[j] = p->x;
+      ks[j] = clamped[j];
+      xs[j] = p->x;
+      zs[j] = p->z;
+    }
+
+    p25519x4_ladder(xs, zs, us, ks);
+  }
+
+  for (j = 0; j < 4; j++)
+    pge_cleanse(ec, &pad[j]);
+
+  cleanse(clamped, sizeof(clamped));
+}
+#endif
+
+int
+ecdh_derive_batch(const mont_t *ec,
+                  unsigned char *const *secrets,
+                  const unsigned char *const *pubs,
+                  const unsigned char *const *privs,
+                  size_t len) {
+  /* Each ladder is identical to `ecdh_derive`. The
+   * final inversions are shared across MONT_BATCH
+   * items at a time with Montgomery's trick. X25519
+   * runs four ladders at once when AVX2 is present.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  unsigned char clamped[MAX_SCALAR_SIZE];
+  pge_t points[MONT_BATCH];
+  size_t i, j, n;
+  int ret = 1;
+  pge_t A;
+  sc_t a;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, MONT_BATCH);
+
+#if defined(P25519_HAVE_AVX2)
+    if (ec->fe.mul == fiat_p25519_carry_mul && torsion_has_avx2()) {
+      ecdh_derive_x4(ec, points, pubs + i, privs + i, n);
+      ret &= pge_export_all(ec, secrets + i, points, n);
+      continue;
+    }
+#endif
+
+    for (j = 0; j < n; j++) {
+      mont_clamp(ec, clamped, privs[i + j]);
+
+      sc_import_raw(sc, a, clamped);
+
+      pge_import_unsafe(ec, &A, pubs[i + j]);
+
+      mont_mul(ec, &points[j], &A, a, 1);
+    }
+
+    ret &= pge_export_all(ec, secrets + i, points, n);
+  }
+
+  sc_cleanse(sc, a);
+
+  pge_cleanse(ec, &A);
+
+  for (j = 0; j < MONT_BATCH; j++)
+    pge_cleanse(ec, &points[j]);
+
+  cleanse(clamped, sc->size);
+
+  return ret;
+}
+
 /*
  * EdDSA
  */
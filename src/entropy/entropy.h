@@ -21,6 +21,8 @@
 #define torsion_cpuid torsion__cpuid
 #define torsion_has_rdrand torsion__has_rdrand
 #define torsion_has_rdseed torsion__has_rdseed
+#define torsion_has_adx torsion__has_adx
+#define torsion_has_avx2 torsion__has_avx2
 #define torsion_rdrand torsion__rdrand
 #define torsion_rdseed torsion__rdseed
 #define torsion_hwrand torsion__hwrand
@@ -57,6 +59,12 @@ torsion_has_rdrand(void);
 int
 torsion_has_rdseed(void);
 
+int
+torsion_has_adx(void);
+
+int
+torsion_has_avx2(void);
+
 uint64_t
 torsion_rdrand(void);
 
@@ -658,6 +658,82 @@ torsion_has_rdseed(void) {
 #endif
 }
 
+int
+torsion_has_adx(void) {
+#if defined(HAVE_CPUIDEX) || defined(HAVE_ASM_INTEL)
+  /* Racing threads all store the same value. */
+  static volatile int has_adx = -1;
+  uint32_t eax, ebx, ecx, edx;
+
+  if (has_adx >= 0)
+    return has_adx;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 0, 0);
+
+  if (eax < 7) {
+    has_adx = 0;
+    return 0;
+  }
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 7, 0);
+
+  /* Bit 8 = BMI2 (MULX), bit 19 = ADX (ADCX/ADOX). */
+  has_adx = ((ebx >> 8) & (ebx >> 19)) & 1;
+
+  return has_adx;
+#else
+  return 0;
+#endif
+}
+
+int
+torsion_has_avx2(void) {
+#if defined(HAVE_ASM_INTEL)
+  /* Only GCC-style builds carry AVX2 code. */
+  static volatile int has_avx2 = -1;
+  uint32_t eax, ebx, ecx, edx;
+
+  if (has_avx2 >= 0)
+    return has_avx2;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 0, 0);
+
+  if (eax < 7) {
+    has_avx2 = 0;
+    return 0;
+  }
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 1, 0);
+
+  /* Bit 27 = OSXSAVE, bit 28 = AVX. */
+  if (((ecx >> 27) & (ecx >> 28) & 1) == 0) {
+    has_avx2 = 0;
+    return 0;
+  }
+
+  /* The OS must save the XMM and YMM state (XCR0). */
+  __asm__ __volatile__ (
+    ".byte 0x0f, 0x01, 0xd0\n" /* xgetbv */
+    : "=a" (eax), "=d" (edx)
+    : "c" (0)
+  );
+
+  if ((eax & 6) != 6) {
+    has_avx2 = 0;
+    return 0;
+  }
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 7, 0);
+
+  /* Bit 5 = AVX2. */
+  has_avx2 = (ebx >> 5) & 1;
+
+  return has_avx2;
+#else
+  return 0;
+#endif
+}
+
 uint64_t
 torsion_rdrand(void) {
 #if defined(HAVE_RDRAND32)
@@ -252,3 +252,5 @@ p25519_fe_isqrt(p25519_fe_t z, const p25519_fe_t u, const p25519_fe_t v) {
 
   return css | fss;
 }
+
+#include "p25519_avx2.h"
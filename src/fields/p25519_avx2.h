@@ -0,0 +1,623 @@
+/*!
+ * p25519_avx2.h - 4-way p25519 field element for libtorsion
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/libtorsion
+ *
+ * Four field elements are held side by side, one per
+ * 64-bit AVX2 lane, as ten limbs alternating between
+ * 26 and 25 bits (radix 2^25.5, as in ref10). Every
+ * lane runs the same instructions, so four ladders
+ * advance in lockstep without branching on secrets.
+ */
+
+#if defined(TORSION_HAVE_ASM_X64) && P25519_FIELD_WORDS == 5 \
+ && (TORSION_GNUC_PREREQ(4, 9) || defined(__clang__))
+#define P25519_HAVE_AVX2
+
+#include <immintrin.h>
+
+#define P25519X4_TARGET __attribute__((target("avx2")))
+
+#define P25519X4_MAC(h, x, y) \
+  (h) = _mm256_add_epi64(h, _mm256_mul_epu32(x, y))
+
+typedef __m256i p25519x4_fe_t[10];
+
+P25519X4_TARGET static void
+p25519x4_fe_load(p25519x4_fe_t z, const p25519_fe_word_t **xs) {
+  /* Split each 51-bit limb into 26 and 25 bits. */
+  const __m256i mask = _mm256_set1_epi64x(0x3ffffff);
+  __m256i w;
+  int i;
+
+  for (i = 0; i < 5; i++) {
+    w = _mm256_set_epi64x(xs[3][i], xs[2][i], xs[1][i], xs[0][i]);
+
+    z[2 * i + 0] = _mm256_and_si256(w, mask);
+    z[2 * i + 1] = _mm256_srli_epi64(w, 26);
+  }
+}
+
+P25519X4_TARGET static void
+p25519x4_fe_carry(p25519x4_fe_t z, __m256i *h) {
+  /* Limbs may be as large as 2^63 on entry. */
+  const __m256i mask26 = _mm256_set1_epi64x(0x3ffffff);
+  const __m256i mask25 = _mm256_set1_epi64x(0x1ffffff);
+  __m256i c;
+
+#define P25519X4_CARRY(i, bits) do {                  \
+  c = _mm256_srli_epi64(h[i], bits);                  \
+  h[(i) + 1] = _mm256_add_epi64(h[(i) + 1], c);       \
+  h[i] = _mm256_and_si256(h[i], mask ## bits);        \
+} while (0)
+
+  P25519X4_CARRY(0, 26);
+  P25519X4_CARRY(4, 26);
+  P25519X4_CARRY(1, 25);
+  P25519X4_CARRY(5, 25);
+  P25519X4_CARRY(2, 26);
+  P25519X4_CARRY(6, 26);
+  P25519X4_CARRY(3, 25);
+  P25519X4_CARRY(7, 25);
+  P25519X4_CARRY(4, 26);
+  P25519X4_CARRY(8, 26);
+
+  /* h0 += 19 * (h9 >> 25) (the carry may exceed 32 bits). */
+  c = _mm256_srli_epi64(h[9], 25);
+  h[9] = _mm256_and_si256(h[9], mask25);
+  h[0] = _mm256_add_epi64(h[0], c);
+  h[0] = _mm256_add_epi64(h[0], _mm256_slli_epi64(c, 1));
+  h[0] = _mm256_add_epi64(h[0], _mm256_slli_epi64(c, 4));
+
+  P25519X4_CARRY(0, 26);
+
+#undef P25519X4_CARRY
+
+  z[0] = h[0];
+  z[1] = h[1];
+  z[2] = h[2];
+  z[3] = h[3];
+  z[4] = h[4];
+  z[5] = h[5];
+  z[6] = h[6];
+  z[7] = h[7];
+  z[8] = h[8];
+  z[9] = h[9];
+}
+
+P25519X4_TARGET static void
+p25519x4_fe_store(p25519_fe_word_t **zs, const p25519x4_fe_t x) {
+  uint64_t w[4];
+  __m256i h[10];
+  int i, j;
+
+  for (i = 0; i < 10; i++)
+    h[i] = x[i];
+
+  p25519x4_fe_carry(h, h);
+
+  for (i = 0; i < 5; i++) {
+    h[i] = _mm256_add_epi64(h[2 * i], _mm256_slli_epi64(h[2 * i + 1], 26));
+
+    _mm256_storeu_si256((__m256i *)w, h[i]);
+
+    for (j = 0; j < 4; j++)
+      zs[j][i] = w[j];
+  }
+
+  for (j = 0; j < 4; j++)
+    fiat_p25519_carry(zs[j], zs[j]);
+
+  cleanse(w, sizeof(w));
+  cleanse(h, sizeof(h));
+}
+
+P25519X4_TARGET static void
+p25519x4_fe_add(p25519x4_fe_t z, const p25519x4_fe_t x, const p25519x4_fe_t y) {
+  int i;
+
+  for (i = 0; i < 10; i++)
+    z[i] = _mm256_add_epi64(x[i], y[i]);
+}
+
+P25519X4_TARGET static void
+p25519x4_fe_sub(p25519x4_fe_t z, const p25519x4_fe_t x, const p25519x4_fe_t y) {
+  /* z = x + 2 * p - y (y must be carried). */
+  const __m256i p0 = _mm256_set1_epi64x(0x7ffffda);
+  const __m256i p1 = _mm256_set1_epi64x(0x3fffffe);
+  const __m256i p2 = _mm256_set1_epi64x(0x7fffffe);
+  int i;
+
+  z[0] = _mm256_add_epi64(x[0], _mm256_sub_epi64(p0, y[0]));
+
+  for (i = 1; i < 10; i++) {
+    z[i] = _mm256_add_epi64(x[i], _mm256_sub_epi64((i & 1) ? p1 : p2, y[i]));
+  }
+}
+
+P25519X4_TARGET static void
+p25519x4_fe_mul(p25519x4_fe_t z, const p25519x4_fe_t x, const p25519x4_fe_t y) {
+  /* Limbs must stay below 3 * 2^26 so that 19 * y
+     fits in 32 bits and the sums stay below 2^63. */
+  const __m256i nineteen = _mm256_set1_epi64x(19);
+  __m256i x2[10], y19[10], h[10];
+  int i;
+
+  for (i = 1; i < 10; i += 2)
+    x2[i] = _mm256_add_epi64(x[i], x[i]);
+
+  for (i = 1; i < 10; i++)
+    y19[i] = _mm256_mul_epu32(y[i], nineteen);
+
+  h[0] = _mm256_mul_epu32(x[0], y[0]);
+  P25519X4_MAC(h[0], x2[1], y19[9]);
+  P25519X4_MAC(h[0], x[2], y19[8]);
+  P25519X4_MAC(h[0], x2[3], y19[7]);
+  P25519X4_MAC(h[0], x[4], y19[6]);
+  P25519X4_MAC(h[0], x2[5], y19[5]);
+  P25519X4_MAC(h[0], x[6], y19[4]);
+  P25519X4_MAC(h[0], x2[7], y19[3]);
+  P25519X4_MAC(h[0], x[8], y19[2]);
+  P25519X4_MAC(h[0], x2[9], y19[1]);
+
+  h[1] = _mm256_mul_epu32(x[0], y[1]);
+  P25519X4_MAC(h[1], x[1], y[0]);
+  P25519X4_MAC(h[1], x[2], y19[9]);
+  P25519X4_MAC(h[1], x[3], y19[8]);
+  P25519X4_MAC(h[1], x[4], y19[7]);
+  P25519X4_MAC(h[1], x[5], y19[6]);
+  P25519X4_MAC(h[1], x[6], y19[5]);
+  P25519X4_MAC(h[1], x[7], y19[4]);
+  P25519X4_MAC(h[1], x[8], y19[3]);
+  P25519X4_MAC(h[1], x[9], y19[2]);
+
+  h[2] = _mm256_mul_epu32(x[0], y[2]);
+  P25519X4_MAC(h[2], x2[1], y[1]);
+  P25519X4_MAC(h[2], x[2], y[0]);
+  P25519X4_MAC(h[2], x2[3], y19[9]);
+  P25519X4_MAC(h[2], x[4], y19[8]);
+  P25519X4_MAC(h[2], x2[5], y19[7]);
+  P25519X4_MAC(h[2], x[6], y19[6]);
+  P25519X4_MAC(h[2], x2[7], y19[5]);
+  P25519X4_MAC(h[2], x[8], y19[4]);
+  P25519X4_MAC(h[2], x2[9], y19[3]);
+
+  h[3] = _mm256_mul_epu32(x[0], y[3]);
+  P25519X4_MAC(h[3], x[1], y[2]);
+  P25519X4_MAC(h[3], x[2], y[1]);
+  P25519X4_MAC(h[3], x[3], y[0]);
+  P25519X4_MAC(h[3], x[4], y19[9]);
+  P25519X4_MAC(h[3], x[5], y19[8]);
+  P25519X4_MAC(h[3], x[6], y19[7]);
+  P25519X4_MAC(h[3], x[7], y19[6]);
+  P25519X4_MAC(h[3], x[8], y19[5]);
+  P25519X4_MAC(h[3], x[9], y19[4]);
+
+  h[4] = _mm256_mul_epu32(x[0], y[4]);
+  P25519X4_MAC(h[4], x2[1], y[3]);
+  P25519X4_MAC(h[4], x[2], y[2]);
+  P25519X4_MAC(h[4], x2[3], y[1]);
+  P25519X4_MAC(h[4], x[4], y[0]);
+  P25519X4_MAC(h[4], x2[5], y19[9]);
+  P25519X4_MAC(h[4], x[6], y19[8]);
+  P25519X4_MAC(h[4], x2[7], y19[7]);
+  P25519X4_MAC(h[4], x[8], y19[6]);
+  P25519X4_MAC(h[4], x2[9], y19[5]);
+
+  h[5] = _mm256_mul_epu32(x[0], y[5]);
+  P25519X4_MAC(h[5], x[1], y[4]);
+  P25519X4_MAC(h[5], x[2], y[3]);
+  P25519X4_MAC(h[5], x[3], y[2]);
+  P25519X4_MAC(h[5], x[4], y[1]);
+  P25519X4_MAC(h[5], x[5], y[0]);
+  P25519X4_MAC(h[5], x[6], y19[9]);
+  P25519X4_MAC(h[5], x[7], y19[8]);
+  P25519X4_MAC(h[5], x[8], y19[7]);
+  P25519X4_MAC(h[5], x[9], y19[6]);
+
+  h[6] = _mm256_mul_epu32(x[0], y[6]);
+  P25519X4_MAC(h[6], x2[1], y[5]);
+  P25519X4_MAC(h[6], x[2], y[4]);
+  P25519X4_MAC(h[6], x2[3], y[3]);
+  P25519X4_MAC(h[6], x[4], y[2]);
+  P25519X4_MAC(h[6], x2[5], y[1]);
+  P25519X4_MAC(h[6], x[6], y[0]);
+  P25519X4_MAC(h[6], x2[7], y19[9]);
+  P25519X4_MAC(h[6], x[8], y19[8]);
+  P25519X4_MAC(h[6], x2[9], y19[7]);
+
+  h[7] = _mm256_mul_epu32(x[0], y[7]);
+  P25519X4_MAC(h[7], x[1], y[6]);
+  P25519X4_MAC(h[7], x[2], y[5]);
+  P25519X4_MAC(h[7], x[3], y[4]);
+  P25519X4_MAC(h[7], x[4], y[3]);
+  P25519X4_MAC(h[7], x[5], y[2]);
+  P25519X4_MAC(h[7], x[6], y[1]);
+  P25519X4_MAC(h[7], x[7], y[0]);
+  P25519X4_MAC(h[7], x[8], y19[9]);
+  P25519X4_MAC(h[7], x[9], y19[8]);
+
+  h[8] = _mm256_mul_epu32(x[0], y[8]);
+  P25519X4_MAC(h[8], x2[1], y[7]);
+  P25519X4_MAC(h[8], x[2], y[6]);
+  P25519X4_MAC(h[8], x2[3], y[5]);
+  P25519X4_MAC(h[8], x[4], y[4]);
+  P25519X4_MAC(h[8], x2[5], y[3]);
+  P25519X4_MAC(h[8], x[6], y[2]);
+  P25519X4_MAC(h[8], x2[7], y[1]);
+  P25519X4_MAC(h[8], x[8], y[0]);
+  P25519X4_MAC(h[8], x2[9], y19[9]);
+
+  h[9] = _mm256_mul_epu32(x[0], y[9]);
+  P25519X4_MAC(h[9], x[1], y[8]);
+  P25519X4_MAC(h[9], x[2], y[7]);
+  P25519X4_MAC(h[9], x[3], y[6]);
+  P25519X4_MAC(h[9], x[4], y[5]);
+  P25519X4_MAC(h[9], x[5], y[4]);
+  P25519X4_MAC(h[9], x[6], y[3]);
+  P25519X4_MAC(h[9], x[7], y[2]);
+  P25519X4_MAC(h[9], x[8], y[1]);
+  P25519X4_MAC(h[9], x[9], y[0]);
+
+  p25519x4_fe_carry(z, h);
+}
+
+P25519X4_TARGET static void
+p25519x4_fe_sqr(p25519x4_fe_t z, const p25519x4_fe_t x) {
+  const __m256i nineteen = _mm256_set1_epi64x(19);
+  __m256i x2[10], x4[10], x19[10], h[10];
+  int i;
+
+  for (i = 0; i < 10; i++)
+    x2[i] = _mm256_add_epi64(x[i], x[i]);
+
+  for (i = 1; i < 9; i += 2)
+    x4[i] = _mm256_add_epi64(x2[i], x2[i]);
+
+  for (i = 5; i < 10; i++)
+    x19[i] = _mm256_mul_epu32(x[i], nineteen);
+
+  h[0] = _mm256_mul_epu32(x[0], x[0]);
+  P25519X4_MAC(h[0], x4[1], x19[9]);
+  P25519X4_MAC(h[0], x2[2], x19[8]);
+  P25519X4_MAC(h[0], x4[3], x19[7]);
+  P25519X4_MAC(h[0], x2[4], x19[6]);
+  P25519X4_MAC(h[0], x2[5], x19[5]);
+
+  h[1] = _mm256_mul_epu32(x2[0], x[1]);
+  P25519X4_MAC(h[1], x2[2], x19[9]);
+  P25519X4_MAC(h[1], x2[3], x19[8]);
+  P25519X4_MAC(h[1], x2[4], x19[7]);
+  P25519X4_MAC(h[1], x2[5], x19[6]);
+
+  h[2] = _mm256_mul_epu32(x2[0], x[2]);
+  P25519X4_MAC(h[2], x2[1], x[1]);
+  P25519X4_MAC(h[2], x4[3], x19[9]);
+  P25519X4_MAC(h[2], x2[4], x19[8]);
+  P25519X4_MAC(h[2], x4[5], x19[7]);
+  P25519X4_MAC(h[2], x[6], x19[6]);
+
+  h[3] = _mm256_mul_epu32(x2[0], x[3]);
+  P25519X4_MAC(h[3], x2[1], x[2]);
+  P25519X4_MAC(h[3], x2[4], x19[9]);
+  P25519X4_MAC(h[3], x2[5], x19[8]);
+  P25519X4_MAC(h[3], x2[6], x19[7]);
+
+  h[4] = _mm256_mul_epu32(x2[0], x[4]);
+  P25519X4_MAC(h[4], x4[1], x[3]);
+  P25519X4_MAC(h[4], x[2], x[2]);
+  P25519X4_MAC(h[4], x4[5], x19[9]);
+  P25519X4_MAC(h[4], x2[6], x19[8]);
+  P25519X4_MAC(h[4], x2[7], x19[7]);
+
+  h[5] = _mm256_mul_epu32(x2[0], x[5]);
+  P25519X4_MAC(h[5], x2[1], x[4]);
+  P25519X4_MAC(h[5], x2[2], x[3]);
+  P25519X4_MAC(h[5], x2[6], x19[9]);
+  P25519X4_MAC(h[5], x2[7], x19[8]);
+
+  h[6] = _mm256_mul_epu32(x2[0], x[6]);
+  P25519X4_MAC(h[6], x4[1], x[5]);
+  P25519X4_MAC(h[6], x2[2], x[4]);
+  P25519X4_MAC(h[6], x2[3], x[3]);
+  P25519X4_MAC(h[6], x4[7], x19[9]);
+  P25519X4_MAC(h[6], x[8], x19[8]);
+
+  h[7] = _mm256_mul_epu32(x2[0], x[7]);
+  P25519X4_MAC(h[7], x2[1], x[6]);
+  P25519X4_MAC(h[7], x2[2], x[5]);
+  P25519X4_MAC(h[7], x2[3], x[4]);
+  P25519X4_MAC(h[7], x2[8], x19[9]);
+
+  h[8] = _mm256_mul_epu32(x2[0], x[8]);
+  P25519X4_MAC(h[8], x4[1], x[7]);
+  P25519X4_MAC(h[8], x2[2], x[6]);
+  P25519X4_MAC(h[8], x4[3], x[5]);
+  P25519X4_MAC(h[8], x[4], x[4]);
+  P25519X4_MAC(h[8], x2[9], x19[9]);
+
+  h[9] = _mm256_mul_epu32(x2[0], x[9]);
+  P25519X4_MAC(h[9], x2[1], x[8]);
+  P25519X4_MAC(h[9], x2[2], x[7]);
+  P25519X4_MAC(h[9], x2[3], x[6]);
+  P25519X4_MAC(h[9], x2[4], x[5]);
+
+  p25519x4_fe_carry(z, h);
+}
+
+P25519X4_TARGET static void
+p25519x4_fe_mul_a24(p25519x4_fe_t z, const p25519x4_fe_t x) {
+  const __m256i a24 = _mm256_set1_epi64x(121666);
+  __m256i h[10];
+  int i;
+
+  for (i = 0; i < 10; i++)
+    h[i] = _mm256_mul_epu32(x[i], a24);
+
+  p25519x4_fe_carry(z, h);
+}
+
+P25519X4_TARGET static void
+p25519x4_fe_swap(p25519x4_fe_t x, p25519x4_fe_t y, __m256i mask) {
+  __m256i t;
+  int i;
+
+  for (i = 0; i < 10; i++) {
+    t = _mm256_and_si256(_mm256_xor_si256(x[i], y[i]), mask);
+    x[i] = _mm256_xor_si256(x[i], t);
+    y[i] = _mm256_xor_si256(y[i], t);
+  }
+}
+
+P25519X4_TARGET static void
+p25519x4_ladder(p25519_fe_word_t **xs,
+                p25519_fe_word_t **zs,
+                const p25519_fe_word_t **us,
+                const unsigned char **ks) {
+  /* Four X25519 ladders, one per lane. Mirrors
+   * `mont_mul` with an affine input: scalars are
+   * 32-byte little-endian and already clamped.
+   * The outputs are projective (X : Z).
+   */
+  p25519x4_fe_t x1, x2, z2, x3, z3;
+  p25519x4_fe_t a, aa, b, bb, e, c, d, da, cb;
+  __m256i swap = _mm256_setzero_si256();
+  __m256i bit;
+  int i;
+
+  p25519x4_fe_load(x1, us);
+
+  for (i = 0; i < 10; i++) {
+    x2[i] = _mm256_setzero_si256();
+    z2[i] = _mm256_setzero_si256();
+    x3[i] = x1[i];
+    z3[i] = _mm256_setzero_si256();
+  }
+
+  x2[0] = _mm256_set1_epi64x(1);
+  z3[0] = _mm256_set1_epi64x(1);
+
+  for (i = 254; i >= 0; i--) {
+    bit = _mm256_set_epi64x((ks[3][i >> 3] >> (i & 7)) & 1,
+                            (ks[2][i >> 3] >> (i & 7)) & 1,
+                            (ks[1][i >> 3] >> (i & 7)) & 1,
+                            (ks[0][i >> 3] >> (i & 7)) & 1);
+
+    swap = _mm256_xor_si256(swap, bit);
+    swap = _mm256_sub_epi64(_mm256_setzero_si256(), swap);
+
+    p25519x4_fe_swap(x2, x3, swap);
+    p25519x4_fe_swap(z2, z3, swap);
+
+    swap = bit;
+
+    /* See `pge_ladder`. */
+    p25519x4_fe_add(a, x2, z2);
+    p25519x4_fe_sqr(aa, a);
+    p25519x4_fe_sub(b, x2, z2);
+    p25519x4_fe_sqr(bb, b);
+    p25519x4_fe_sub(e, aa, bb);
+    p25519x4_fe_add(c, x3, z3);
+    p25519x4_fe_sub(d, x3, z3);
+    p25519x4_fe_mul(da, d, a);
+    p25519x4_fe_mul(cb, c, b);
+    p25519x4_fe_add(x3, da, cb);
+    p25519x4_fe_sqr(x3, x3);
+    p25519x4_fe_sub(z3, da, cb);
+    p25519x4_fe_sqr(z3, z3);
+    p25519x4_fe_mul(z3, z3, x1);
+    p25519x4_fe_mul(x2, aa, bb);
+    p25519x4_fe_mul_a24(z2, e);
+    p25519x4_fe_add(z2, z2, bb);
+    p25519x4_fe_mul(z2, z2, e);
+  }
+
+  swap = _mm256_sub_epi64(_mm256_setzero_si256(), swap);
+
+  p25519x4_fe_swap(x2, x3, swap);
+  p25519x4_fe_swap(z2, z3, swap);
+
+  p25519x4_fe_store(xs, x2);
+  p25519x4_fe_store(zs, z2);
+
+  cleanse(x1, sizeof(x1));
+  cleanse(x2, sizeof(x2));
+  cleanse(z2, sizeof(z2));
+  cleanse(x3, sizeof(x3));
+  cleanse(z3, sizeof(z3));
+  cleanse(a, sizeof(a));
+  cleanse(aa, sizeof(aa));
+  cleanse(b, sizeof(b));
+  cleanse(bb, sizeof(bb));
+  cleanse(e, sizeof(e));
+  cleanse(c, sizeof(c));
+  cleanse(d, sizeof(d));
+  cleanse(da, sizeof(da));
+  cleanse(cb, sizeof(cb));
+  cleanse(&swap, sizeof(swap));
+  cleanse(&bit, sizeof(bit));
+}
+
+/*
+ * Extended Points
+ *
+ * An extended point (X : Y : Z : T) on a = -1 fits in
+ * one 4-way element, a coordinate per lane, so that a
+ * group operation costs two multiplications of four
+ * lanes each [HWCD]. Additions take the second point
+ * in cached form (Y - X, Y + X, 2 * Z, 2 * d * T).
+ *
+ * Only the specialized ed25519 group uses these.
+ */
+
+#if defined(TORSION_SPECIALIZE)
+
+#define P25519X4_PERMUTE(z, x, a, b, c, d) do {                       \
+  int i_;                                                             \
+  for (i_ = 0; i_ < 10; i_++) {                                       \
+    (z)[i_] = _mm256_permute4x64_epi64((x)[i_], (a) | ((b) << 2)     \
+                                                | ((c) << 4)          \
+                                                | ((d) << 6));        \
+  }                                                                   \
+} while (0)
+
+#define P25519X4_BLEND(z, x, y, lanes) do {                           \
+  int i_;                                                             \
+  for (i_ = 0; i_ < 10; i_++)                                         \
+    (z)[i_] = _mm256_blend_epi32((x)[i_], (y)[i_], lanes);            \
+} while (0)
+
+P25519X4_TARGET static void
+p25519x4_fe_mask(p25519x4_fe_t z, const p25519x4_fe_t x, __m256i mask) {
+  int i;
+
+  for (i = 0; i < 10; i++)
+    z[i] = _mm256_and_si256(x[i], mask);
+}
+
+P25519X4_TARGET static void
+p25519x4_fe_sub_wide(p25519x4_fe_t z,
+                     const p25519x4_fe_t x,
+                     const p25519x4_fe_t y) {
+  /* z = x + 4 * p - y (y may be a sum of three). */
+  const __m256i p0 = _mm256_set1_epi64x(0xfffffb4);
+  const __m256i p1 = _mm256_set1_epi64x(0x7fffffc);
+  const __m256i p2 = _mm256_set1_epi64x(0xffffffc);
+  __m256i h[10];
+  int i;
+
+  h[0] = _mm256_add_epi64(x[0], _mm256_sub_epi64(p0, y[0]));
+
+  for (i = 1; i < 10; i++)
+    h[i] = _mm256_add_epi64(x[i], _mm256_sub_epi64((i & 1) ? p1 : p2, y[i]));
+
+  p25519x4_fe_carry(z, h);
+}
+
+P25519X4_TARGET static void
+p25519x4_xge_dbl(p25519x4_fe_t r, const p25519x4_fe_t p) {
+  /* See `xge_dbl_ext`:
+   *
+   *   (A, B, C, S) = (X1, Y1, Z1, X1 + Y1)^2
+   *   (E, H, F, G) = (S, 0, B, B) - (A + B, A + B, A + 2 * C, A)
+   *   (X3, Y3, Z3, T3) = (E, G, G, E) * (F, H, F, H)
+   */
+  const __m256i lane2 = _mm256_set_epi64x(0, -1, 0, 0);
+  const __m256i lane3 = _mm256_set_epi64x(-1, 0, 0, 0);
+  p25519x4_fe_t t, u, v;
+
+  P25519X4_PERMUTE(t, p, 0, 1, 2, 0);
+  P25519X4_PERMUTE(u, p, 1, 1, 1, 1);
+  p25519x4_fe_mask(u, u, lane3);
+  p25519x4_fe_add(t, t, u);
+  p25519x4_fe_sqr(t, t);
+
+  P25519X4_PERMUTE(u, t, 3, 0, 1, 1);
+  p25519x4_fe_mask(u, u, _mm256_set_epi64x(-1, -1, 0, -1));
+
+  P25519X4_PERMUTE(v, t, 1, 1, 2, 3);
+  p25519x4_fe_mask(v, v, _mm256_set_epi64x(0, -1, -1, -1));
+  p25519x4_fe_mask(r, v, lane2);
+  p25519x4_fe_add(v, v, r);
+
+  P25519X4_PERMUTE(t, t, 0, 0, 0, 0);
+  p25519x4_fe_add(v, v, t);
+
+  p25519x4_fe_sub_wide(u, u, v);
+
+  P25519X4_PERMUTE(t, u, 0, 3, 3, 0);
+  P25519X4_PERMUTE(v, u, 2, 1, 2, 1);
+  p25519x4_fe_mul(r, t, v);
+}
+
+P25519X4_TARGET static void
+p25519x4_xge_prepare(p25519x4_fe_t r, const p25519x4_fe_t p) {
+  /* r = (Y - X, Y + X, Z, T) */
+  p25519x4_fe_t t, u, v;
+
+  P25519X4_PERMUTE(t, p, 1, 1, 2, 3);
+  P25519X4_PERMUTE(u, p, 0, 0, 0, 0);
+  p25519x4_fe_mask(u, u, _mm256_set_epi64x(0, 0, -1, -1));
+  p25519x4_fe_sub(v, t, u);
+  p25519x4_fe_add(t, t, u);
+  P25519X4_BLEND(r, t, v, 0x03);
+}
+
+P25519X4_TARGET static void
+p25519x4_xge_cache(p25519x4_fe_t r,
+                   const p25519x4_fe_t p,
+                   const p25519x4_fe_t k) {
+  /* k = (1, 1, 2, 2 * d) */
+  p25519x4_fe_t t;
+
+  p25519x4_xge_prepare(t, p);
+  p25519x4_fe_mul(r, t, k);
+}
+
+P25519X4_TARGET static void
+p25519x4_xge_cache_neg(p25519x4_fe_t r, const p25519x4_fe_t q) {
+  /* -(X, Y, Z, T) = (-X, Y, Z, -T) */
+  p25519x4_fe_t t, u;
+  int i;
+
+  P25519X4_PERMUTE(t, q, 1, 0, 2, 3);
+
+  for (i = 0; i < 10; i++)
+    u[i] = _mm256_setzero_si256();
+
+  p25519x4_fe_sub(u, u, t);
+  P25519X4_BLEND(r, t, u, 0xc0);
+}
+
+P25519X4_TARGET static void
+p25519x4_xge_add(p25519x4_fe_t r,
+                 const p25519x4_fe_t p,
+                 const p25519x4_fe_t q) {
+  /* See `xge_add_m1`:
+   *
+   *   (A, B, D, C) = (Y1 - X1, Y1 + X1, Z1, T1) * q
+   *   (E, H, F, G) = (B, B, D, D) -+ (A, A, C, C)
+   *   (X3, Y3, Z3, T3) = (E, G, G, E) * (F, H, F, H)
+   */
+  p25519x4_fe_t t, u, v;
+
+  p25519x4_xge_prepare(t, p);
+  p25519x4_fe_mul(t, t, q);
+
+  P25519X4_PERMUTE(u, t, 1, 1, 2, 2);
+  P25519X4_PERMUTE(v, t, 0, 0, 3, 3);
+  p25519x4_fe_sub(t, u, v);
+  p25519x4_fe_add(u, u, v);
+  P25519X4_BLEND(u, u, t, 0x33);
+
+  P25519X4_PERMUTE(t, u, 0, 3, 3, 0);
+  P25519X4_PERMUTE(v, u, 2, 1, 2, 1);
+  p25519x4_fe_mul(r, t, v);
+}
+
+#undef P25519X4_BLEND
+#undef P25519X4_PERMUTE
+#endif /* TORSION_SPECIALIZE */
+
+#undef P25519X4_MAC
+#endif /* P25519_HAVE_AVX2 */
@@ -25,6 +25,118 @@ typedef p256_fe_word_t p256_fe_t[P256_FIELD_WORDS];
 #define p256_fe_mul fiat_p256_mul
 #define p256_fe_sqr fiat_p256_square
 
+#if defined(TORSION_HAVE_ASM_X64) && P256_FIELD_WORDS == 4
+#define P256_HAVE_ADX
+
+/* t = (t + x * y[i] + m * p) / 2^64 */
+#define P256_ADX_ROUND(off, t0, t1, t2, t3, t4, t5) \
+  "movq " off "(%q2), %%rdx\n"                      \
+  "xorl %%" t5 "d, %%" t5 "d\n"                     \
+  "mulxq (%q1), %%rax, %%rcx\n"                     \
+  "adoxq %%rax, %%" t0 "\n"                         \
+  "adcxq %%rcx, %%" t1 "\n"                         \
+  "mulxq 8(%q1), %%rax, %%rcx\n"                    \
+  "adoxq %%rax, %%" t1 "\n"                         \
+  "adcxq %%rcx, %%" t2 "\n"                         \
+  "mulxq 16(%q1), %%rax, %%rcx\n"                   \
+  "adoxq %%rax, %%" t2 "\n"                         \
+  "adcxq %%rcx, %%" t3 "\n"                         \
+  "mulxq 24(%q1), %%rax, %%rcx\n"                   \
+  "adoxq %%rax, %%" t3 "\n"                         \
+  "adcxq %%rcx, %%" t4 "\n"                         \
+  "movl $0, %%eax\n"                                \
+  "adoxq %%rax, %%" t4 "\n"                         \
+  "adcxq %%rax, %%" t5 "\n"                         \
+  "adoxq %%rax, %%" t5 "\n"                         \
+  "movq %%" t0 ", %%rdx\n"                          \
+  "movq %%" t0 ", %%rax\n"                          \
+  "shlq $32, %%rax\n"                               \
+  "movq %%" t0 ", %%rcx\n"                          \
+  "shrq $32, %%rcx\n"                               \
+  "mulxq %3, %%r14, %%r15\n"                        \
+  "addq %%rax, %%" t1 "\n"                          \
+  "adcq %%rcx, %%" t2 "\n"                          \
+  "adcq %%r14, %%" t3 "\n"                          \
+  "adcq %%r15, %%" t4 "\n"                          \
+  "adcq $0, %%" t5 "\n"
+
+static void
+p256_fe_mul_adx(p256_fe_word_t *z,
+                const p256_fe_word_t *x,
+                const p256_fe_word_t *y) {
+  /* Montgomery multiplication with MULX/ADCX/ADOX.
+   *
+   * Since p = -1 mod 2^64, the reduction factor
+   * is simply the low word, and `m * p` reduces
+   * to a shift and a single MULX against p[3]
+   * (p[0] = -1, p[1] = 2^32 - 1, p[2] = 0).
+   *
+   * Each round accumulates `x * y[i]` on two
+   * carry chains and then folds in `m * p`. The
+   * result is fully reduced, matching fiat.
+   */
+  static const p256_fe_word_t p3 = UINT64_C(0xffffffff00000001);
+
+  __asm__ __volatile__ (
+    /* t = x * y[0] */
+    "movq (%q2), %%rdx\n"
+    "mulxq (%q1), %%r8, %%r9\n"
+    "mulxq 8(%q1), %%rax, %%r10\n"
+    "addq %%rax, %%r9\n"
+    "mulxq 16(%q1), %%rax, %%r11\n"
+    "adcq %%rax, %%r10\n"
+    "mulxq 24(%q1), %%rax, %%r12\n"
+    "adcq %%rax, %%r11\n"
+    "adcq $0, %%r12\n"
+    /* t = (t + t[0] * p) / 2^64 */
+    "movq %%r8, %%rdx\n"
+    "movq %%r8, %%rax\n"
+    "shlq $32, %%rax\n"
+    "movq %%r8, %%rcx\n"
+    "shrq $32, %%rcx\n"
+    "mulxq %3, %%r14, %%r15\n"
+    "movl $0, %%r13d\n"
+    "addq %%rax, %%r9\n"
+    "adcq %%rcx, %%r10\n"
+    "adcq %%r14, %%r11\n"
+    "adcq %%r15, %%r12\n"
+    "adcq $0, %%r13\n"
+    P256_ADX_ROUND("8", "r9", "r10", "r11", "r12", "r13", "r8")
+    P256_ADX_ROUND("16", "r10", "r11", "r12", "r13", "r8", "r9")
+    P256_ADX_ROUND("24", "r11", "r12", "r13", "r8", "r9", "r10")
+    /* z = t - p if t >= p */
+    "movl $0xffffffff, %%r14d\n"
+    "movq %%r12, %%rax\n"
+    "subq $-1, %%rax\n"
+    "movq %%r13, %%rcx\n"
+    "sbbq %%r14, %%rcx\n"
+    "movq %%r8, %%rdx\n"
+    "sbbq $0, %%rdx\n"
+    "movq %%r9, %%r15\n"
+    "sbbq %3, %%r15\n"
+    "sbbq $0, %%r10\n"
+    "cmovncq %%rax, %%r12\n"
+    "cmovncq %%rcx, %%r13\n"
+    "cmovncq %%rdx, %%r8\n"
+    "cmovncq %%r15, %%r9\n"
+    "movq %%r12, (%q0)\n"
+    "movq %%r13, 8(%q0)\n"
+    "movq %%r8, 16(%q0)\n"
+    "movq %%r9, 24(%q0)\n"
+    :
+    : "r" (z), "r" (x), "r" (y), "m" (p3)
+    : "cc", "memory", "rax", "rcx", "rdx",
+      "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"
+  );
+}
+
+static void
+p256_fe_sqr_adx(p256_fe_word_t *z, const p256_fe_word_t *x) {
+  p256_fe_mul_adx(z, x, x);
+}
+#undef P256_ADX_ROUND
+#endif /* P256_HAVE_ADX */
+
 static void
 p256_fe_set(p256_fe_t z, const p256_fe_t x) {
   z[0] = x[0];
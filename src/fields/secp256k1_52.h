@@ -0,0 +1,532 @@
+/*!
+ * secp256k1_52.h - secp256k1 5x52 field element for libtorsion
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/libtorsion
+ *
+ * Resources:
+ *   https://github.com/bitcoin-core/secp256k1/blob/master/src/field_5x52_int128_impl.h
+ */
+
+#if defined(TORSION_HAVE_ASM_X64) && SECP256K1_FIELD_WORDS == 6
+#define SECP256K1_HAVE_52
+
+/* Five 52 bit limbs with lazy reduction, as in
+ * libsecp256k1. Fiat's six 43 bit limbs do not
+ * map onto MULX, so this is a representation of
+ * its own, used in place of fiat's on CPUs with
+ * BMI2/ADX.
+ *
+ * Carried limbs are below 2^52 (2^49 for the
+ * top limb). Addition, subtraction and negation
+ * leave them below 2^56 (2^52), which is what
+ * the multiplication kernels accept.
+ */
+typedef uint64_t secp256k1_52_fe_t[5];
+
+#define SECP256K1_52_M UINT64_C(0xfffffffffffff)
+#define SECP256K1_52_R UINT64_C(0x1000003d1)
+
+static void
+secp256k1_52_add(uint64_t *z, const uint64_t *x, const uint64_t *y) {
+  z[0] = x[0] + y[0];
+  z[1] = x[1] + y[1];
+  z[2] = x[2] + y[2];
+  z[3] = x[3] + y[3];
+  z[4] = x[4] + y[4];
+}
+
+static void
+secp256k1_52_sub(uint64_t *z, const uint64_t *x, const uint64_t *y) {
+  /* z = x + 4 * p - y */
+  z[0] = x[0] + UINT64_C(0x3ffffbfffff0bc) - y[0];
+  z[1] = x[1] + UINT64_C(0x3ffffffffffffc) - y[1];
+  z[2] = x[2] + UINT64_C(0x3ffffffffffffc) - y[2];
+  z[3] = x[3] + UINT64_C(0x3ffffffffffffc) - y[3];
+  z[4] = x[4] + UINT64_C(0x3fffffffffffc) - y[4];
+}
+
+static void
+secp256k1_52_opp(uint64_t *z, const uint64_t *x) {
+  /* z = 4 * p - x */
+  z[0] = UINT64_C(0x3ffffbfffff0bc) - x[0];
+  z[1] = UINT64_C(0x3ffffffffffffc) - x[1];
+  z[2] = UINT64_C(0x3ffffffffffffc) - x[2];
+  z[3] = UINT64_C(0x3ffffffffffffc) - x[3];
+  z[4] = UINT64_C(0x3fffffffffffc) - x[4];
+}
+
+static void
+secp256k1_52_carry(uint64_t *z, const uint64_t *x) {
+  uint64_t t0 = x[0];
+  uint64_t t1 = x[1];
+  uint64_t t2 = x[2];
+  uint64_t t3 = x[3];
+  uint64_t t4 = x[4];
+
+  /* 2^256 = 2^32 + 977 (mod p) */
+  t0 += (t4 >> 48) * SECP256K1_52_R;
+  t4 &= SECP256K1_52_M >> 4;
+
+  t1 += t0 >> 52;
+  t0 &= SECP256K1_52_M;
+  t2 += t1 >> 52;
+  t1 &= SECP256K1_52_M;
+  t3 += t2 >> 52;
+  t2 &= SECP256K1_52_M;
+  t4 += t3 >> 52;
+  t3 &= SECP256K1_52_M;
+
+  z[0] = t0;
+  z[1] = t1;
+  z[2] = t2;
+  z[3] = t3;
+  z[4] = t4;
+}
+
+/* lo:hi += x * y */
+#define SECP256K1_52_MULADD(x, y, lo, hi) \
+  "movq " x ", %%rdx\n"                   \
+  "mulxq " y ", %%rax, %%rcx\n"           \
+  "addq %%rax, %%" lo "\n"                \
+  "adcq %%rcx, %%" hi "\n"
+
+/* lo:hi += 2 * x * y */
+#define SECP256K1_52_MULADD2(x, y, lo, hi) \
+  "movq " x ", %%rdx\n"                    \
+  "addq %%rdx, %%rdx\n"                    \
+  "mulxq " y ", %%rax, %%rcx\n"            \
+  "addq %%rax, %%" lo "\n"                 \
+  "adcq %%rcx, %%" hi "\n"
+
+static void
+secp256k1_52_carry_mul(uint64_t *z, const uint64_t *x, const uint64_t *y) {
+  /* Product scanning with MULX on two 128 bit
+   * accumulators, d (r8:r9) for the upper half
+   * of the product and c (r10:r11) for the lower.
+   * Each column of d is folded down by 2^260 =
+   * R (mod p) as soon as 52 bits of it are ready.
+   *
+   * The first three output limbs are kept in
+   * registers until the inputs are consumed, so
+   * `z` may alias `x` or `y`.
+   */
+  static const uint64_t r = SECP256K1_52_R << 4;
+  static const uint64_t r4 = SECP256K1_52_R;
+  static const uint64_t m = SECP256K1_52_M;
+
+  __asm__ __volatile__ (
+    /* d = x0 * y3 + x1 * y2 + x2 * y1 + x3 * y0 */
+    "movq (%q1), %%rdx\n"
+    "mulxq 24(%q2), %%r8, %%r9\n"
+    SECP256K1_52_MULADD("8(%q1)", "16(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("16(%q1)", "8(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("24(%q1)", "(%q2)", "r8", "r9")
+    /* c = x4 * y4 */
+    "movq 32(%q1), %%rdx\n"
+    "mulxq 32(%q2), %%r10, %%r11\n"
+    /* d += lo(c) * R, c >>= 64 */
+    "movq %%r10, %%rdx\n"
+    "mulxq %3, %%rax, %%rcx\n"
+    "addq %%rax, %%r8\n"
+    "adcq %%rcx, %%r9\n"
+    /* t3 = d & M, d >>= 52 */
+    "movq %%r8, %%r12\n"
+    "andq %5, %%r12\n"
+    "shrdq $52, %%r9, %%r8\n"
+    "shrq $52, %%r9\n"
+    /* d += x0 * y4 + x1 * y3 + x2 * y2 + x3 * y1 + x4 * y0 */
+    SECP256K1_52_MULADD("(%q1)", "32(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("8(%q1)", "24(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("16(%q1)", "16(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("24(%q1)", "8(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("32(%q1)", "(%q2)", "r8", "r9")
+    /* d += c * (R << 12) */
+    "movq %%r11, %%rdx\n"
+    "shlq $12, %%rdx\n"
+    "mulxq %3, %%rax, %%rcx\n"
+    "addq %%rax, %%r8\n"
+    "adcq %%rcx, %%r9\n"
+    /* t4 = d & M, d >>= 52 */
+    "movq %%r8, %%r13\n"
+    "andq %5, %%r13\n"
+    "shrdq $52, %%r9, %%r8\n"
+    "shrq $52, %%r9\n"
+    /* tx = t4 >> 48, t4 &= M >> 4 */
+    "movq %%r13, %%r15\n"
+    "shrq $48, %%r15\n"
+    "shlq $16, %%r13\n"
+    "shrq $16, %%r13\n"
+    /* c = x0 * y0 */
+    "movq (%q1), %%rdx\n"
+    "mulxq (%q2), %%r10, %%r11\n"
+    /* d += x1 * y4 + x2 * y3 + x3 * y2 + x4 * y1 */
+    SECP256K1_52_MULADD("8(%q1)", "32(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("16(%q1)", "24(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("24(%q1)", "16(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("32(%q1)", "8(%q2)", "r8", "r9")
+    /* u0 = ((d & M) << 4) | tx, d >>= 52 */
+    "movq %%r8, %%rdx\n"
+    "andq %5, %%rdx\n"
+    "shlq $4, %%rdx\n"
+    "orq %%r15, %%rdx\n"
+    "shrdq $52, %%r9, %%r8\n"
+    "shrq $52, %%r9\n"
+    /* c += u0 * (R >> 4) */
+    "mulxq %4, %%rax, %%rcx\n"
+    "addq %%rax, %%r10\n"
+    "adcq %%rcx, %%r11\n"
+    /* z0 = c & M, c >>= 52 */
+    "movq %%r10, %%r15\n"
+    "andq %5, %%r15\n"
+    "shrdq $52, %%r11, %%r10\n"
+    "shrq $52, %%r11\n"
+    /* c += x0 * y1 + x1 * y0 */
+    SECP256K1_52_MULADD("(%q1)", "8(%q2)", "r10", "r11")
+    SECP256K1_52_MULADD("8(%q1)", "(%q2)", "r10", "r11")
+    /* d += x2 * y4 + x3 * y3 + x4 * y2 */
+    SECP256K1_52_MULADD("16(%q1)", "32(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("24(%q1)", "24(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("32(%q1)", "16(%q2)", "r8", "r9")
+    /* c += (d & M) * R, d >>= 52 */
+    "movq %%r8, %%rdx\n"
+    "andq %5, %%rdx\n"
+    "mulxq %3, %%rax, %%rcx\n"
+    "addq %%rax, %%r10\n"
+    "adcq %%rcx, %%r11\n"
+    "shrdq $52, %%r9, %%r8\n"
+    "shrq $52, %%r9\n"
+    /* z1 = c & M, c >>= 52 */
+    "movq %%r10, %%r14\n"
+    "andq %5, %%r14\n"
+    "shrdq $52, %%r11, %%r10\n"
+    "shrq $52, %%r11\n"
+    /* c += x0 * y2 + x1 * y1 + x2 * y0 */
+    SECP256K1_52_MULADD("(%q1)", "16(%q2)", "r10", "r11")
+    SECP256K1_52_MULADD("8(%q1)", "8(%q2)", "r10", "r11")
+    SECP256K1_52_MULADD("16(%q1)", "(%q2)", "r10", "r11")
+    /* d += x3 * y4 + x4 * y3 */
+    SECP256K1_52_MULADD("24(%q1)", "32(%q2)", "r8", "r9")
+    SECP256K1_52_MULADD("32(%q1)", "24(%q2)", "r8", "r9")
+    /* c += lo(d) * R, d >>= 64 */
+    "movq %%r8, %%rdx\n"
+    "mulxq %3, %%rax, %%rcx\n"
+    "addq %%rax, %%r10\n"
+    "adcq %%rcx, %%r11\n"
+    /* z2 = c & M, c >>= 52 */
+    "movq %%r10, %%rdx\n"
+    "andq %5, %%rdx\n"
+    "shrdq $52, %%r11, %%r10\n"
+    "shrq $52, %%r11\n"
+    "movq %%r15, (%q0)\n"
+    "movq %%r14, 8(%q0)\n"
+    "movq %%rdx, 16(%q0)\n"
+    /* c += d * (R << 12) + t3 */
+    "movq %%r9, %%rdx\n"
+    "shlq $12, %%rdx\n"
+    "mulxq %3, %%rax, %%rcx\n"
+    "addq %%rax, %%r10\n"
+    "adcq %%rcx, %%r11\n"
+    "addq %%r12, %%r10\n"
+    "adcq $0, %%r11\n"
+    /* z3 = c & M, z4 = (c >> 52) + t4 */
+    "movq %%r10, %%rdx\n"
+    "andq %5, %%rdx\n"
+    "shrdq $52, %%r11, %%r10\n"
+    "addq %%r13, %%r10\n"
+    "movq %%rdx, 24(%q0)\n"
+    "movq %%r10, 32(%q0)\n"
+    :
+    : "r" (z), "r" (x), "r" (y), "m" (r), "m" (r4), "m" (m)
+    : "cc", "memory", "rax", "rcx", "rdx",
+      "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"
+  );
+}
+
+static void
+secp256k1_52_carry_square(uint64_t *z, const uint64_t *x) {
+  /* As above, with the cross products doubled. */
+  static const uint64_t r = SECP256K1_52_R << 4;
+  static const uint64_t r4 = SECP256K1_52_R;
+  static const uint64_t m = SECP256K1_52_M;
+
+  __asm__ __volatile__ (
+    /* d = 2 * x0 * x3 + 2 * x1 * x2 */
+    "movq (%q1), %%rdx\n"
+    "addq %%rdx, %%rdx\n"
+    "mulxq 24(%q1), %%r8, %%r9\n"
+    SECP256K1_52_MULADD2("8(%q1)", "16(%q1)", "r8", "r9")
+    /* c = x4 * x4 */
+    "movq 32(%q1), %%rdx\n"
+    "mulxq %%rdx, %%r10, %%r11\n"
+    /* d += lo(c) * R, c >>= 64 */
+    "movq %%r10, %%rdx\n"
+    "mulxq %2, %%rax, %%rcx\n"
+    "addq %%rax, %%r8\n"
+    "adcq %%rcx, %%r9\n"
+    /* t3 = d & M, d >>= 52 */
+    "movq %%r8, %%r12\n"
+    "andq %4, %%r12\n"
+    "shrdq $52, %%r9, %%r8\n"
+    "shrq $52, %%r9\n"
+    /* d += 2 * x0 * x4 + 2 * x1 * x3 + x2 * x2 */
+    SECP256K1_52_MULADD2("(%q1)", "32(%q1)", "r8", "r9")
+    SECP256K1_52_MULADD2("8(%q1)", "24(%q1)", "r8", "r9")
+    SECP256K1_52_MULADD("16(%q1)", "16(%q1)", "r8", "r9")
+    /* d += c * (R << 12) */
+    "movq %%r11, %%rdx\n"
+    "shlq $12, %%rdx\n"
+    "mulxq %2, %%rax, %%rcx\n"
+    "addq %%rax, %%r8\n"
+    "adcq %%rcx, %%r9\n"
+    /* t4 = d & M, d >>= 52 */
+    "movq %%r8, %%r13\n"
+    "andq %4, %%r13\n"
+    "shrdq $52, %%r9, %%r8\n"
+    "shrq $52, %%r9\n"
+    /* tx = t4 >> 48, t4 &= M >> 4 */
+    "movq %%r13, %%r15\n"
+    "shrq $48, %%r15\n"
+    "shlq $16, %%r13\n"
+    "shrq $16, %%r13\n"
+    /* c = x0 * x0 */
+    "movq (%q1), %%rdx\n"
+    "mulxq %%rdx, %%r10, %%r11\n"
+    /* d += 2 * x1 * x4 + 2 * x2 * x3 */
+    SECP256K1_52_MULADD2("8(%q1)", "32(%q1)", "r8", "r9")
+    SECP256K1_52_MULADD2("16(%q1)", "24(%q1)", "r8", "r9")
+    /* u0 = ((d & M) << 4) | tx, d >>= 52 */
+    "movq %%r8, %%rdx\n"
+    "andq %4, %%rdx\n"
+    "shlq $4, %%rdx\n"
+    "orq %%r15, %%rdx\n"
+    "shrdq $52, %%r9, %%r8\n"
+    "shrq $52, %%r9\n"
+    /* c += u0 * (R >> 4) */
+    "mulxq %3, %%rax, %%rcx\n"
+    "addq %%rax, %%r10\n"
+    "adcq %%rcx, %%r11\n"
+    /* z0 = c & M, c >>= 52 */
+    "movq %%r10, %%r15\n"
+    "andq %4, %%r15\n"
+    "shrdq $52, %%r11, %%r10\n"
+    "shrq $52, %%r11\n"
+    /* c += 2 * x0 * x1 */
+    SECP256K1_52_MULADD2("(%q1)", "8(%q1)", "r10", "r11")
+    /* d += 2 * x2 * x4 + x3 * x3 */
+    SECP256K1_52_MULADD2("16(%q1)", "32(%q1)", "r8", "r9")
+    SECP256K1_52_MULADD("24(%q1)", "24(%q1)", "r8", "r9")
+    /* c += (d & M) * R, d >>= 52 */
+    "movq %%r8, %%rdx\n"
+    "andq %4, %%rdx\n"
+    "mulxq %2, %%rax, %%rcx\n"
+    "addq %%rax, %%r10\n"
+    "adcq %%rcx, %%r11\n"
+    "shrdq $52, %%r9, %%r8\n"
+    "shrq $52, %%r9\n"
+    /* z1 = c & M, c >>= 52 */
+    "movq %%r10, %%r14\n"
+    "andq %4, %%r14\n"
+    "shrdq $52, %%r11, %%r10\n"
+    "shrq $52, %%r11\n"
+    /* c += 2 * x0 * x2 + x1 * x1 */
+    SECP256K1_52_MULADD2("(%q1)", "16(%q1)", "r10", "r11")
+    SECP256K1_52_MULADD("8(%q1)", "8(%q1)", "r10", "r11")
+    /* d += 2 * x3 * x4 */
+    SECP256K1_52_MULADD2("24(%q1)", "32(%q1)", "r8", "r9")
+    /* c += lo(d) * R, d >>= 64 */
+    "movq %%r8, %%rdx\n"
+    "mulxq %2, %%rax, %%rcx\n"
+    "addq %%rax, %%r10\n"
+    "adcq %%rcx, %%r11\n"
+    /* z2 = c & M, c >>= 52 */
+    "movq %%r10, %%rdx\n"
+    "andq %4, %%rdx\n"
+    "shrdq $52, %%r11, %%r10\n"
+    "shrq $52, %%r11\n"
+    "movq %%r15, (%q0)\n"
+    "movq %%r14, 8(%q0)\n"
+    "movq %%rdx, 16(%q0)\n"
+    /* c += d * (R << 12) + t3 */
+    "movq %%r9, %%rdx\n"
+    "shlq $12, %%rdx\n"
+    "mulxq %2, %%rax, %%rcx\n"
+    "addq %%rax, %%r10\n"
+    "adcq %%rcx, %%r11\n"
+    "addq %%r12, %%r10\n"
+    "adcq $0, %%r11\n"
+    /* z3 = c & M, z4 = (c >> 52) + t4 */
+    "movq %%r10, %%rdx\n"
+    "andq %4, %%rdx\n"
+    "shrdq $52, %%r11, %%r10\n"
+    "addq %%r13, %%r10\n"
+    "movq %%rdx, 24(%q0)\n"
+    "movq %%r10, 32(%q0)\n"
+    :
+    : "r" (z), "r" (x), "m" (r), "m" (r4), "m" (m)
+    : "cc", "memory", "rax", "rcx", "rdx",
+      "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"
+  );
+}
+#undef SECP256K1_52_MULADD
+#undef SECP256K1_52_MULADD2
+
+static void
+secp256k1_52_scmul(uint64_t *z, const uint64_t *x, uint64_t k) {
+  uint64_t t[5];
+
+  t[0] = x[0] * k;
+  t[1] = x[1] * k;
+  t[2] = x[2] * k;
+  t[3] = x[3] * k;
+  t[4] = x[4] * k;
+
+  secp256k1_52_carry(z, t);
+}
+
+static void
+secp256k1_52_carry_scmul_3(uint64_t *z, const uint64_t *x) {
+  secp256k1_52_scmul(z, x, 3);
+}
+
+static void
+secp256k1_52_carry_scmul_4(uint64_t *z, const uint64_t *x) {
+  secp256k1_52_scmul(z, x, 4);
+}
+
+static void
+secp256k1_52_carry_scmul_8(uint64_t *z, const uint64_t *x) {
+  secp256k1_52_scmul(z, x, 8);
+}
+
+static void
+secp256k1_52_selectznz(uint64_t *z,
+                       unsigned char flag,
+                       const uint64_t *x,
+                       const uint64_t *y) {
+  /* z = flag ? y : x */
+  uint64_t m = -(uint64_t)flag;
+
+  z[0] = (x[0] & ~m) | (y[0] & m);
+  z[1] = (x[1] & ~m) | (y[1] & m);
+  z[2] = (x[2] & ~m) | (y[2] & m);
+  z[3] = (x[3] & ~m) | (y[3] & m);
+  z[4] = (x[4] & ~m) | (y[4] & m);
+}
+
+static void
+secp256k1_52_to_bytes(uint8_t *z, const uint64_t *x) {
+  uint64_t t0, t1, t2, t3, t4, m, c;
+  uint64_t w[5];
+  int i, j;
+
+  secp256k1_52_carry(w, x);
+
+  t0 = w[0];
+  t1 = w[1];
+  t2 = w[2];
+  t3 = w[3];
+  t4 = w[4];
+
+  /* c = t >= p (at most one subtraction is needed). */
+  m = t1 & t2 & t3;
+  c = t4 >> 48;
+  c |= (((t4 ^ (SECP256K1_52_M >> 4)) - 1) >> 63)
+     & (((m ^ SECP256K1_52_M) - 1) >> 63)
+     & ((UINT64_C(0xffffefffffc2e) - t0) >> 63);
+
+  /* t -= c * p (mod 2^256) */
+  t0 += c * SECP256K1_52_R;
+  t1 += t0 >> 52;
+  t0 &= SECP256K1_52_M;
+  t2 += t1 >> 52;
+  t1 &= SECP256K1_52_M;
+  t3 += t2 >> 52;
+  t2 &= SECP256K1_52_M;
+  t4 += t3 >> 52;
+  t3 &= SECP256K1_52_M;
+  t4 &= SECP256K1_52_M >> 4;
+
+  w[0] = t0 | (t1 << 52);
+  w[1] = (t1 >> 12) | (t2 << 40);
+  w[2] = (t2 >> 24) | (t3 << 28);
+  w[3] = (t3 >> 36) | (t4 << 16);
+
+  for (i = 0; i < 4; i++) {
+    for (j = 0; j < 8; j++)
+      z[i * 8 + j] = (uint8_t)(w[i] >> (j * 8));
+  }
+}
+
+static void
+secp256k1_52_from_bytes(uint64_t *z, const uint8_t *x) {
+  uint64_t w[4];
+  int i, j;
+
+  for (i = 0; i < 4; i++) {
+    w[i] = 0;
+
+    for (j = 0; j < 8; j++)
+      w[i] |= (uint64_t)x[i * 8 + j] << (j * 8);
+  }
+
+  z[0] = w[0] & SECP256K1_52_M;
+  z[1] = ((w[0] >> 52) | (w[1] << 12)) & SECP256K1_52_M;
+  z[2] = ((w[1] >> 40) | (w[2] << 24)) & SECP256K1_52_M;
+  z[3] = ((w[2] >> 28) | (w[3] << 36)) & SECP256K1_52_M;
+  z[4] = w[3] >> 16;
+}
+
+static void
+secp256k1_52_fe_set(secp256k1_52_fe_t z, const secp256k1_52_fe_t x) {
+  z[0] = x[0];
+  z[1] = x[1];
+  z[2] = x[2];
+  z[3] = x[3];
+  z[4] = x[4];
+}
+
+static int
+secp256k1_52_fe_equal(const secp256k1_52_fe_t x, const secp256k1_52_fe_t y) {
+  uint32_t z = 0;
+  uint8_t u[32];
+  uint8_t v[32];
+  int i;
+
+  secp256k1_52_to_bytes(u, x);
+  secp256k1_52_to_bytes(v, y);
+
+  for (i = 0; i < 32; i++)
+    z |= (uint32_t)u[i] ^ (uint32_t)v[i];
+
+  return (z - 1) >> 31;
+}
+
+/* Instantiate the addition chains for this representation. */
+#undef secp256k1_fe_mul
+#undef secp256k1_fe_sqr
+#define secp256k1_fe_t secp256k1_52_fe_t
+#define secp256k1_fe_set secp256k1_52_fe_set
+#define secp256k1_fe_equal secp256k1_52_fe_equal
+#define secp256k1_fe_mul secp256k1_52_carry_mul
+#define secp256k1_fe_sqr secp256k1_52_carry_square
+#define secp256k1_fe_sqrn secp256k1_52_fe_sqrn
+#define secp256k1_fe_pow_core secp256k1_52_fe_pow_core
+#define secp256k1_fe_pow_pm3d4 secp256k1_52_fe_pow_pm3d4
+#define secp256k1_fe_invert secp256k1_52_fe_invert
+#define secp256k1_fe_sqrt secp256k1_52_fe_sqrt
+#define secp256k1_fe_isqrt secp256k1_52_fe_isqrt
+#include "secp256k1_chain.h"
+#undef secp256k1_fe_t
+#undef secp256k1_fe_set
+#undef secp256k1_fe_equal
+#undef secp256k1_fe_mul
+#undef secp256k1_fe_sqr
+#undef secp256k1_fe_sqrn
+#undef secp256k1_fe_pow_core
+#undef secp256k1_fe_pow_pm3d4
+#undef secp256k1_fe_invert
+#undef secp256k1_fe_sqrt
+#undef secp256k1_fe_isqrt
+#define secp256k1_fe_mul fiat_secp256k1_carry_mul
+#define secp256k1_fe_sqr fiat_secp256k1_carry_square
+#endif /* SECP256K1_HAVE_52 */
@@ -0,0 +1,914 @@
+/*!
+ * group.h - group law templates for libtorsion
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/libtorsion
+ */
+
+/* Included by ecc.c once for the generic group law
+ * and once per specialized field. Expects:
+ *
+ *   GROUP(name)    - name of an instantiated function.
+ *   GROUP_FE(ec)   - field of `ec`. Specialized instances
+ *                    pass a constant table so the field
+ *                    kernels are called directly.
+ *   GROUP_DISPATCH - defined for the generic instance,
+ *                    which forwards to `ec->group`.
+ *
+ * Along with one of GROUP_WEI, GROUP_MONT or
+ * GROUP_EDWARDS to select the coordinate system.
+ */
+
+#if defined(GROUP_WEI)
+
+static void
+GROUP(jge_dblj)(const wei_t *ec, jge_t *p3, const jge_t *p1) {
+  /* https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#doubling-dbl-1998-cmo-2
+   * 3M + 6S + 4A + 1*a + 2*2 + 1*3 + 1*4 + 1*8
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t xx, yy, zz, s, m, t;
+
+  /* XX = X1^2 */
+  fe_sqr(fe, xx, p1->x);
+
+  /* YY = Y1^2 */
+  fe_sqr(fe, yy, p1->y);
+
+  /* ZZ = Z1^2 */
+  fe_sqr(fe, zz, p1->z);
+
+  /* S = 4 * X1 * YY */
+  fe_mul4(fe, s, p1->x);
+  fe_mul(fe, s, s, yy);
+
+  /* M = 3 * XX + a * ZZ^2 */
+  fe_sqr(fe, t, zz);
+  fe_mul(fe, t, t, ec->a);
+  fe_mul3(fe, m, xx);
+  fe_add_nc(fe, m, m, t);
+
+  /* T = M^2 - 2 * S */
+  fe_sqr(fe, t, m);
+  fe_sub(fe, t, t, s);
+  fe_sub(fe, t, t, s);
+
+  /* Z3 = 2 * Y1 * Z1 */
+  fe_add_nc(fe, xx, p1->y, p1->y);
+  fe_mul(fe, p3->z, p1->z, xx);
+
+  /* X3 = T */
+  fe_set(fe, p3->x, t);
+
+  /* Y3 = M * (S - T) - 8 * YY^2 */
+  fe_sub_nc(fe, s, s, t);
+  fe_sqr(fe, yy, yy);
+  fe_mul8(fe, yy, yy);
+  fe_mul(fe, p3->y, m, s);
+  fe_sub(fe, p3->y, p3->y, yy);
+}
+
+static void
+GROUP(jge_dbl0)(const wei_t *ec, jge_t *p3, const jge_t *p1) {
+  /* Assumes a = 0.
+   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html#doubling-dbl-2009-l
+   * 2M + 5S + 6A + 3*2 + 1*3 + 1*8
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t a, b, c, d, e, f;
+
+  (void)ec;
+
+  /* A = X1^2 */
+  fe_sqr(fe, a, p1->x);
+
+  /* B = Y1^2 */
+  fe_sqr(fe, b, p1->y);
+
+  /* C = B^2 */
+  fe_sqr(fe, c, b);
+
+  /* D = 2 * ((X1 + B)^2 - A - C) */
+  fe_add_nc(fe, d, p1->x, b);
+  fe_sqr(fe, d, d);
+  fe_sub(fe, d, d, a);
+  fe_sub(fe, d, d, c);
+  fe_add(fe, d, d, d);
+
+  /* E = 3 * A */
+  fe_mul3(fe, e, a);
+
+  /* F = E^2 */
+  fe_sqr(fe, f, e);
+
+  /* Z3 = 2 * Y1 * Z1 */
+  fe_add_nc(fe, a, p1->y, p1->y);
+  fe_mul(fe, p3->z, p1->z, a);
+
+  /* X3 = F - 2 * D */
+  fe_sub(fe, p3->x, f, d);
+  fe_sub(fe, p3->x, p3->x, d);
+
+  /* Y3 = E * (D - X3) - 8 * C */
+  fe_sub_nc(fe, d, d, p3->x);
+  fe_mul8(fe, c, c);
+  fe_mul(fe, p3->y, e, d);
+  fe_sub(fe, p3->y, p3->y, c);
+}
+
+static void
+GROUP(jge_dbl3)(const wei_t *ec, jge_t *p3, const jge_t *p1) {
+  /* Assumes a = -3.
+   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#doubling-dbl-2001-b
+   * 3M + 5S + 8A + 1*3 + 1*4 + 2*8
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t delta, gamma, beta, alpha, theta;
+
+  (void)ec;
+
+  /* delta = Z1^2 */
+  fe_sqr(fe, delta, p1->z);
+
+  /* gamma = Y1^2 */
+  fe_sqr(fe, gamma, p1->y);
+
+  /* beta = X1 * gamma */
+  fe_mul(fe, beta, p1->x, gamma);
+
+  /* alpha = 3 * (X1 - delta) * (X1 + delta) */
+  fe_sub_nc(fe, alpha, p1->x, delta);
+  fe_add_nc(fe, theta, p1->x, delta);
+  fe_mul3(fe, alpha, alpha);
+  fe_mul(fe, alpha, alpha, theta);
+
+  /* Z3 = (Y1 + Z1)^2 - gamma - delta */
+  fe_add_nc(fe, p3->z, p1->y, p1->z);
+  fe_sqr(fe, p3->z, p3->z);
+  fe_sub(fe, p3->z, p3->z, gamma);
+  fe_sub(fe, p3->z, p3->z, delta);
+
+  /* X3 = alpha^2 - 8 * beta */
+  fe_mul4(fe, theta, beta);
+  fe_sqr(fe, p3->x, alpha);
+  fe_sub(fe, p3->x, p3->x, theta);
+  fe_sub(fe, p3->x, p3->x, theta);
+
+  /* Y3 = alpha * (4 * beta - X3) - 8 * gamma^2 */
+  fe_sub_nc(fe, theta, theta, p3->x);
+  fe_sqr(fe, gamma, gamma);
+  fe_mul8(fe, gamma, gamma);
+  fe_mul(fe, p3->y, alpha, theta);
+  fe_sub(fe, p3->y, p3->y, gamma);
+}
+
+static void
+GROUP(jge_dbl_var)(const wei_t *ec, jge_t *p3, const jge_t *p1) {
+  const prime_field_t *fe = GROUP_FE(ec);
+
+#if defined(GROUP_DISPATCH)
+  if (ec->group != NULL) {
+    ec->group->dbl_var(ec, p3, p1);
+    return;
+  }
+#endif
+
+  /* P = O */
+  if (p1->inf) {
+    jge_zero(ec, p3);
+    return;
+  }
+
+  /* Y1 = 0 */
+  if (ec->h > 1 && fe_is_zero(fe, p1->y)) {
+    jge_zero(ec, p3);
+    return;
+  }
+
+  if (ec->zero_a)
+    GROUP(jge_dbl0)(ec, p3, p1);
+  else if (ec->three_a)
+    GROUP(jge_dbl3)(ec, p3, p1);
+  else
+    GROUP(jge_dblj)(ec, p3, p1);
+
+  p3->inf = 0;
+  p3->aff = 0;
+}
+
+static void
+GROUP(jge_addsub_var)(const wei_t *ec, jge_t *p3,
+                      const jge_t *p1, const jge_t *p2, int sign) {
+  /* No assumptions.
+   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-add-1998-cmo-2
+   * 12M + 4S + 6A + 1*2
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t t1, t2, t3, t4, t5, t6;
+
+#if defined(GROUP_DISPATCH)
+  if (ec->group != NULL) {
+    ec->group->addsub_var(ec, p3, p1, p2, sign);
+    return;
+  }
+#endif
+
+#define z1z1 t1
+#define z2z2 t2
+#define u1   t3
+#define u2   t4
+#define s1   t5
+#define s2   t6
+#define h    t1 /* <- z1z1 */
+#define r    t2 /* <- z2z2 */
+#define hh   t4 /* <- u2 */
+#define hhh  t6 /* <- s2 */
+#define v    t3 /* <- u1 */
+
+  /* Z1Z1 = Z1^2 */
+  fe_sqr(fe, z1z1, p1->z);
+
+  /* Z2Z2 = Z2^2 */
+  fe_sqr(fe, z2z2, p2->z);
+
+  /* U1 = X1 * Z2Z2 */
+  fe_mul(fe, u1, p1->x, z2z2);
+
+  /* U2 = X2 * Z1Z1 */
+  fe_mul(fe, u2, p2->x, z1z1);
+
+  /* S1 = Y1 * Z2 * Z2Z2 */
+  fe_mul(fe, s1, p1->y, p2->z);
+  fe_mul(fe, s1, s1, z2z2);
+
+  /* S2 = Y2 * Z1 * Z1Z1 */
+  fe_mul(fe, s2, p2->y, p1->z);
+  fe_mul(fe, s2, s2, z1z1);
+
+  /* H = U2 - U1 */
+  fe_sub(fe, h, u2, u1);
+
+  /* r = S2 - S1 */
+  if (sign)
+    fe_sub_nc(fe, r, s2, s1);
+  else
+    fe_add_nc(fe, r, s2, s1);
+
+  /* H = 0 */
+  if (fe_is_zero(fe, h)) {
+    fe_carry(fe, r, r);
+
+    if (fe_is_zero(fe, r))
+      GROUP(jge_dbl_var)(ec, p3, p1);
+    else
+      jge_zero(ec, p3);
+
+    return;
+  }
+
+  /* HH = H^2 */
+  fe_sqr(fe, hh, h);
+
+  /* HHH = H * HH */
+  fe_mul(fe, hhh, h, hh);
+
+  /* V = U1 * HH */
+  fe_mul(fe, v, u1, hh);
+
+  /* X3 = r^2 - HHH - 2 * V */
+  fe_sqr(fe, p3->x, r);
+  fe_sub(fe, p3->x, p3->x, hhh);
+  fe_sub(fe, p3->x, p3->x, v);
+  fe_sub(fe, p3->x, p3->x, v);
+
+  /* Y3 = r * (V - X3) - S1 * HHH */
+  if (sign)
+    fe_sub_nc(fe, v, v, p3->x);
+  else
+    fe_sub_nc(fe, v, p3->x, v);
+
+  fe_mul(fe, s1, s1, hhh);
+  fe_mul(fe, p3->y, r, v);
+  fe_sub(fe, p3->y, p3->y, s1);
+
+  /* Z3 = Z1 * Z2 * H */
+  fe_mul(fe, p3->z, p1->z, p2->z);
+  fe_mul(fe, p3->z, p3->z, h);
+
+  p3->inf = 0;
+  p3->aff = 0;
+
+#undef z1z1
+#undef z2z2
+#undef u1
+#undef u2
+#undef s1
+#undef s2
+#undef h
+#undef r
+#undef hh
+#undef hhh
+#undef v
+}
+
+static void
+GROUP(jge_mixed_addsub_var)(const wei_t *ec, jge_t *p3, const jge_t *p1,
+                            const fe_t x2, const fe_t y2, int sign) {
+  /* Assumes Z2 = 1.
+   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-madd
+   * 8M + 3S + 6A + 5*2
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t t1, t2, t3, t4;
+
+#if defined(GROUP_DISPATCH)
+  if (ec->group != NULL) {
+    ec->group->mixed_addsub_var(ec, p3, p1, x2, y2, sign);
+    return;
+  }
+#endif
+
+#define z1z1 t1
+#define u2   t2
+#define s2   t3
+#define h    t4
+#define r    t1 /* <- z1z1 */
+#define i    t2 /* <- u2 */
+#define j    t3 /* <- s2 */
+#define v    t2 /* <- i */
+
+  /* Z1Z1 = Z1^2 */
+  fe_sqr(fe, z1z1, p1->z);
+
+  /* U2 = X2 * Z1Z1 */
+  fe_mul(fe, u2, x2, z1z1);
+
+  /* S2 = Y2 * Z1 * Z1Z1 */
+  fe_mul(fe, s2, y2, p1->z);
+  fe_mul(fe, s2, s2, z1z1);
+
+  /* H = U2 - X1 */
+  fe_sub(fe, h, u2, p1->x);
+
+  /* r = 2 * (S2 - Y1) */
+  if (sign)
+    fe_sub(fe, r, s2, p1->y);
+  else
+    fe_add(fe, r, s2, p1->y);
+
+  /* H = 0 */
+  if (fe_is_zero(fe, h)) {
+    if (fe_is_zero(fe, r))
+      GROUP(jge_dbl_var)(ec, p3, p1);
+    else
+      jge_zero(ec, p3);
+
+    return;
+  }
+
+  fe_add_nc(fe, r, r, r);
+
+  /* I = (2 * H)^2 */
+  fe_add_nc(fe, i, h, h);
+  fe_mul(fe, p3->z, p1->z, i);
+  fe_sqr(fe, i, i);
+
+  /* J = H * I */
+  fe_mul(fe, j, h, i);
+
+  /* V = X1 * I */
+  fe_mul(fe, v, i, p1->x);
+
+  /* X3 = r^2 - J - 2 * V */
+  fe_sqr(fe, p3->x, r);
+  fe_sub(fe, p3->x, p3->x, j);
+  fe_sub(fe, p3->x, p3->x, v);
+  fe_sub(fe, p3->x, p3->x, v);
+
+  /* Y3 = r * (V - X3) - 2 * Y1 * J */
+  if (sign)
+    fe_sub_nc(fe, v, v, p3->x);
+  else
+    fe_sub_nc(fe, v, p3->x, v);
+
+  fe_mul(fe, j, j, p1->y);
+  fe_mul(fe, p3->y, r, v);
+  fe_sub(fe, p3->y, p3->y, j);
+  fe_sub(fe, p3->y, p3->y, j);
+
+  /* Z3 = 2 * Z1 * H */
+  /* Computed above. */
+
+  p3->inf = 0;
+  p3->aff = 0;
+
+#undef z1z1
+#undef u2
+#undef s2
+#undef h
+#undef r
+#undef i
+#undef j
+#undef v
+}
+
+#endif /* GROUP_WEI */
+
+#if defined(GROUP_MONT)
+
+static void
+GROUP(mont_mul_a24)(const mont_t *ec, fe_t z, const fe_t x) {
+  const prime_field_t *fe = GROUP_FE(ec);
+
+  if (fe->scmul_a24 != NULL)
+    fe->scmul_a24(z, x);
+  else
+    fe_mul(fe, z, x, ec->a24);
+}
+
+static void
+GROUP(pge_ladder)(const mont_t *ec,
+                  pge_t *p4,
+                  pge_t *p5,
+                  const pge_t *p1,
+                  const pge_t *p2,
+                  const pge_t *p3,
+                  int affine) {
+  /* https://hyperelliptic.org/EFD/g1p/auto-montgom-xz.html#ladder-ladd-1987-m-3
+   * 6M + 4S + 8A + 1*a24
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t a, aa, b, bb, e, c, d, da, cb;
+
+  ASSERT(p1 != p5);
+  ASSERT(p4 != p5);
+
+  /* A = X2 + Z2 */
+  fe_add_nc(fe, a, p2->x, p2->z);
+
+  /* AA = A^2 */
+  fe_sqr(fe, aa, a);
+
+  /* B = X2 - Z2 */
+  fe_sub_nc(fe, b, p2->x, p2->z);
+
+  /* BB = B^2 */
+  fe_sqr(fe, bb, b);
+
+  /* E = AA - BB */
+  fe_sub_nc(fe, e, aa, bb);
+
+  /* C = X3 + Z3 */
+  fe_add_nc(fe, c, p3->x, p3->z);
+
+  /* D = X3 - Z3 */
+  fe_sub_nc(fe, d, p3->x, p3->z);
+
+  /* DA = D * A */
+  fe_mul(fe, da, d, a);
+
+  /* CB = C * B */
+  fe_mul(fe, cb, c, b);
+
+  /* X5 = Z1 * (DA + CB)^2 */
+  fe_add_nc(fe, p5->x, da, cb);
+  fe_sqr(fe, p5->x, p5->x);
+
+  if (!affine)
+    fe_mul(fe, p5->x, p5->x, p1->z);
+
+  /* Z5 = X1 * (DA - CB)^2 */
+  fe_sub_nc(fe, p5->z, da, cb);
+  fe_sqr(fe, p5->z, p5->z);
+  fe_mul(fe, p5->z, p5->z, p1->x);
+
+  /* X4 = AA * BB */
+  fe_mul(fe, p4->x, aa, bb);
+
+  /* Z4 = E * (BB + a24 * E) */
+  GROUP(mont_mul_a24)(ec, p4->z, e);
+  fe_add_nc(fe, p4->z, p4->z, bb);
+  fe_mul(fe, p4->z, p4->z, e);
+}
+
+static void
+GROUP(mont_mul)(const mont_t *ec,
+                pge_t *r,
+                const pge_t *p,
+                const sc_t k,
+                int affine) {
+  /* Multiply with the Montgomery Ladder.
+   *
+   * [MONT3] Algorithm 7, Page 16, Section 5.3.
+   *         Algorithm 8, Page 16, Section 5.3.
+   *
+   * [RFC7748] Page 7, Section 5.
+   *
+   * Note that any clamping is meant to
+   * be done _outside_ of this function.
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  const scalar_field_t *sc = &ec->sc;
+  mp_limb_t swap = 0;
+  mp_limb_t bit = 0;
+  mp_bits_t i;
+  pge_t a, b;
+
+#if defined(GROUP_DISPATCH)
+  if (ec->group != NULL) {
+    ec->group->mul(ec, r, p, k, affine);
+    return;
+  }
+#endif
+
+  pge_zero(ec, &a);
+  pge_set(ec, &b, p);
+
+  /* Climb the ladder. */
+  for (i = fe->bits - 1; i >= 0; i--) {
+    bit = sc_get_bit(sc, k, i);
+
+    /* Maybe swap. */
+    fe_swap(fe, a.x, b.x, swap ^ bit);
+    fe_swap(fe, a.z, b.z, swap ^ bit);
+
+    /* Single coordinate add+double. */
+    GROUP(pge_ladder)(ec, &a, &b, p, &a, &b, affine);
+
+    swap = bit;
+  }
+
+  /* Finalize loop. */
+  fe_swap(fe, a.x, b.x, swap);
+  fe_swap(fe, a.z, b.z, swap);
+  pge_set(ec, r, &a);
+
+  /* Ensure (1, 0) for infinity. The constant
+     tables of specialized fields hold no `one`. */
+  fe_select(fe, r->x, r->x, ec->fe.one, fe_is_zero(fe, r->z));
+
+  /* Cleanse. */
+  cleanse(&bit, sizeof(bit));
+  cleanse(&swap, sizeof(swap));
+}
+
+#endif /* GROUP_MONT */
+
+#if defined(GROUP_EDWARDS)
+
+static void
+GROUP(edwards_mul_a)(const edwards_t *ec, fe_t z, const fe_t x) {
+  const prime_field_t *fe = GROUP_FE(ec);
+
+  if (ec->mone_a)
+    fe_neg(fe, z, x); /* a = -1 */
+  else if (ec->one_a)
+    fe_set(fe, z, x); /* a = 1 */
+  else
+    fe_mul(fe, z, x, ec->a);
+}
+
+static void
+GROUP(edwards_mul_d)(const edwards_t *ec, fe_t z, const fe_t x) {
+  const prime_field_t *fe = GROUP_FE(ec);
+
+  if (fe->scmul_d != NULL)
+    fe->scmul_d(z, x);
+  else
+    fe_mul(fe, z, x, ec->d);
+}
+
+static void
+GROUP(xge_dbl_ext)(const edwards_t *ec, xge_t *p3, const xge_t *p1, int ext) {
+  /* https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#doubling-dbl-2008-hwcd
+   * 4M + 4S + 6A + 1*a + 1*2
+   *
+   * Doubling does not read T1. If the result is
+   * only going to be doubled again, T3 may be
+   * skipped (3M + 4S) as suggested by [HWCD].
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t a, b, c, d, e, g, f, h;
+
+#if defined(GROUP_DISPATCH)
+  if (ec->group != NULL) {
+    ec->group->dbl_ext(ec, p3, p1, ext);
+    return;
+  }
+#endif
+
+  /* A = X1^2 */
+  fe_sqr(fe, a, p1->x);
+
+  /* B = Y1^2 */
+  fe_sqr(fe, b, p1->y);
+
+  /* C = 2 * Z1^2 */
+  fe_sqr(fe, c, p1->z);
+  fe_add(fe, c, c, c);
+
+  /* D = a * A */
+  GROUP(edwards_mul_a)(ec, d, a);
+
+  /* E = (X1 + Y1)^2 - A - B */
+  fe_add_nc(fe, e, p1->x, p1->y);
+  fe_sqr(fe, e, e);
+  fe_sub(fe, e, e, a);
+  fe_sub_nc(fe, e, e, b);
+
+  /* G = D + B */
+  fe_add(fe, g, d, b);
+
+  /* F = G - C */
+  fe_sub_nc(fe, f, g, c);
+
+  /* H = D - B */
+  fe_sub_nc(fe, h, d, b);
+
+  /* X3 = E * F */
+  fe_mul(fe, p3->x, e, f);
+
+  /* Y3 = G * H */
+  fe_mul(fe, p3->y, g, h);
+
+  /* T3 = E * H */
+  if (ext)
+    fe_mul(fe, p3->t, e, h);
+
+  /* Z3 = F * G */
+  fe_mul(fe, p3->z, f, g);
+}
+
+static void
+GROUP(xge_add_a)(const edwards_t *ec, xge_t *p3,
+                 const xge_t *p1, const xge_t *p2, int affine) {
+  /* https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-add-2008-hwcd
+   * 9M + 7A + 1*a + 1*d
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-madd-2008-hwcd
+   * 8M + 7A + 1*a + 1*d
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t a, b, c, d, e, f, g, h;
+
+#if defined(GROUP_DISPATCH)
+  if (ec->group != NULL) {
+    ec->group->add_a(ec, p3, p1, p2, affine);
+    return;
+  }
+#endif
+
+  /* A = X1 * X2 */
+  fe_mul(fe, a, p1->x, p2->x);
+
+  /* B = Y1 * Y2 */
+  fe_mul(fe, b, p1->y, p2->y);
+
+  /* C = T1 * d * T2 */
+  fe_mul(fe, c, p1->t, p2->t);
+  GROUP(edwards_mul_d)(ec, c, c);
+
+  /* D = Z1 * Z2 */
+  if (affine)
+    fe_set(fe, d, p1->z);
+  else
+    fe_mul(fe, d, p1->z, p2->z);
+
+  /* E = (X1 + Y1) * (X2 + Y2) - A - B */
+  fe_add_nc(fe, f, p1->x, p1->y);
+  fe_add_nc(fe, g, p2->x, p2->y);
+  fe_mul(fe, e, f, g);
+  fe_sub(fe, e, e, a);
+  fe_sub_nc(fe, e, e, b);
+
+  /* F = D - C */
+  fe_sub_nc(fe, f, d, c);
+
+  /* G = D + C */
+  fe_add_nc(fe, g, d, c);
+
+  /* H = B - a * A */
+  GROUP(edwards_mul_a)(ec, h, a);
+  fe_sub_nc(fe, h, b, h);
+
+  /* X3 = E * F */
+  fe_mul(fe, p3->x, e, f);
+
+  /* Y3 = G * H */
+  fe_mul(fe, p3->y, g, h);
+
+  /* T3 = E * H */
+  fe_mul(fe, p3->t, e, h);
+
+  /* Z3 = F * G */
+  fe_mul(fe, p3->z, f, g);
+}
+
+static void
+GROUP(xge_sub_a)(const edwards_t *ec, xge_t *p3,
+                 const xge_t *p1, const xge_t *p2, int affine) {
+  /* https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-add-2008-hwcd
+   * 9M + 7A + 1*a + 1*d
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-madd-2008-hwcd
+   * 8M + 7A + 1*a + 1*d
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t a, b, c, d, e, f, g, h;
+
+#if defined(GROUP_DISPATCH)
+  if (ec->group != NULL) {
+    ec->group->sub_a(ec, p3, p1, p2, affine);
+    return;
+  }
+#endif
+
+  /* A = X1 * X2 */
+  fe_mul(fe, a, p1->x, p2->x);
+
+  /* B = Y1 * Y2 */
+  fe_mul(fe, b, p1->y, p2->y);
+
+  /* C = T1 * d * T2 */
+  fe_mul(fe, c, p1->t, p2->t);
+  GROUP(edwards_mul_d)(ec, c, c);
+
+  /* D = Z1 * Z2 */
+  if (affine)
+    fe_set(fe, d, p1->z);
+  else
+    fe_mul(fe, d, p1->z, p2->z);
+
+  /* E = (Y1 + X1) * (Y2 - X2) + A - B */
+  fe_add_nc(fe, f, p1->y, p1->x);
+  fe_sub_nc(fe, g, p2->y, p2->x);
+  fe_mul(fe, e, f, g);
+  fe_add(fe, e, e, a);
+  fe_sub_nc(fe, e, e, b);
+
+  /* F = D + C */
+  fe_add_nc(fe, f, d, c);
+
+  /* G = D - C */
+  fe_sub_nc(fe, g, d, c);
+
+  /* H = B + a * A */
+  GROUP(edwards_mul_a)(ec, h, a);
+  fe_add_nc(fe, h, b, h);
+
+  /* X3 = E * F */
+  fe_mul(fe, p3->x, e, f);
+
+  /* Y3 = G * H */
+  fe_mul(fe, p3->y, g, h);
+
+  /* T3 = E * H */
+  fe_mul(fe, p3->t, e, h);
+
+  /* Z3 = F * G */
+  fe_mul(fe, p3->z, f, g);
+}
+
+static void
+GROUP(xge_add_m1)(const edwards_t *ec, xge_t *p3,
+                  const xge_t *p1, const xge_t *p2, int affine) {
+  /* Assumes a = -1.
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-add-2008-hwcd-3
+   * 8M + 8A + 1*k + 1*2
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-madd-2008-hwcd-3
+   * 7M + 8A + 1*k + 1*2
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t a, b, c, d, e, f, g, h;
+
+#if defined(GROUP_DISPATCH)
+  if (ec->group != NULL) {
+    ec->group->add_m1(ec, p3, p1, p2, affine);
+    return;
+  }
+#endif
+
+  /* A = (Y1 - X1) * (Y2 - X2) */
+  fe_sub_nc(fe, c, p1->y, p1->x);
+  fe_sub_nc(fe, d, p2->y, p2->x);
+  fe_mul(fe, a, c, d);
+
+  /* B = (Y1 + X1) * (Y2 + X2) */
+  fe_add_nc(fe, c, p1->y, p1->x);
+  fe_add_nc(fe, d, p2->y, p2->x);
+  fe_mul(fe, b, c, d);
+
+  /* C = T1 * k * T2 */
+  fe_mul(fe, c, p1->t, p2->t);
+  fe_mul(fe, c, c, ec->k);
+
+  /* D = Z1 * 2 * Z2 */
+  if (affine) {
+    fe_add(fe, d, p1->z, p1->z);
+  } else {
+    fe_add_nc(fe, d, p1->z, p1->z);
+    fe_mul(fe, d, d, p2->z);
+  }
+
+  /* E = B - A */
+  fe_sub_nc(fe, e, b, a);
+
+  /* F = D - C */
+  fe_sub_nc(fe, f, d, c);
+
+  /* G = D + C */
+  fe_add_nc(fe, g, d, c);
+
+  /* H = B + A */
+  fe_add_nc(fe, h, b, a);
+
+  /* X3 = E * F */
+  fe_mul(fe, p3->x, e, f);
+
+  /* Y3 = G * H */
+  fe_mul(fe, p3->y, g, h);
+
+  /* T3 = E * H */
+  fe_mul(fe, p3->t, e, h);
+
+  /* Z3 = F * G */
+  fe_mul(fe, p3->z, f, g);
+}
+
+static void
+GROUP(xge_sub_m1)(const edwards_t *ec, xge_t *p3,
+                  const xge_t *p1, const xge_t *p2, int affine) {
+  /* Assumes a = -1.
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-add-2008-hwcd-3
+   * 8M + 8A + 1*k + 1*2
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-madd-2008-hwcd-3
+   * 7M + 8A + 1*k + 1*2
+   */
+  const prime_field_t *fe = GROUP_FE(ec);
+  fe_t a, b, c, d, e, f, g, h;
+
+#if defined(GROUP_DISPATCH)
+  if (ec->group != NULL) {
+    ec->group->sub_m1(ec, p3, p1, p2, affine);
+    return;
+  }
+#endif
+
+  /* A = (Y1 - X1) * (Y2 + X2) */
+  fe_sub_nc(fe, c, p1->y, p1->x);
+  fe_add_nc(fe, d, p2->y, p2->x);
+  fe_mul(fe, a, c, d);
+
+  /* B = (Y1 + X1) * (Y2 - X2) */
+  fe_add_nc(fe, c, p1->y, p1->x);
+  fe_sub_nc(fe, d, p2->y, p2->x);
+  fe_mul(fe, b, c, d);
+
+  /* C = T1 * k * T2 */
+  fe_mul(fe, c, p1->t, p2->t);
+  fe_mul(fe, c, c, ec->k);
+
+  /* D = Z1 * 2 * Z2 */
+  if (affine) {
+    fe_add(fe, d, p1->z, p1->z);
+  } else {
+    fe_add_nc(fe, d, p1->z, p1->z);
+    fe_mul(fe, d, d, p2->z);
+  }
+
+  /* E = B - A */
+  fe_sub_nc(fe, e, b, a);
+
+  /* F = D + C */
+  fe_add_nc(fe, f, d, c);
+
+  /* G = D - C */
+  fe_sub_nc(fe, g, d, c);
+
+  /* H = B + A */
+  fe_add_nc(fe, h, b, a);
+
+  /* X3 = E * F */
+  fe_mul(fe, p3->x, e, f);
+
+  /* Y3 = G * H */
+  fe_mul(fe, p3->y, g, h);
+
+  /* T3 = E * H */
+  fe_mul(fe, p3->t, e, h);
+
+  /* Z3 = F * G */
+  fe_mul(fe, p3->z, f, g);
+}
+
+#endif /* GROUP_EDWARDS */
+
+#undef GROUP
+#undef GROUP_FE
+#undef GROUP_DISPATCH
+#undef GROUP_WEI
+#undef GROUP_MONT
+#undef GROUP_EDWARDS
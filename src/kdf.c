@@ -324,18 +324,148 @@ bcrypt_hash256(unsigned char *out,
   torsion_memzero(&state, sizeof(state));
 }
 
+static void
+bcrypt_hash256x2(unsigned char *out0,
+                 unsigned char *out1,
+                 const unsigned char *pass, size_t pass_len,
+                 const unsigned char *salt0,
+                 const unsigned char *salt1,
+                 size_t salt_len,
+                 unsigned int rounds) {
+  /* Two bcrypt_hash256 invocations sharing a password,
+     with the key schedules run in lockstep. */
+  static const unsigned char ciphertext[] = BCRYPT_CIPHERTEXT256;
+  uint32_t cdata0[BCRYPT_BLOCKS256];
+  uint32_t cdata1[BCRYPT_BLOCKS256];
+  blowfish_t state0, state1;
+  uint32_t i;
+  size_t off;
+  int j;
+
+  ASSERT(rounds >= 4 && rounds <= 31);
+
+  blowfish_init(&state0, pass, pass_len, salt0, salt_len);
+  blowfish_init(&state1, pass, pass_len, salt1, salt_len);
+
+  for (i = 0; i < (UINT32_C(1) << rounds); i++) {
+    blowfish_expand0state2(&state0, salt0, salt_len,
+                           &state1, salt1, salt_len);
+
+    blowfish_expand0state2(&state0, pass, pass_len,
+                           &state1, pass, pass_len);
+  }
+
+  off = 0;
+
+  for (j = 0; j < BCRYPT_BLOCKS256; j++) {
+    cdata0[j] = blowfish_stream2word(ciphertext, BCRYPT_SIZE256, &off);
+    cdata1[j] = cdata0[j];
+  }
+
+  for (j = 0; j < 64; j++) {
+    blowfish_enc(&state0, cdata0, BCRYPT_BLOCKS256);
+    blowfish_enc(&state1, cdata1, BCRYPT_BLOCKS256);
+  }
+
+  for (j = 0; j < BCRYPT_BLOCKS256; j++) {
+    write32le(out0 + j * 4, cdata0[j]);
+    write32le(out1 + j * 4, cdata1[j]);
+  }
+
+  torsion_memzero(cdata0, sizeof(cdata0));
+  torsion_memzero(cdata1, sizeof(cdata1));
+  torsion_memzero(&state0, sizeof(state0));
+  torsion_memzero(&state1, sizeof(state1));
+}
+
+static void
+bcrypt_pbkdf_hash(unsigned char out[2][BCRYPT_SIZE256],
+                  const unsigned char *sha2pass,
+                  unsigned char sha2salt[2][64],
+                  size_t lanes) {
+  if (lanes == 2) {
+    bcrypt_hash256x2(out[0], out[1], sha2pass, 64,
+                     sha2salt[0], sha2salt[1], 64, 6);
+  } else {
+    bcrypt_hash256(out[0], sha2pass, 64, sha2salt[0], 64, 6);
+  }
+}
+
+typedef struct bcrypt_pbkdf_job_s {
+  const unsigned char *sha2pass;
+  const sha512_t *shash;
+  unsigned int rounds;
+  size_t count;
+  size_t lanes;
+  unsigned char out[2][BCRYPT_SIZE256];
+  int done;
+} bcrypt_pbkdf_job_t;
+
+static void
+bcrypt_pbkdf_job(void *ptr) {
+  bcrypt_pbkdf_job_t *job = (bcrypt_pbkdf_job_t *)ptr;
+  unsigned char tmpout[2][BCRYPT_SIZE256];
+  unsigned char sha2salt[2][64];
+  unsigned char ctr[4];
+  sha512_t hash;
+  size_t i, j, k;
+
+  for (k = 0; k < job->lanes; k++) {
+    write32be(ctr, job->count + k);
+
+    hash = *job->shash;
+    sha512_update(&hash, ctr, 4);
+    sha512_final(&hash, sha2salt[k]);
+  }
+
+  bcrypt_pbkdf_hash(tmpout, job->sha2pass, sha2salt, job->lanes);
+
+  memcpy(job->out, tmpout, job->lanes * BCRYPT_SIZE256);
+
+  for (i = 1; i < job->rounds; i++) {
+    for (k = 0; k < job->lanes; k++) {
+      sha512_init(&hash);
+      sha512_update(&hash, tmpout[k], BCRYPT_SIZE256);
+      sha512_final(&hash, sha2salt[k]);
+    }
+
+    bcrypt_pbkdf_hash(tmpout, job->sha2pass, sha2salt, job->lanes);
+
+    for (k = 0; k < job->lanes; k++) {
+      for (j = 0; j < BCRYPT_SIZE256; j++)
+        job->out[k][j] ^= tmpout[k][j];
+    }
+  }
+
+  job->done = 1;
+
+  torsion_memzero(tmpout, sizeof(tmpout));
+  torsion_memzero(sha2salt, sizeof(sha2salt));
+  torsion_memzero(&hash, sizeof(hash));
+}
+
 int
 bcrypt_pbkdf(unsigned char *key,
              const unsigned char *pass, size_t pass_len,
              const unsigned char *salt, size_t salt_len,
              unsigned int rounds, size_t size) {
-  size_t i, j, stride, amount, keylen, amt, count, dest;
-  unsigned char out[BCRYPT_SIZE256];
-  unsigned char tmpout[BCRYPT_SIZE256];
+  return bcrypt_pbkdf_with_runner(key, pass, pass_len, salt, salt_len,
+                                  rounds, size, NULL, NULL);
+}
+
+int
+bcrypt_pbkdf_with_runner(unsigned char *key,
+                         const unsigned char *pass, size_t pass_len,
+                         const unsigned char *salt, size_t salt_len,
+                         unsigned int rounds, size_t size,
+                         kdf_run_f *run, void *arg) {
+  /* At most 32 strides, computed in pairs. */
+  bcrypt_pbkdf_job_t jobs[(BCRYPT_SIZE256 + 1) / 2];
+  void *args[(BCRYPT_SIZE256 + 1) / 2];
+  size_t i, k, stride, amount, keylen, amt, count, dest, len;
   unsigned char sha2pass[64];
-  unsigned char sha2salt[64];
-  unsigned char ctr[4];
   sha512_t shash, hash;
+  int ret = 0;
 
   if (rounds == 0
       || pass_len == 0
@@ -359,54 +489,65 @@ bcrypt_pbkdf(unsigned char *key,
   sha512_init(&shash);
   sha512_update(&shash, salt, salt_len);
 
-  keylen = size;
-  amt = amount;
+  /* Output strides are independent of one another.
+     Compute them in pairs where possible. */
+  for (len = 0, count = 1; count <= stride; len++) {
+    bcrypt_pbkdf_job_t *job = &jobs[len];
 
-  for (count = 1; keylen > 0; count++) {
-    write32be(ctr, count);
+    job->sha2pass = sha2pass;
+    job->shash = &shash;
+    job->rounds = rounds;
+    job->count = count;
+    job->lanes = count < stride ? 2 : 1;
+    job->done = 0;
 
-    hash = shash;
-    sha512_update(&hash, ctr, 4);
-    sha512_final(&hash, sha2salt);
+    args[len] = job;
+    count += job->lanes;
+  }
 
-    bcrypt_hash256(tmpout, sha2pass, 64, sha2salt, 64, 6);
+  if (run != NULL) {
+    run(bcrypt_pbkdf_job, args, len, arg);
+  } else {
+    for (i = 0; i < len; i++)
+      bcrypt_pbkdf_job(&jobs[i]);
+  }
 
-    memcpy(out, tmpout, BCRYPT_SIZE256);
+  for (i = 0; i < len; i++) {
+    if (!jobs[i].done)
+      goto fail;
+  }
 
-    for (i = 1; i < rounds; i++) {
-      sha512_init(&hash);
-      sha512_update(&hash, tmpout, BCRYPT_SIZE256);
-      sha512_final(&hash, sha2salt);
+  keylen = size;
+  amt = amount;
 
-      bcrypt_hash256(tmpout, sha2pass, 64, sha2salt, 64, 6);
+  for (count = 0; count < len && keylen > 0; count++) {
+    const bcrypt_pbkdf_job_t *job = &jobs[count];
 
-      for (j = 0; j < BCRYPT_SIZE256; j++)
-        out[j] ^= tmpout[j];
-    }
+    for (k = 0; k < job->lanes && keylen > 0; k++) {
+      if (amt > keylen)
+        amt = keylen;
 
-    if (amt > keylen)
-      amt = keylen;
+      for (i = 0; i < amt; i++) {
+        dest = i * stride + (job->count + k - 1);
 
-    for (i = 0; i < amt; i++) {
-      dest = i * stride + (count - 1);
+        if (dest >= size)
+          break;
 
-      if (dest >= size)
-        break;
+        key[dest] = job->out[k][i];
+      }
 
-      key[dest] = out[i];
+      keylen -= i;
     }
-
-    keylen -= i;
   }
 
-  torsion_memzero(out, sizeof(out));
-  torsion_memzero(tmpout, sizeof(tmpout));
+  ret = 1;
+fail:
+  torsion_memzero(jobs, sizeof(jobs));
   torsion_memzero(sha2pass, sizeof(sha2pass));
-  torsion_memzero(sha2salt, sizeof(sha2salt));
   torsion_memzero(&shash, sizeof(shash));
   torsion_memzero(&hash, sizeof(hash));
 
-  return 1;
+  return ret;
 }
 
 int
@@ -690,6 +831,126 @@ hkdf_expand(unsigned char *out,
  *   http://nvlpubs.nist.gov/nistpubs/Legacy/SP/nistspecialpublication800-132.pdf
  */
 
+static void
+pbkdf2_sha256(unsigned char *block,
+              const hmac_t *pmac,
+              uint32_t iter,
+              size_t hash_size) {
+  /* Iterate HMAC-SHA256 (or SHA224) directly on the
+     compression function. The key's inner and outer
+     midstates are reused verbatim, and the message
+     block is padded once up front such that each
+     iteration costs exactly two compressions. */
+  const sha256_t *inner = &pmac->inner.ctx.sha256;
+  const sha256_t *outer = &pmac->outer.ctx.sha256;
+  size_t words = hash_size / 4;
+  unsigned char pad[64];
+  uint32_t acc[8];
+  sha256_t ctx;
+  uint32_t j;
+  size_t i;
+
+  ASSERT(hash_size == 28 || hash_size == 32);
+
+  memset(pad, 0, sizeof(pad));
+  memcpy(pad, block, hash_size);
+
+  pad[hash_size] = 0x80;
+
+  write64be(pad + 56, (64 + hash_size) * 8);
+
+  for (i = 0; i < words; i++)
+    acc[i] = read32be(block + i * 4);
+
+  for (j = 1; j < iter; j++) {
+    memcpy(ctx.state, inner->state, sizeof(ctx.state));
+
+    ctx.size = inner->size;
+
+    sha256_update(&ctx, pad, 64);
+
+    for (i = 0; i < words; i++)
+      write32be(pad + i * 4, ctx.state[i]);
+
+    memcpy(ctx.state, outer->state, sizeof(ctx.state));
+
+    ctx.size = outer->size;
+
+    sha256_update(&ctx, pad, 64);
+
+    for (i = 0; i < words; i++) {
+      acc[i] ^= ctx.state[i];
+      write32be(pad + i * 4, ctx.state[i]);
+    }
+  }
+
+  for (i = 0; i < words; i++)
+    write32be(block + i * 4, acc[i]);
+
+  torsion_memzero(pad, sizeof(pad));
+  torsion_memzero(acc, sizeof(acc));
+  torsion_memzero(&ctx, sizeof(ctx));
+}
+
+static void
+pbkdf2_sha512(unsigned char *block,
+              const hmac_t *pmac,
+              uint32_t iter,
+              size_t hash_size) {
+  /* Same as above, but for HMAC-SHA512 (or SHA384). */
+  const sha512_t *inner = &pmac->inner.ctx.sha512;
+  const sha512_t *outer = &pmac->outer.ctx.sha512;
+  size_t words = hash_size / 8;
+  unsigned char pad[128];
+  uint64_t acc[8];
+  sha512_t ctx;
+  uint32_t j;
+  size_t i;
+
+  ASSERT(hash_size == 48 || hash_size == 64);
+
+  memset(pad, 0, sizeof(pad));
+  memcpy(pad, block, hash_size);
+
+  pad[hash_size] = 0x80;
+
+  write64be(pad + 120, (128 + hash_size) * 8);
+
+  for (i = 0; i < words; i++)
+    acc[i] = read64be(block + i * 8);
+
+  for (j = 1; j < iter; j++) {
+    memcpy(ctx.state, inner->state, sizeof(ctx.state));
+
+    ctx.size[0] = inner->size[0];
+    ctx.size[1] = inner->size[1];
+
+    sha512_update(&ctx, pad, 128);
+
+    for (i = 0; i < words; i++)
+      write64be(pad + i * 8, ctx.state[i]);
+
+    memcpy(ctx.state, outer->state, sizeof(ctx.state));
+
+    ctx.size[0] = outer->size[0];
+    ctx.size[1] = outer->size[1];
+
+    sha512_update(&ctx, pad, 128);
+
+    for (i = 0; i < words; i++) {
+      acc[i] ^= ctx.state[i];
+      write64be(pad + i * 8, ctx.state[i]);
+    }
+  }
+
+  for (i = 0; i < words; i++)
+    write64be(block + i * 8, acc[i]);
+
+  torsion_memzero(pad, sizeof(pad));
+  torsion_memzero(acc, sizeof(acc));
+  torsion_memzero(&ctx, sizeof(ctx));
+}
+
 int
 pbkdf2_derive(unsigned char *out,
               hash_id_t type,
@@ -738,15 +999,28 @@ pbkdf2_derive(unsigned char *out,
     hmac_update(&hmac, ctr, 4);
     hmac_final(&hmac, block);
 
-    memcpy(mac, block, hash_size);
+    switch (type) {
+      case HASH_SHA224:
+      case HASH_SHA256:
+        pbkdf2_sha256(block, &pmac, iter, hash_size);
+        break;
+      case HASH_SHA384:
+      case HASH_SHA512:
+        pbkdf2_sha512(block, &pmac, iter, hash_size);
+        break;
+      default:
+        memcpy(mac, block, hash_size);
+
+        for (j = 1; j < iter; j++) {
+          hmac = pmac;
+          hmac_update(&hmac, mac, hash_size);
+          hmac_final(&hmac, mac);
 
-    for (j = 1; j < iter; j++) {
-      hmac = pmac;
-      hmac_update(&hmac, mac, hash_size);
-      hmac_final(&hmac, mac);
+          for (k = 0; k < hash_size; k++)
+            block[k] ^= mac[k];
+        }
 
-      for (k = 0; k < hash_size; k++)
-        block[k] ^= mac[k];
+        break;
     }
 
     if (hash_size > len)
@@ -913,229 +1187,255 @@ pgpdf_derive_iterated(unsigned char *out,
  *   http://www.tarsnap.com/scrypt.html
  *   http://www.tarsnap.com/scrypt/scrypt.pdf
  *   https://github.com/Tarsnap/scrypt/blob/master/lib/crypto/crypto_scrypt-ref.c
+ *   https://github.com/Tarsnap/scrypt/blob/master/lib/crypto/crypto_scrypt_smix_sse2.c
  */
 
-static void blkcpy(uint8_t *, const uint8_t *, size_t);
-static void blkxor(uint8_t *, const uint8_t *, size_t);
-static void salsa20_8(uint8_t *);
-static void blockmix_salsa8(uint8_t *, uint8_t *, size_t);
-static uint64_t integerify(const uint8_t *, size_t);
-static void smix(uint8_t *, size_t, uint64_t, uint8_t *, uint8_t *);
-
-int
-scrypt_derive(unsigned char *out,
-              const unsigned char *pass,
-              size_t pass_len,
-              const unsigned char *salt,
-              size_t salt_len,
-              uint64_t N,
-              uint32_t r,
-              uint32_t p,
-              size_t len) {
-  hash_id_t t = HASH_SHA256;
-  uint8_t *B = NULL;
-  uint8_t *V = NULL;
-  uint8_t *XY = NULL;
-  size_t R = r;
-  size_t P = p;
-  int ret = 0;
-  size_t i;
-
-  if (N == 0 || R == 0 || P == 0)
-    return 0;
-
-  if (len + 31 < len || (len + 31) / 32 > UINT32_MAX)
-    return 0;
-
-  if ((uint64_t)R * (uint64_t)P >= (UINT64_C(1) << 30))
-    return 0;
-
-  if (R > SIZE_MAX / 128 / P)
-    return 0;
-
-  if (R > SIZE_MAX / 256)
-    return 0;
+/* Blocks are kept as native 32-bit words for the
+ * duration of smix, stored in the diagonal order
+ * used by the Tarsnap SSE2 implementation: word i
+ * of each 64-byte block holds salsa word (5 * i) % 16.
+ * This lets the salsa20/8 core operate on four
+ * independent quarter-rounds per step, which maps
+ * onto 128-bit vectors when GNU C vector extensions
+ * are available.
+ *
+ * Note that blockmix is inherently sequential
+ * across the 2r sub-blocks, so wider vectors (AVX2)
+ * do not help here.
+ */
 
-  if (N > SIZE_MAX / 128 / R)
-    return 0;
+#if defined(__clang__) && TORSION_HAS_BUILTIN(__builtin_shufflevector)
+#  define SCRYPT_HAVE_VECTOR
+typedef uint32_t scrypt_vec_t __attribute__((vector_size(16)));
+#  define vec_rotl(x, n) \
+    __builtin_shufflevector(x, x, n, (n + 1) & 3, (n + 2) & 3, (n + 3) & 3)
+#elif defined(__GNUC__) && TORSION_GNUC_PREREQ(4, 7)
+#  define SCRYPT_HAVE_VECTOR
+typedef uint32_t scrypt_vec_t __attribute__((vector_size(16)));
+static const scrypt_vec_t scrypt_rotl[4] = {
+  {0, 1, 2, 3},
+  {1, 2, 3, 0},
+  {2, 3, 0, 1},
+  {3, 0, 1, 2}
+};
+#  define vec_rotl(x, n) __builtin_shuffle(x, scrypt_rotl[n])
+#endif
 
-  if ((N & (N - 1)) != 0)
-    return 0;
+#define ROTL32(x, y) (((x) << (y)) | ((x) >> (32 - (y))))
 
-  if (len == 0)
-    return 1;
+static void
+blkcpy(uint32_t *dst, const uint32_t *src, size_t len) {
+  memcpy(dst, src, len * sizeof(uint32_t));
+}
 
-  B = (uint8_t *)malloc(128 * R * P);
-  XY = (uint8_t *)malloc(256 * R);
-  V = (uint8_t *)malloc(128 * R * N);
+static void
+blkxor(uint32_t *dst, const uint32_t *src, size_t len) {
+  size_t i;
 
-  if (B == NULL || XY == NULL || V == NULL)
-    goto fail;
+  for (i = 0; i < len; i++)
+    dst[i] ^= src[i];
+}
 
-  if (!pbkdf2_derive(B, t, pass, pass_len, salt, salt_len, 1, P * 128 * R))
-    goto fail;
+#if defined(SCRYPT_HAVE_VECTOR)
+static void
+salsa20_8(uint32_t *B) {
+  scrypt_vec_t a, b, c, d;
+  scrypt_vec_t w, x, y, z;
+  int i;
 
-  for (i = 0; i < P; i++)
-    smix(&B[i * 128 * R], R, N, V, XY);
+  memcpy(&a, &B[0], 16);
+  memcpy(&b, &B[4], 16);
+  memcpy(&c, &B[8], 16);
+  memcpy(&d, &B[12], 16);
 
-  if (!pbkdf2_derive(out, t, pass, pass_len, B, P * 128 * R, 1, len))
-    goto fail;
+  w = a;
+  x = b;
+  y = c;
+  z = d;
 
-  ret = 1;
-fail:
-  if (B != NULL) {
-    torsion_memzero(B, 128 * R * P);
-    free(B);
-  }
+  for (i = 0; i < 8; i += 2) {
+    /* Operate on columns. */
+    x ^= ROTL32(w + z, 7);
+    y ^= ROTL32(x + w, 9);
+    z ^= ROTL32(y + x, 13);
+    w ^= ROTL32(z + y, 18);
 
-  if (XY != NULL) {
-    torsion_memzero(XY, 256 * R);
-    free(XY);
-  }
+    x = vec_rotl(x, 3);
+    y = vec_rotl(y, 2);
+    z = vec_rotl(z, 1);
 
-  if (V != NULL) {
-    torsion_memzero(V, 128 * R * N);
-    free(V);
+    /* Operate on rows. */
+    z ^= ROTL32(w + x, 7);
+    y ^= ROTL32(z + w, 9);
+    x ^= ROTL32(y + z, 13);
+    w ^= ROTL32(x + y, 18);
+
+    x = vec_rotl(x, 1);
+    y = vec_rotl(y, 2);
+    z = vec_rotl(z, 3);
   }
 
-  return ret;
-}
-
-static void
-blkcpy(uint8_t *dst, const uint8_t *src, size_t len) {
-  size_t i;
-
-  for (i = 0; i < len; i++)
-    dst[i] = src[i];
-}
-
-static void
-blkxor(uint8_t *dst, const uint8_t *src, size_t len) {
-  size_t i;
+  a += w;
+  b += x;
+  c += y;
+  d += z;
 
-  for (i = 0; i < len; i++)
-    dst[i] ^= src[i];
+  memcpy(&B[0], &a, 16);
+  memcpy(&B[4], &b, 16);
+  memcpy(&B[8], &c, 16);
+  memcpy(&B[12], &d, 16);
 }
+#else /* !SCRYPT_HAVE_VECTOR */
+/* Salsa word i lives at index (13 * i) % 16. */
+#define S(i) x[((i) * 13) & 15]
 
 static void
-salsa20_8(uint8_t *B) {
-  uint32_t B32[16];
+salsa20_8(uint32_t *B) {
   uint32_t x[16];
   int i;
 
-  /* Convert little-endian values in. */
   for (i = 0; i < 16; i++)
-    B32[i] = read32le(&B[i * 4]);
-
-  /* Compute x = doubleround^4(B32). */
-  for (i = 0; i < 16; i++)
-    x[i] = B32[i];
+    x[i] = B[i];
 
   for (i = 0; i < 8; i += 2) {
-#define R(a, b) (((a) << (b)) | ((a) >> (32 - (b))))
     /* Operate on columns. */
-    x[ 4] ^= R(x[ 0] + x[12],  7);
-    x[ 8] ^= R(x[ 4] + x[ 0],  9);
-    x[12] ^= R(x[ 8] + x[ 4], 13);
-    x[ 0] ^= R(x[12] + x[ 8], 18);
-
-    x[ 9] ^= R(x[ 5] + x[ 1],  7);
-    x[13] ^= R(x[ 9] + x[ 5],  9);
-    x[ 1] ^= R(x[13] + x[ 9], 13);
-    x[ 5] ^= R(x[ 1] + x[13], 18);
-
-    x[14] ^= R(x[10] + x[ 6],  7);
-    x[ 2] ^= R(x[14] + x[10],  9);
-    x[ 6] ^= R(x[ 2] + x[14], 13);
-    x[10] ^= R(x[ 6] + x[ 2], 18);
-
-    x[ 3] ^= R(x[15] + x[11],  7);
-    x[ 7] ^= R(x[ 3] + x[15],  9);
-    x[11] ^= R(x[ 7] + x[ 3], 13);
-    x[15] ^= R(x[11] + x[ 7], 18);
+    S( 4) ^= ROTL32(S( 0) + S(12),  7);
+    S( 8) ^= ROTL32(S( 4) + S( 0),  9);
+    S(12) ^= ROTL32(S( 8) + S( 4), 13);
+    S( 0) ^= ROTL32(S(12) + S( 8), 18);
+
+    S( 9) ^= ROTL32(S( 5) + S( 1),  7);
+    S(13) ^= ROTL32(S( 9) + S( 5),  9);
+    S( 1) ^= ROTL32(S(13) + S( 9), 13);
+    S( 5) ^= ROTL32(S( 1) + S(13), 18);
+
+    S(14) ^= ROTL32(S(10) + S( 6),  7);
+    S( 2) ^= ROTL32(S(14) + S(10),  9);
+    S( 6) ^= ROTL32(S( 2) + S(14), 13);
+    S(10) ^= ROTL32(S( 6) + S( 2), 18);
+
+    S( 3) ^= ROTL32(S(15) + S(11),  7);
+    S( 7) ^= ROTL32(S( 3) + S(15),  9);
+    S(11) ^= ROTL32(S( 7) + S( 3), 13);
+    S(15) ^= ROTL32(S(11) + S( 7), 18);
 
     /* Operate on rows. */
-    x[ 1] ^= R(x[ 0] + x[ 3],  7);
-    x[ 2] ^= R(x[ 1] + x[ 0],  9);
-    x[ 3] ^= R(x[ 2] + x[ 1], 13);
-    x[ 0] ^= R(x[ 3] + x[ 2], 18);
-
-    x[ 6] ^= R(x[ 5] + x[ 4],  7);
-    x[ 7] ^= R(x[ 6] + x[ 5],  9);
-    x[ 4] ^= R(x[ 7] + x[ 6], 13);
-    x[ 5] ^= R(x[ 4] + x[ 7], 18);
-
-    x[11] ^= R(x[10] + x[ 9],  7);
-    x[ 8] ^= R(x[11] + x[10],  9);
-    x[ 9] ^= R(x[ 8] + x[11], 13);
-    x[10] ^= R(x[ 9] + x[ 8], 18);
-
-    x[12] ^= R(x[15] + x[14],  7);
-    x[13] ^= R(x[12] + x[15],  9);
-    x[14] ^= R(x[13] + x[12], 13);
-    x[15] ^= R(x[14] + x[13], 18);
-#undef R
+    S( 1) ^= ROTL32(S( 0) + S( 3),  7);
+    S( 2) ^= ROTL32(S( 1) + S( 0),  9);
+    S( 3) ^= ROTL32(S( 2) + S( 1), 13);
+    S( 0) ^= ROTL32(S( 3) + S( 2), 18);
+
+    S( 6) ^= ROTL32(S( 5) + S( 4),  7);
+    S( 7) ^= ROTL32(S( 6) + S( 5),  9);
+    S( 4) ^= ROTL32(S( 7) + S( 6), 13);
+    S( 5) ^= ROTL32(S( 4) + S( 7), 18);
+
+    S(11) ^= ROTL32(S(10) + S( 9),  7);
+    S( 8) ^= ROTL32(S(11) + S(10),  9);
+    S( 9) ^= ROTL32(S( 8) + S(11), 13);
+    S(10) ^= ROTL32(S( 9) + S( 8), 18);
+
+    S(12) ^= ROTL32(S(15) + S(14),  7);
+    S(13) ^= ROTL32(S(12) + S(15),  9);
+    S(14) ^= ROTL32(S(13) + S(12), 13);
+    S(15) ^= ROTL32(S(14) + S(13), 18);
   }
 
-  /* Compute B32 = B32 + x. */
   for (i = 0; i < 16; i++)
-    B32[i] += x[i];
-
-  /* Convert little-endian values out. */
-  for (i = 0; i < 16; i++)
-    write32le(&B[4 * i], B32[i]);
+    B[i] += x[i];
 }
 
+#undef S
+#endif /* !SCRYPT_HAVE_VECTOR */
+
 static void
-blockmix_salsa8(uint8_t *B, uint8_t *Y, size_t r) {
-  uint8_t X[64];
+blockmix_salsa8(const uint32_t *B, uint32_t *Y, size_t r) {
+  uint32_t X[16];
   size_t i;
 
   /* 1: X <-- B_{2r - 1} */
-  blkcpy(X, &B[(2 * r - 1) * 64], 64);
+  blkcpy(X, &B[(2 * r - 1) * 16], 16);
 
   /* 2: for i = 0 to 2r - 1 do */
-  for (i = 0; i < 2 * r; i++) {
+  for (i = 0; i < 2 * r; i += 2) {
     /* 3: X <-- H(X \xor B_i) */
-    blkxor(X, &B[i * 64], 64);
+    blkxor(X, &B[i * 16], 16);
     salsa20_8(X);
 
     /* 4: Y_i <-- X */
-    blkcpy(&Y[i * 64], X, 64);
+    /* 6: B' <-- (Y_0, Y_2 ... Y_{2r-2}, Y_1, Y_3 ... Y_{2r-1}) */
+    blkcpy(&Y[i * 8], X, 16);
+
+    /* 3: X <-- H(X \xor B_i) */
+    blkxor(X, &B[i * 16 + 16], 16);
+    salsa20_8(X);
+
+    /* 4: Y_i <-- X */
+    /* 6: B' <-- (Y_0, Y_2 ... Y_{2r-2}, Y_1, Y_3 ... Y_{2r-1}) */
+    blkcpy(&Y[i * 8 + r * 16], X, 16);
   }
+}
+
+static void
+blockmix_salsa8_xor(const uint32_t *B,
+                    const uint32_t *V,
+                    uint32_t *Y,
+                    size_t r) {
+  /* Same as above, with B \xor V computed on the fly. */
+  uint32_t X[16];
+  size_t i;
+
+  blkcpy(X, &B[(2 * r - 1) * 16], 16);
+  blkxor(X, &V[(2 * r - 1) * 16], 16);
 
-  /* 6: B' <-- (Y_0, Y_2 ... Y_{2r-2}, Y_1, Y_3 ... Y_{2r-1}) */
-  for (i = 0; i < r; i++)
-    blkcpy(&B[i * 64], &Y[(i * 2) * 64], 64);
+  for (i = 0; i < 2 * r; i += 2) {
+    blkxor(X, &B[i * 16], 16);
+    blkxor(X, &V[i * 16], 16);
+    salsa20_8(X);
 
-  for (i = 0; i < r; i++)
-    blkcpy(&B[(i + r) * 64], &Y[(i * 2 + 1) * 64], 64);
+    blkcpy(&Y[i * 8], X, 16);
+
+    blkxor(X, &B[i * 16 + 16], 16);
+    blkxor(X, &V[i * 16 + 16], 16);
+    salsa20_8(X);
+
+    blkcpy(&Y[i * 8 + r * 16], X, 16);
+  }
 }
 
 static uint64_t
-integerify(const uint8_t *B, size_t r) {
-  const uint8_t *X = &B[(2 * r - 1) * 64];
+integerify(const uint32_t *B, size_t r) {
+  /* Salsa words 0 and 1 live at indices 0 and 13. */
+  const uint32_t *X = &B[(2 * r - 1) * 16];
 
-  return read64le(X);
+  return ((uint64_t)X[13] << 32) | X[0];
 }
 
 static void
-smix(uint8_t *B, size_t r, uint64_t N, uint8_t *V, uint8_t *XY) {
-  uint8_t *X = XY;
-  uint8_t *Y = &XY[128 * r];
-  uint64_t i;
-  uint64_t j;
+smix(uint8_t *B, size_t r, uint64_t N, uint32_t *V, uint32_t *XY) {
+  uint32_t *X = XY;
+  uint32_t *Y = &XY[32 * r];
+  uint32_t *Z;
+  uint64_t i, j;
+  size_t k;
 
   /* 1: X <-- B */
-  blkcpy(X, B, 128 * r);
+  for (k = 0; k < 2 * r; k++) {
+    for (i = 0; i < 16; i++)
+      X[k * 16 + i] = read32le(&B[k * 64 + ((i * 5) & 15) * 4]);
+  }
 
   /* 2: for i = 0 to N - 1 do */
   for (i = 0; i < N; i++) {
     /* 3: V_i <-- X */
-    blkcpy(&V[i * (128 * r)], X, 128 * r);
+    blkcpy(&V[i * (32 * r)], X, 32 * r);
 
     /* 4: X <-- H(X) */
     blockmix_salsa8(X, Y, r);
+
+    Z = X;
+    X = Y;
+    Y = Z;
   }
 
   /* 6: for i = 0 to N - 1 do */
@@ -1144,10 +1444,190 @@ smix(uint8_t *B, size_t r, uint64_t N, uint8_t *V, uint8_t *XY) {
     j = integerify(X, r) & (N - 1);
 
     /* 8: X <-- H(X \xor V_j) */
-    blkxor(X, &V[j * (128 * r)], 128 * r);
-    blockmix_salsa8(X, Y, r);
+    blockmix_salsa8_xor(X, &V[j * (32 * r)], Y, r);
+
+    Z = X;
+    X = Y;
+    Y = Z;
   }
 
   /* 10: B' <-- X */
-  blkcpy(B, X, 128 * r);
+  for (k = 0; k < 2 * r; k++) {
+    for (i = 0; i < 16; i++)
+      write32le(&B[k * 64 + ((i * 5) & 15) * 4], X[k * 16 + i]);
+  }
+}
+
+/* Scratch space is aligned to a cache line so that
+ * no block of V straddles two of them. We do not ask
+ * for huge pages: doing so requires platform calls
+ * (madvise, VirtualAlloc) which have no place in this
+ * module, and Linux already backs large anonymous
+ * allocations with transparent huge pages when they
+ * are enabled.
+ */
+#define SCRYPT_ALIGN 64
+
+typedef struct scrypt_job_s {
+  uint8_t *B;
+  size_t r;
+  uint64_t N;
+  uint32_t *XY;
+  uint32_t *V;
+  int done;
+} scrypt_job_t;
+
+static void
+scrypt_job(void *ptr) {
+  scrypt_job_t *job = (scrypt_job_t *)ptr;
+
+  smix(job->B, job->r, job->N, job->V, job->XY);
+
+  job->done = 1;
+}
+
+int
+scrypt_derive(unsigned char *out,
+              const unsigned char *pass,
+              size_t pass_len,
+              const unsigned char *salt,
+              size_t salt_len,
+              uint64_t N,
+              uint32_t r,
+              uint32_t p,
+              size_t len) {
+  return scrypt_derive_with_runner(out, pass, pass_len, salt, salt_len,
+                                   N, r, p, len, NULL, NULL);
+}
+
+int
+scrypt_derive_with_runner(unsigned char *out,
+                          const unsigned char *pass,
+                          size_t pass_len,
+                          const unsigned char *salt,
+                          size_t salt_len,
+                          uint64_t N,
+                          uint32_t r,
+                          uint32_t p,
+                          size_t len,
+                          kdf_run_f *run,
+                          void *arg) {
+  hash_id_t t = HASH_SHA256;
+  scrypt_job_t *jobs = NULL;
+  void **args = NULL;
+  uint8_t *B = NULL;
+  uint8_t *mem = NULL;
+  uint8_t *scratch;
+  size_t R = r;
+  size_t P = p;
+  size_t lanes = run != NULL ? P : 1;
+  size_t size, total;
+  int ret = 0;
+  size_t i;
+
+  if (N == 0 || R == 0 || P == 0)
+    return 0;
+
+  if (len + 31 < len || (len + 31) / 32 > UINT32_MAX)
+    return 0;
+
+  if ((uint64_t)R * (uint64_t)P >= (UINT64_C(1) << 30))
+    return 0;
+
+  if (R > SIZE_MAX / 128 / P)
+    return 0;
+
+  if (R > SIZE_MAX / 256)
+    return 0;
+
+  if (N > SIZE_MAX / 128 / R)
+    return 0;
+
+  if ((N & (N - 1)) != 0)
+    return 0;
+
+  if (len == 0)
+    return 1;
+
+  /* Each lane needs XY (256 * r) and V (128 * r * N). */
+  size = 128 * R * N;
+
+  if (size > SIZE_MAX - 256 * R - (SCRYPT_ALIGN - 1))
+    return 0;
+
+  size += 256 * R;
+
+  if (lanes > (SIZE_MAX - (SCRYPT_ALIGN - 1)) / size)
+    return 0;
+
+  if (lanes > SIZE_MAX / sizeof(scrypt_job_t))
+    return 0;
+
+  total = lanes * size + (SCRYPT_ALIGN - 1);
+
+  B = (uint8_t *)malloc(128 * R * P);
+  mem = (uint8_t *)malloc(total);
+  jobs = (scrypt_job_t *)malloc(lanes * sizeof(scrypt_job_t));
+  args = (void **)malloc(lanes * sizeof(void *));
+
+  if (B == NULL || mem == NULL || jobs == NULL || args == NULL)
+    goto fail;
+
+  scratch = (uint8_t *)(((uintptr_t)mem + (SCRYPT_ALIGN - 1))
+                       & ~(uintptr_t)(SCRYPT_ALIGN - 1));
+
+  if (!pbkdf2_derive(B, t, pass, pass_len, salt, salt_len, 1, P * 128 * R))
+    goto fail;
+
+  for (i = 0; i < P; i++) {
+    scrypt_job_t *job = &jobs[i % lanes];
+
+    job->B = &B[i * 128 * R];
+    job->r = R;
+    job->N = N;
+    job->XY = (uint32_t *)&scratch[(i % lanes) * size];
+    job->V = &job->XY[64 * R];
+    job->done = 0;
+
+    if (run != NULL)
+      args[i] = job;
+    else
+      scrypt_job(job);
+  }
+
+  if (run != NULL) {
+    run(scrypt_job, args, P, arg);
+
+    for (i = 0; i < P; i++) {
+      if (!jobs[i].done)
+        goto fail;
+    }
+  }
+
+  if (!pbkdf2_derive(out, t, pass, pass_len, B, P * 128 * R, 1, len))
+    goto fail;
+
+  ret = 1;
+fail:
+  if (B != NULL) {
+    torsion_memzero(B, 128 * R * P);
+    free(B);
+  }
+
+  if (mem != NULL) {
+    torsion_memzero(mem, total);
+    free(mem);
+  }
+
+  if (jobs != NULL)
+    free(jobs);
+
+  if (args != NULL)
+    free(args);
+
+  return ret;
 }
+
+#undef ROTL32
+#undef vec_rotl
+#undef SCRYPT_ALIGN
@@ -44,6 +44,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 
+#include "entropy/entropy.h"
 #include "internal.h"
 #include "mpi.h"
 
@@ -62,6 +63,12 @@
 STATIC_ASSERT((-1 & 3) == 3);
 STATIC_ASSERT((0u - 1u) == UINT_MAX);
 
+/* Required for the bound in MPN_MUL_N_ITCH. */
+STATIC_ASSERT(MP_MUL_KARATSUBA_THRESHOLD >= 16);
+STATIC_ASSERT(MP_SQR_KARATSUBA_THRESHOLD >= 16);
+STATIC_ASSERT(MP_MUL_TOOM3_THRESHOLD >= 36);
+STATIC_ASSERT(MP_SQR_TOOM3_THRESHOLD >= 36);
+
 /*
  * Options
  */
@@ -146,6 +153,11 @@ TORSION_BARRIER(mp_limb_t, mp_limb)
 #  define MP_HAVE_ASM_X64
 #endif
 
+#if defined(MP_HAVE_ASM_X64)
+/* MULX/ADCX/ADOX kernels, selected at runtime. */
+#  define MP_HAVE_ADX
+#endif
+
 #if defined(MP_HAVE_ASM_X64) && !defined(__clang__)
 /* For some reason clang sucks at inlining ASM, but
    is extremely good at generating 128 bit carry code.
@@ -1619,10 +1631,81 @@ mpn_mul_1(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn, mp_limb_t y) {
   return c;
 }
 
+#if defined(MP_HAVE_ADX)
+static mp_limb_t
+mpn_addmul_1_adx(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn, mp_limb_t y) {
+  /* [z, c] = z + x * y with two carry chains.
+   *
+   * The low half of each product is added to the
+   * high half of the previous one on the CF chain
+   * (ADCX) while `z` is accumulated on the OF chain
+   * (ADOX). MULX leaves the flags untouched, so the
+   * chains run interleaved without any flag saves.
+   */
+  mp_limb_t c = 0;
+  mp_limb_t n;
+
+  switch (xn & 3) {
+    case 3:
+      mp_addmul_1(*zp, c, *xp, y); zp++; xp++;
+    case 2:
+      mp_addmul_1(*zp, c, *xp, y); zp++; xp++;
+    case 1:
+      mp_addmul_1(*zp, c, *xp, y); zp++; xp++;
+  }
+
+  /* Widen: mp_size_t is 32 bits on LLP64, the loop uses all of %rcx. */
+  n = xn >> 2;
+
+  if (n == 0)
+    return c;
+
+  __asm__ __volatile__ (
+    "xorl %%r8d, %%r8d\n"
+    "1:\n"
+    "mulxq (%q2), %%r8, %%r9\n"
+    "adcxq %q0, %%r8\n"
+    "adoxq (%q1), %%r8\n"
+    "movq %%r8, (%q1)\n"
+    "mulxq 8(%q2), %%r10, %q0\n"
+    "adcxq %%r9, %%r10\n"
+    "adoxq 8(%q1), %%r10\n"
+    "movq %%r10, 8(%q1)\n"
+    "mulxq 16(%q2), %%r8, %%r9\n"
+    "adcxq %q0, %%r8\n"
+    "adoxq 16(%q1), %%r8\n"
+    "movq %%r8, 16(%q1)\n"
+    "mulxq 24(%q2), %%r10, %q0\n"
+    "adcxq %%r9, %%r10\n"
+    "adoxq 24(%q1), %%r10\n"
+    "movq %%r10, 24(%q1)\n"
+    "leaq 32(%q2), %q2\n"
+    "leaq 32(%q1), %q1\n"
+    "leaq -1(%%rcx), %%rcx\n"
+    "jrcxz 2f\n"
+    "jmp 1b\n"
+    "2:\n"
+    "movl $0, %%r8d\n"
+    "adcxq %%r8, %q0\n"
+    "adoxq %%r8, %q0\n"
+    : "+&r" (c), "+&r" (zp), "+&r" (xp), "+c" (n)
+    : "d" (y)
+    : "cc", "memory", "r8", "r9", "r10"
+  );
+
+  return c;
+}
+#endif /* MP_HAVE_ADX */
+
 mp_limb_t
 mpn_addmul_1(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn, mp_limb_t y) {
   mp_limb_t c = 0;
 
+#if defined(MP_HAVE_ADX)
+  if (xn >= 4 && torsion_has_adx())
+    return mpn_addmul_1_adx(zp, xp, xn, y);
+#endif
+
   switch (xn & 3) {
     case 3:
       mp_addmul_1(*zp, c, *xp, y); zp++; xp++;
@@ -1677,16 +1760,9 @@ mpn_submul_1(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn, mp_limb_t y) {
   return c;
 }
 
-void
-mpn_mul_n(mp_limb_t *zp, const mp_limb_t *xp,
-                         const mp_limb_t *yp,
-                         mp_size_t n) {
-  mpn_mul(zp, xp, n, yp, n);
-}
-
-void
-mpn_mul(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
-                       const mp_limb_t *yp, mp_size_t yn) {
+static void
+mpn_mul_basecase(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
+                                const mp_limb_t *yp, mp_size_t yn) {
   mp_size_t i;
 
   if (UNLIKELY(yn == 0)) {
@@ -1700,8 +1776,9 @@ mpn_mul(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
     zp[xn + i] = mpn_addmul_1(zp + i, xp, xn, yp[i]);
 }
 
-void
-mpn_sqr(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn, mp_limb_t *scratch) {
+static void
+mpn_sqr_basecase(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
+                                mp_limb_t *scratch) {
   /* `2 * xn` limbs are required for scratch. */
   mp_limb_t *tp = scratch;
   mp_size_t i;
@@ -1731,6 +1808,418 @@ mpn_sqr(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn, mp_limb_t *scratch) {
   ASSERT(mpn_add_n(zp, zp, tp, 2 * xn) == 0);
 }
 
+static void
+mpn_mul_n_inner(mp_limb_t *zp, const mp_limb_t *xp,
+                               const mp_limb_t *yp,
+                               mp_size_t n,
+                               mp_limb_t *scratch);
+
+static void
+mpn_sqr_inner(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t n,
+                             mp_limb_t *scratch);
+
+static void
+mpn_kara_mul_n(mp_limb_t *zp, const mp_limb_t *xp,
+                              const mp_limb_t *yp,
+                              mp_size_t n,
+                              mp_limb_t *scratch) {
+  /* Karatsuba multiplication.
+   *
+   * [KNUTH] Page 295, Section 4.3.3.
+   *
+   * Let x = x1 * B^h + x0 and y = y1 * B^h + y0.
+   *
+   *   x * y = z2 * B^(2 * h) + (z0 + z2 - d) * B^h + z0
+   *
+   * Where:
+   *
+   *   z0 = x0 * y0
+   *   z2 = x1 * y1
+   *   d = (x0 - x1) * (y0 - y1)
+   *
+   * The signs of the differences are handled with
+   * masks, so the only branches are on `n`. This
+   * keeps the algorithm usable for secret operands.
+   *
+   * `MPN_MUL_N_ITCH(n)` limbs are required for scratch.
+   */
+  mp_size_t h = n - n / 2;
+  mp_size_t l = n / 2;
+  mp_size_t dn = 2 * h + 1;
+  mp_limb_t *dx = zp;
+  mp_limb_t *dy = zp + h;
+  mp_limb_t *dp = scratch;
+  mp_limb_t *tp = scratch + dn;
+  mp_limb_t *sp = scratch + 2 * dn;
+  mp_limb_t sx, sy;
+
+  /* dx = |x0 - x1|, dy = |y0 - y1| */
+  sx = mpn_sec_sub(dx, xp, h, xp + h, l);
+  sy = mpn_sec_sub(dy, yp, h, yp + h, l);
+
+  mpn_cnd_neg(dx, dx, h, sx);
+  mpn_cnd_neg(dy, dy, h, sy);
+
+  /* d = dx * dy */
+  mpn_mul_n_inner(dp, dx, dy, h, sp);
+
+  dp[2 * h] = 0;
+
+  /* z0 = x0 * y0, z2 = x1 * y1 */
+  mpn_mul_n_inner(zp, xp, yp, h, sp);
+  mpn_mul_n_inner(zp + 2 * h, xp + h, yp + h, l, sp);
+
+  /* t = z0 + z2 - (-1)^(sx + sy) * d */
+  tp[2 * h] = mpn_sec_add(tp, zp, 2 * h, zp + 2 * h, 2 * l);
+
+  mpn_cnd_neg(dp, dp, dn, (sx ^ sy) ^ 1);
+  mpn_add_n(tp, tp, dp, dn);
+
+  /* z += t * B^h */
+  ASSERT(mpn_sec_add(zp + h, zp + h, 2 * n - h, tp, dn) == 0);
+}
+
+static void
+mpn_kara_sqr(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t n,
+                            mp_limb_t *scratch) {
+  /* Karatsuba squaring.
+   *
+   * Identical to the above with x = y. The middle
+   * term is always z0 + z2 - (x0 - x1)^2.
+   */
+  mp_size_t h = n - n / 2;
+  mp_size_t l = n / 2;
+  mp_size_t dn = 2 * h + 1;
+  mp_limb_t *dx = zp;
+  mp_limb_t *dp = scratch;
+  mp_limb_t *tp = scratch + dn;
+  mp_limb_t *sp = scratch + 2 * dn;
+  mp_limb_t sx;
+
+  sx = mpn_sec_sub(dx, xp, h, xp + h, l);
+
+  mpn_cnd_neg(dx, dx, h, sx);
+
+  mpn_sqr_inner(dp, dx, h, sp);
+
+  dp[2 * h] = 0;
+
+  mpn_sqr_inner(zp, xp, h, sp);
+  mpn_sqr_inner(zp + 2 * h, xp + h, l, sp);
+
+  tp[2 * h] = mpn_sec_add(tp, zp, 2 * h, zp + 2 * h, 2 * l);
+
+  mpn_sub_n(tp, tp, dp, dn);
+
+  ASSERT(mpn_sec_add(zp + h, zp + h, 2 * n - h, tp, dn) == 0);
+}
+
+static void
+mpn_divexact_by3(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn) {
+  /* Exact division by 3 modulo B^xn (constant time). */
+  const mp_limb_t inv = MP_LIMB_MAX / 3 * 2 + 1;
+  mp_limb_t c = 0;
+  mp_limb_t s, q, hi, lo;
+  mp_size_t i;
+
+  for (i = 0; i < xn; i++) {
+    s = xp[i] - c;
+    c = (s > xp[i]);
+    q = s * inv;
+
+    mp_mul(hi, lo, q, 3);
+
+    (void)lo;
+
+    zp[i] = q;
+    c += hi;
+  }
+}
+
+static void
+mpn_toom3_interpolate(mp_limb_t *zp, mp_size_t n, mp_size_t k,
+                      mp_limb_t *v1, mp_limb_t *vm1,
+                      mp_limb_t *v2, mp_limb_t sm1) {
+  /* Toom-3 interpolation (Bodrato's sequence).
+   *
+   * On entry, `zp` holds v0 in its low 2*k limbs and
+   * vinf in its limbs starting at 4*k. v1, |vm1| and v2
+   * are 2*k+2 limbs each, and `sm1` is the sign of vm1.
+   *
+   * Only vm1 is signed. Its sign is folded in with a
+   * masked negation, after which every intermediate
+   * value is a non-negative integer below B^(2*k+2).
+   */
+  mp_size_t r = n - 2 * k;
+  mp_size_t m = 2 * k + 2;
+  mp_limb_t *v0 = zp;
+  mp_limb_t *vinf = zp + 4 * k;
+
+  mpn_zero(zp + 2 * k, 2 * k);
+
+  /* vm1 = -vm1 */
+  mpn_cnd_neg(vm1, vm1, m, sm1 ^ 1);
+
+  /* r3 = (v2 - vm1) / 3 */
+  mpn_add_n(v2, v2, vm1, m);
+  mpn_divexact_by3(v2, v2, m);
+
+  /* r1 = (v1 - vm1) / 2 */
+  mpn_add_n(vm1, v1, vm1, m);
+  mpn_rshift(vm1, vm1, m, 1);
+
+  /* r2 = v1 - v0 */
+  mpn_sec_sub(v1, v1, m, v0, 2 * k);
+
+  /* r3 = (r3 - r2) / 2 - 2 * vinf */
+  mpn_sub_n(v2, v2, v1, m);
+  mpn_rshift(v2, v2, m, 1);
+  mpn_sec_sub(v2, v2, m, vinf, 2 * r);
+  mpn_sec_sub(v2, v2, m, vinf, 2 * r);
+
+  /* r2 = r2 - r1 - vinf */
+  mpn_sub_n(v1, v1, vm1, m);
+  mpn_sec_sub(v1, v1, m, vinf, 2 * r);
+
+  /* r1 = r1 - r3 */
+  mpn_sub_n(vm1, vm1, v2, m);
+
+  /* z = v0 + r1 * B^k + r2 * B^(2*k) + r3 * B^(3*k) + vinf * B^(4*k) */
+  ASSERT(mpn_sec_add(zp + k, zp + k, 2 * n - k, vm1, m) == 0);
+  ASSERT(mpn_sec_add(zp + 2 * k, zp + 2 * k, 2 * n - 2 * k, v1, m) == 0);
+  ASSERT(mpn_sec_add(zp + 3 * k, zp + 3 * k, 2 * n - 3 * k,
+                     v2, MP_MIN(m, 2 * n - 3 * k)) == 0);
+}
+
+static void
+mpn_toom3_mul_n(mp_limb_t *zp, const mp_limb_t *xp,
+                               const mp_limb_t *yp,
+                               mp_size_t n,
+                               mp_limb_t *scratch) {
+  /* Toom-3 multiplication.
+   *
+   * [KNUTH] Page 296, Section 4.3.3 (Algorithm T).
+   * [TOOM] "Towards Optimal Toom-Cook Multiplication" (Bodrato).
+   *
+   * Splits into three pieces of k limbs and evaluates
+   * at 0, 1, -1, 2 and infinity. Like Karatsuba above,
+   * only `n` affects the control flow.
+   *
+   * `MPN_MUL_N_ITCH(n)` limbs are required for scratch.
+   */
+  mp_size_t k = (n + 2) / 3;
+  mp_size_t r = n - 2 * k;
+  mp_size_t m = 2 * k + 2;
+  const mp_limb_t *x0 = xp;
+  const mp_limb_t *x1 = xp + k;
+  const mp_limb_t *x2 = xp + 2 * k;
+  const mp_limb_t *y0 = yp;
+  const mp_limb_t *y1 = yp + k;
+  const mp_limb_t *y2 = yp + 2 * k;
+  mp_limb_t *v1 = scratch;
+  mp_limb_t *vm1 = v1 + m;
+  mp_limb_t *v2 = vm1 + m;
+  mp_limb_t *ax = v2 + m;
+  mp_limb_t *ay = ax + k + 1;
+  mp_limb_t *sp = ay + k + 1;
+  mp_limb_t sx, sy;
+
+  /* vm1 = |x(-1)| * |y(-1)| */
+  ax[k] = mpn_sec_add(ax, x0, k, x2, r);
+  ay[k] = mpn_sec_add(ay, y0, k, y2, r);
+
+  sx = mpn_sec_sub(ax, ax, k + 1, x1, k);
+  sy = mpn_sec_sub(ay, ay, k + 1, y1, k);
+
+  mpn_cnd_neg(ax, ax, k + 1, sx);
+  mpn_cnd_neg(ay, ay, k + 1, sy);
+
+  mpn_mul_n_inner(vm1, ax, ay, k + 1, sp);
+
+  /* v1 = x(1) * y(1) */
+  ax[k] = mpn_sec_add(ax, x0, k, x2, r);
+  ay[k] = mpn_sec_add(ay, y0, k, y2, r);
+
+  ax[k] += mpn_add_n(ax, ax, x1, k);
+  ay[k] += mpn_add_n(ay, ay, y1, k);
+
+  mpn_mul_n_inner(v1, ax, ay, k + 1, sp);
+
+  /* v2 = x(2) * y(2) */
+  mpn_copyi(ax, x2, r);
+  mpn_copyi(ay, y2, r);
+
+  mpn_zero(ax + r, k + 1 - r);
+  mpn_zero(ay + r, k + 1 - r);
+
+  mpn_lshift(ax, ax, k + 1, 1);
+  mpn_lshift(ay, ay, k + 1, 1);
+
+  ax[k] += mpn_add_n(ax, ax, x1, k);
+  ay[k] += mpn_add_n(ay, ay, y1, k);
+
+  mpn_lshift(ax, ax, k + 1, 1);
+  mpn_lshift(ay, ay, k + 1, 1);
+
+  ax[k] += mpn_add_n(ax, ax, x0, k);
+  ay[k] += mpn_add_n(ay, ay, y0, k);
+
+  mpn_mul_n_inner(v2, ax, ay, k + 1, sp);
+
+  /* v0 = x0 * y0, vinf = x2 * y2 */
+  mpn_mul_n_inner(zp, x0, y0, k, sp);
+  mpn_mul_n_inner(zp + 4 * k, x2, y2, r, sp);
+
+  mpn_toom3_interpolate(zp, n, k, v1, vm1, v2, sx ^ sy);
+}
+
+static void
+mpn_toom3_sqr(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t n,
+                             mp_limb_t *scratch) {
+  /* Toom-3 squaring. */
+  mp_size_t k = (n + 2) / 3;
+  mp_size_t r = n - 2 * k;
+  mp_size_t m = 2 * k + 2;
+  const mp_limb_t *x0 = xp;
+  const mp_limb_t *x1 = xp + k;
+  const mp_limb_t *x2 = xp + 2 * k;
+  mp_limb_t *v1 = scratch;
+  mp_limb_t *vm1 = v1 + m;
+  mp_limb_t *v2 = vm1 + m;
+  mp_limb_t *ax = v2 + m;
+  mp_limb_t *sp = ax + 2 * (k + 1);
+  mp_limb_t sx;
+
+  ax[k] = mpn_sec_add(ax, x0, k, x2, r);
+  sx = mpn_sec_sub(ax, ax, k + 1, x1, k);
+
+  mpn_cnd_neg(ax, ax, k + 1, sx);
+
+  mpn_sqr_inner(vm1, ax, k + 1, sp);
+
+  ax[k] = mpn_sec_add(ax, x0, k, x2, r);
+  ax[k] += mpn_add_n(ax, ax, x1, k);
+
+  mpn_sqr_inner(v1, ax, k + 1, sp);
+
+  mpn_copyi(ax, x2, r);
+  mpn_zero(ax + r, k + 1 - r);
+  mpn_lshift(ax, ax, k + 1, 1);
+
+  ax[k] += mpn_add_n(ax, ax, x1, k);
+
+  mpn_lshift(ax, ax, k + 1, 1);
+
+  ax[k] += mpn_add_n(ax, ax, x0, k);
+
+  mpn_sqr_inner(v2, ax, k + 1, sp);
+
+  mpn_sqr_inner(zp, x0, k, sp);
+  mpn_sqr_inner(zp + 4 * k, x2, r, sp);
+
+  mpn_toom3_interpolate(zp, n, k, v1, vm1, v2, 0);
+}
+
+static void
+mpn_mul_n_inner(mp_limb_t *zp, const mp_limb_t *xp,
+                               const mp_limb_t *yp,
+                               mp_size_t n,
+                               mp_limb_t *scratch) {
+  if (n < MP_MUL_KARATSUBA_THRESHOLD)
+    mpn_mul_basecase(zp, xp, n, yp, n);
+  else if (n < MP_MUL_TOOM3_THRESHOLD)
+    mpn_kara_mul_n(zp, xp, yp, n, scratch);
+  else
+    mpn_toom3_mul_n(zp, xp, yp, n, scratch);
+}
+
+static void
+mpn_sqr_inner(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t n,
+                             mp_limb_t *scratch) {
+  if (n < MP_SQR_KARATSUBA_THRESHOLD)
+    mpn_sqr_basecase(zp, xp, n, scratch);
+  else if (n < MP_SQR_TOOM3_THRESHOLD)
+    mpn_kara_sqr(zp, xp, n, scratch);
+  else
+    mpn_toom3_sqr(zp, xp, n, scratch);
+}
+
+void
+mpn_mul_n(mp_limb_t *zp, const mp_limb_t *xp,
+                         const mp_limb_t *yp,
+                         mp_size_t n) {
+  mpn_mul(zp, xp, n, yp, n);
+}
+
+void
+mpn_mul(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
+                       const mp_limb_t *yp, mp_size_t yn) {
+  /* Unbalanced products are computed as a series
+     of balanced products once the smaller operand
+     is large enough. */
+  mp_size_t tn, i;
+  mp_limb_t *tp;
+  mp_limb_t c;
+
+  if (xn < yn) {
+    const mp_limb_t *sp = xp;
+    mp_size_t sn = xn;
+
+    xp = yp;
+    xn = yn;
+    yp = sp;
+    yn = sn;
+  }
+
+  if (yn < MP_MUL_KARATSUBA_THRESHOLD) {
+    mpn_mul_basecase(zp, xp, xn, yp, yn);
+    return;
+  }
+
+  tn = 2 * yn + MPN_MUL_N_ITCH(yn);
+  tp = mp_alloc_vla(tn);
+
+  mpn_mul_n_inner(zp, xp, yp, yn, tp);
+
+  for (i = yn; i + yn <= xn; i += yn) {
+    mpn_mul_n_inner(tp, xp + i, yp, yn, tp + 2 * yn);
+
+    c = mpn_add_n(zp + i, zp + i, tp, yn);
+
+    mpn_sec_add_1(zp + i + yn, tp + yn, yn, c);
+  }
+
+  if (i < xn) {
+    mpn_mul(tp, yp, yn, xp + i, xn - i);
+
+    c = mpn_add_n(zp + i, zp + i, tp, yn);
+
+    mpn_sec_add_1(zp + i + yn, tp + yn, xn - i, c);
+  }
+
+  mp_free_vla(tp, tn);
+}
+
+void
+mpn_sqr(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn, mp_limb_t *scratch) {
+  /* `2 * xn` limbs are required for scratch. Larger
+     squarings allocate their own scratch space. */
+  mp_size_t tn;
+  mp_limb_t *tp;
+
+  if (xn < MP_SQR_KARATSUBA_THRESHOLD) {
+    mpn_sqr_basecase(zp, xp, xn, scratch);
+    return;
+  }
+
+  tn = MPN_MUL_N_ITCH(xn);
+  tp = mp_alloc_vla(tn);
+
+  mpn_sqr_inner(zp, xp, xn, tp);
+
+  mp_free_vla(tp, tn);
+}
+
 /*
  * Multiply + Shift
  */
@@ -3553,12 +4042,12 @@ mpn_mont(mp_limb_t *kp,
 }
 
 static TORSION_INLINE mp_limb_t
-mpn_montmul_inner(const mp_limb_t *xp,
-                  const mp_limb_t *yp,
-                  const mp_limb_t *mp,
-                  mp_size_t n,
-                  mp_limb_t k,
-                  mp_limb_t *scratch) {
+mpn_montmul_cios(const mp_limb_t *xp,
+                 const mp_limb_t *yp,
+                 const mp_limb_t *mp,
+                 mp_size_t n,
+                 mp_limb_t k,
+                 mp_limb_t *scratch) {
   /* Montgomery multiplication.
    *
    * [MONT] Algorithm 4 & 5, Page 5, Section 3.
@@ -3591,6 +4080,64 @@ mpn_montmul_inner(const mp_limb_t *xp,
   return c1;
 }
 
+static TORSION_INLINE mp_limb_t
+mpn_montredc(mp_limb_t *tp, const mp_limb_t *mp, mp_size_t n, mp_limb_t k) {
+  /* Montgomery reduction of a 2 * n limb product.
+   *
+   * [MONT] Algorithm 1, Page 2, Section 2.
+   *
+   * The carry out of each row is parked in the limb
+   * it just cleared and added back in at the end.
+   * The result is left in `tp + n` with the carry
+   * returned, matching the multiplication above.
+   */
+  mp_size_t i;
+
+  for (i = 0; i < n; i++)
+    tp[i] = mpn_addmul_1(tp + i, mp, n, tp[i] * k);
+
+  return mpn_add_n(tp + n, tp + n, tp, n);
+}
+
+static TORSION_INLINE mp_limb_t
+mpn_montmul_inner(const mp_limb_t *xp,
+                  const mp_limb_t *yp,
+                  const mp_limb_t *mp,
+                  mp_size_t n,
+                  mp_limb_t k,
+                  mp_limb_t *scratch) {
+  /* `MPN_MONTMUL_ITCH(n)` limbs are required for scratch. */
+  mp_limb_t *tp = scratch;
+
+  if (n < MP_MUL_KARATSUBA_THRESHOLD)
+    return mpn_montmul_cios(xp, yp, mp, n, k, tp);
+
+  /* Separated operand scanning lets the product
+     go through the subquadratic multiplication. */
+  mpn_mul_n_inner(tp, xp, yp, n, tp + 2 * n);
+
+  return mpn_montredc(tp, mp, n, k);
+}
+
+static TORSION_INLINE mp_limb_t
+mpn_montsqr_inner(const mp_limb_t *xp,
+                  const mp_limb_t *mp,
+                  mp_size_t n,
+                  mp_limb_t k,
+                  mp_limb_t *scratch) {
+  /* `2 * n + MPN_MUL_N_ITCH(n)` limbs are required for scratch. */
+  mp_limb_t *tp = scratch;
+
+  if (n < MP_MONTSQR_THRESHOLD)
+    return mpn_montmul_cios(xp, xp, mp, n, k, tp);
+
+  /* Squaring computes half the cross products,
+     which more than pays for a separate REDC. */
+  mpn_sqr_inner(tp, xp, n, tp + 2 * n);
+
+  return mpn_montredc(tp, mp, n, k);
+}
+
 void
 mpn_montmul(mp_limb_t *zp, const mp_limb_t *xp,
                            const mp_limb_t *yp,
@@ -3632,6 +4179,39 @@ mpn_sec_montmul(mp_limb_t *zp, const mp_limb_t *xp,
 #endif
 }
 
+static void
+mpn_montsqr(mp_limb_t *zp, const mp_limb_t *xp,
+                           const mp_limb_t *mp,
+                           mp_size_t n,
+                           mp_limb_t k,
+                           mp_limb_t *scratch) {
+  /* Almost Montgomery Squaring. */
+  mp_limb_t *tp = scratch;
+  mp_limb_t c = mpn_montsqr_inner(xp, mp, n, k, tp);
+
+  if (c != 0)
+    mpn_sub_n(zp, tp + n, mp, n);
+  else
+    mpn_copyi(zp, tp + n, n);
+}
+
+static void
+mpn_sec_montsqr(mp_limb_t *zp, const mp_limb_t *xp,
+                               const mp_limb_t *mp,
+                               mp_size_t n,
+                               mp_limb_t k,
+                               mp_limb_t *scratch) {
+  /* Montgomery Squaring. */
+  mp_limb_t *tp = scratch;
+  mp_limb_t c = mpn_montsqr_inner(xp, mp, n, k, tp);
+
+  mpn_reduce_weak(zp, tp + n, mp, n, c, tp);
+
+#ifdef TORSION_VERIFY
+  ASSERT(mpn_cmp(zp, mp, n) < 0);
+#endif
+}
+
 /*
  * Number Theoretic Functions
  */
@@ -4047,30 +4627,29 @@ mpn_div_powm(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
 }
 
 static void
-mpn_mont_powm(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
-                             const mp_limb_t *yp, mp_size_t yn,
-                             const mp_limb_t *mp, mp_size_t mn,
-                             mp_limb_t *scratch) {
+mpn_mont_powm_inner(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
+                                   const mp_limb_t *yp, mp_size_t yn,
+                                   const mp_limb_t *mp, mp_size_t mn,
+                                   mp_limb_t k,
+                                   const mp_limb_t *rr,
+                                   mp_limb_t *scratch) {
   /* Sliding window with montgomery. */
   mp_limb_t *ap = &scratch[0 * mn]; /* mn */
   mp_limb_t *rp = &scratch[1 * mn]; /* mn */
-  mp_limb_t *tp = &scratch[2 * mn]; /* 2 * mn + 1 */
-  mp_limb_t *rr = &scratch[4 * mn + 1]; /* mn */
-  mp_limb_t *wp = &scratch[5 * mn + 1]; /* wnd_size * mn */
+  mp_limb_t *tp = &scratch[3 * mn]; /* 3 * mn + mul_n_itch */
+  mp_limb_t *wp = &scratch[6 * mn + MPN_MUL_N_ITCH(mn)]; /* wnd_size * mn */
   mp_bits_t i, j, len, width, shift;
-  mp_limb_t k, bits;
+  mp_limb_t bits;
 
   len = yn * MP_LIMB_BITS - mp_clz(yp[yn - 1]);
 
   mpn_copyi(ap, xp, xn);
   mpn_zero(ap + xn, mn - xn);
 
-  mpn_mont(&k, rr, mp, mn, tp);
-
   mpn_montmul(ap, ap, rr, mp, mn, k, tp);
 
   if (yn > 2) {
-    mpn_montmul(rp, ap, ap, mp, mn, k, tp);
+    mpn_montsqr(rp, ap, mp, mn, k, tp);
 
 #define WND(i) (&wp[(i) * mn])
 
@@ -4086,7 +4665,7 @@ mpn_mont_powm(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
       bits = mpn_getbits(yp, yn, i - width, width);
 
       if (bits < MP_SLIDE_SIZE) {
-        mpn_montmul(rp, rp, rp, mp, mn, k, tp);
+        mpn_montsqr(rp, rp, mp, mn, k, tp);
         i -= 1;
         continue;
       }
@@ -4099,7 +4678,7 @@ mpn_mont_powm(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
         mpn_copyi(rp, WND(bits >> 1), mn);
       } else {
         for (j = 0; j < width; j++)
-          mpn_montmul(rp, rp, rp, mp, mn, k, tp);
+          mpn_montsqr(rp, rp, mp, mn, k, tp);
 
         mpn_montmul(rp, rp, WND(bits >> 1), mp, mn, k, tp);
       }
@@ -4115,14 +4694,134 @@ mpn_mont_powm(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
   }
 
   for (i -= 1; i >= 0; i--) {
-    mpn_montmul(rp, rp, rp, mp, mn, k, tp);
+    mpn_montsqr(rp, rp, mp, mn, k, tp);
 
     if (mpn_tstbit(yp, i))
       mpn_montmul(rp, rp, ap, mp, mn, k, tp);
   }
 
-  mpn_set_1(rr, mn, 1);
-  mpn_montmul(rp, rp, rr, mp, mn, k, tp);
+  mpn_set_1(ap, mn, 1);
+  mpn_montmul(rp, rp, ap, mp, mn, k, tp);
+
+  if (mpn_cmp(rp, mp, mn) >= 0) {
+    mpn_sub_n(rp, rp, mp, mn);
+
+    if (mpn_cmp(rp, mp, mn) >= 0)
+      mpn_mod(rp, rp, mn, mp, mn);
+  }
+
+  mpn_copyi(zp, rp, mn);
+}
+
+static void
+mpn_mont_powm(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
+                             const mp_limb_t *yp, mp_size_t yn,
+                             const mp_limb_t *mp, mp_size_t mn,
+                             mp_limb_t *scratch) {
+  mp_limb_t *rr = &scratch[2 * mn]; /* mn */
+  mp_limb_t *tp = &scratch[3 * mn]; /* 2 * mn + 1 */
+  mp_limb_t k;
+
+  mpn_mont(&k, rr, mp, mn, tp);
+
+  mpn_mont_powm_inner(zp, xp, xn, yp, yn, mp, mn, k, rr, scratch);
+}
+
+static void
+mpn_mont_powm2_inner(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
+                                    const mp_limb_t *yp, mp_size_t yn,
+                                    const mp_limb_t *up, mp_size_t un,
+                                    const mp_limb_t *vp, mp_size_t vn,
+                                    const mp_limb_t *mp, mp_size_t mn,
+                                    mp_limb_t k,
+                                    const mp_limb_t *rr,
+                                    mp_limb_t *scratch) {
+  /* Interleaved sliding windows with montgomery.
+   *
+   * Computes x^y * u^v mod m. Each base gets its
+   * own table of odd powers and its own window,
+   * but both share a single chain of squarings.
+   *
+   * [HANDBOOK] Algorithm 14.88, Page 618, Section 14.6.
+   */
+  mp_limb_t *rp = &scratch[0 * mn]; /* mn */
+  mp_limb_t *tp = &scratch[1 * mn]; /* 2 * mn + mul_n_itch */
+  mp_limb_t *wp = &scratch[3 * mn + MPN_MUL_N_ITCH(mn)]; /* 2 * wnd_size * mn */
+  const mp_limb_t *bp[2], *ep[2];
+  mp_size_t bn[2], en[2];
+  mp_bits_t len[2], end[2];
+  mp_bits_t i, max, width, shift;
+  mp_limb_t bits, val[2];
+  int j, one = 1;
+
+  bp[0] = xp;
+  bn[0] = xn;
+  ep[0] = yp;
+  en[0] = yn;
+
+  bp[1] = up;
+  bn[1] = un;
+  ep[1] = vp;
+  en[1] = vn;
+
+#define WND(j, i) (&wp[((j) * MP_SLIDE_SIZE + (i)) * mn])
+
+  max = 0;
+
+  for (j = 0; j < 2; j++) {
+    len[j] = en[j] > 0 ? mpn_bitlen(ep[j], en[j]) : 0;
+    end[j] = -1;
+
+    if (len[j] == 0)
+      continue;
+
+    mpn_copyi(WND(j, 0), bp[j], bn[j]);
+    mpn_zero(WND(j, 0) + bn[j], mn - bn[j]);
+
+    mpn_montmul(WND(j, 0), WND(j, 0), rr, mp, mn, k, tp);
+    mpn_montsqr(rp, WND(j, 0), mp, mn, k, tp);
+
+    for (i = 1; i < MP_SLIDE_SIZE; i++)
+      mpn_montmul(WND(j, i), WND(j, i - 1), rp, mp, mn, k, tp);
+
+    max = MP_MAX(max, len[j]);
+  }
+
+  if (max == 0) {
+    mpn_set_1(zp, mn, 1);
+    return;
+  }
+
+  for (i = max - 1; i >= 0; i--) {
+    if (!one)
+      mpn_montsqr(rp, rp, mp, mn, k, tp);
+
+    for (j = 0; j < 2; j++) {
+      if (end[j] < 0 && i < len[j] && mpn_tstbit(ep[j], i)) {
+        width = MP_MIN(i + 1, MP_SLIDE_WIDTH);
+        bits = mpn_getbits(ep[j], en[j], i - width + 1, width);
+        shift = mp_ctz(bits);
+
+        end[j] = i - width + 1 + shift;
+        val[j] = bits >> shift;
+      }
+
+      if (end[j] == i) {
+        if (one)
+          mpn_copyi(rp, WND(j, val[j] >> 1), mn);
+        else
+          mpn_montmul(rp, rp, WND(j, val[j] >> 1), mp, mn, k, tp);
+
+        end[j] = -1;
+        one = 0;
+      }
+    }
+  }
+
+  mpn_set_1(WND(0, 0), mn, 1);
+  mpn_montmul(rp, rp, WND(0, 0), mp, mn, k, tp);
+
+#undef WND
 
   if (mpn_cmp(rp, mp, mn) >= 0) {
     mpn_sub_n(rp, rp, mp, mn);
@@ -4177,19 +4876,68 @@ mpn_powm(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
   }
 }
 
+static void
+mpn_sec_powm_inner(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
+                                  const mp_limb_t *yp, mp_size_t yn,
+                                  const mp_limb_t *mp, mp_size_t mn,
+                                  mp_limb_t k,
+                                  const mp_limb_t *rr,
+                                  mp_limb_t *scratch) {
+  /* Fixed window montgomery. */
+  mp_limb_t *rp = &scratch[0 * mn]; /* mn */
+  mp_limb_t *sp = &scratch[1 * mn]; /* mn */
+  mp_limb_t *wp = &scratch[3 * mn]; /* wnd_size * mn */
+  mp_limb_t *tp = &scratch[3 * mn + MP_FIXED_SIZE * mn]; /* 2 * mn + 1 + mul_n_itch */
+  mp_bits_t i, steps;
+  mp_limb_t j, b;
+
+  mpn_copyi(rp, xp, xn);
+  mpn_zero(rp + xn, mn - xn);
+
+#define WND(i) (&wp[(i) * mn])
+
+  mpn_set_1(WND(0), mn, 1);
+  mpn_sec_montmul(WND(0), WND(0), rr, mp, mn, k, tp);
+  mpn_sec_montmul(WND(1), rp, rr, mp, mn, k, tp);
+
+  for (i = 2; i < MP_FIXED_SIZE; i++)
+    mpn_sec_montmul(WND(i), WND(i - 1), WND(1), mp, mn, k, tp);
+
+  steps = ((yn * MP_LIMB_BITS) + MP_FIXED_WIDTH - 1) / MP_FIXED_WIDTH;
+
+  mpn_copyi(rp, WND(0), mn);
+  mpn_zero(sp, mn);
+
+  for (i = steps - 1; i >= 0; i--) {
+    b = mpn_getbits(yp, yn, i * MP_FIXED_WIDTH, MP_FIXED_WIDTH);
+
+    for (j = 0; j < MP_FIXED_SIZE; j++)
+      mpn_cnd_select(sp, sp, WND(j), mn, j == b);
+
+    if (i == steps - 1) {
+      mpn_copyi(rp, sp, mn);
+    } else {
+      for (j = 0; j < MP_FIXED_WIDTH; j++)
+        mpn_sec_montsqr(rp, rp, mp, mn, k, tp);
+
+      mpn_sec_montmul(rp, rp, sp, mp, mn, k, tp);
+    }
+  }
+
+#undef WND
+
+  mpn_set_1(sp, mn, 1);
+  mpn_sec_montmul(zp, rp, sp, mp, mn, k, tp);
+}
+
 void
 mpn_sec_powm(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
                             const mp_limb_t *yp, mp_size_t yn,
                             const mp_limb_t *mp, mp_size_t mn,
                             mp_limb_t *scratch) {
-  /* Fixed window montgomery. */
-  mp_limb_t *rp = &scratch[0 * mn]; /* mn */
-  mp_limb_t *tp = &scratch[1 * mn]; /* 2 * mn + 1 */
-  mp_limb_t *sp = &scratch[3 * mn + 1]; /* mn */
-  mp_limb_t *rr = &scratch[4 * mn + 1]; /* mn */
-  mp_limb_t *wp = &scratch[5 * mn + 1]; /* wnd_size * mn */
-  mp_bits_t i, steps;
-  mp_limb_t j, k, b;
+  mp_limb_t *rr = &scratch[2 * mn]; /* mn */
+  mp_limb_t *tp = &scratch[3 * mn + MP_FIXED_SIZE * mn]; /* 2 * mn + 1 */
+  mp_limb_t k;
 
   if (mn == 0 || mp[mn - 1] == 0 || (mp[0] & 1) == 0)
     torsion_abort(); /* LCOV_EXCL_LINE */
@@ -4197,45 +4945,110 @@ mpn_sec_powm(mp_limb_t *zp, const mp_limb_t *xp, mp_size_t xn,
   if (xn > mn)
     torsion_abort(); /* LCOV_EXCL_LINE */
 
-  mpn_copyi(rp, xp, xn);
-  mpn_zero(rp + xn, mn - xn);
-
   mpn_mont(&k, rr, mp, mn, tp);
 
-#define WND(i) (&wp[(i) * mn])
+  mpn_sec_powm_inner(zp, xp, xn, yp, yn, mp, mn, k, rr, scratch);
+}
 
-  mpn_set_1(WND(0), mn, 1);
-  mpn_sec_montmul(WND(0), WND(0), rr, mp, mn, k, tp);
-  mpn_sec_montmul(WND(1), rp, rr, mp, mn, k, tp);
+static void
+mpn_comb_build(mp_limb_t *wp, const mp_limb_t *xp, mp_size_t xn,
+                              mp_bits_t spacing,
+                              const mp_limb_t *mp, mp_size_t mn,
+                              mp_limb_t k,
+                              const mp_limb_t *rr,
+                              mp_limb_t *scratch) {
+  /* Fixed-base comb precomputation.
+   *
+   * The exponent is viewed as MP_COMB_TABLES * MP_FIXED_WIDTH
+   * rows of `spacing` bits. Entry `e` of table `u` holds the
+   * product of x^(2^((u * MP_FIXED_WIDTH + i) * spacing)) for
+   * every bit `i` set in `e`.
+   *
+   * [HANDBOOK] Algorithm 14.117, Page 627, Section 14.6.3.
+   */
+  mp_limb_t *cp = &scratch[0 * mn]; /* mn */
+  mp_limb_t *tp = &scratch[1 * mn]; /* 2 * mn + 1 + mul_n_itch */
+  mp_bits_t i, j, u;
+  mp_limb_t e;
 
-  for (i = 2; i < MP_FIXED_SIZE; i++)
-    mpn_sec_montmul(WND(i), WND(i - 1), WND(1), mp, mn, k, tp);
+#define WND(u, e) (&wp[((u) * MP_FIXED_SIZE + (e)) * mn])
+
+  mpn_copyi(cp, xp, xn);
+  mpn_zero(cp + xn, mn - xn);
+
+  mpn_sec_montmul(cp, cp, rr, mp, mn, k, tp);
+
+  for (u = 0; u < MP_COMB_TABLES; u++) {
+    mpn_set_1(WND(u, 0), mn, 1);
+    mpn_sec_montmul(WND(u, 0), WND(u, 0), rr, mp, mn, k, tp);
+
+    for (i = 0; i < MP_FIXED_WIDTH; i++) {
+      mpn_copyi(WND(u, 1 << i), cp, mn);
+
+      for (j = 0; j < spacing; j++)
+        mpn_sec_montsqr(cp, cp, mp, mn, k, tp);
+    }
+
+    for (e = 3; e < MP_FIXED_SIZE; e++) {
+      if ((e & (e - 1)) == 0)
+        continue;
+
+      mpn_sec_montmul(WND(u, e), WND(u, e & (e - 1)),
+                                 WND(u, e & -e),
+                                 mp, mn, k, tp);
+    }
+  }
+
+#undef WND
+}
 
-  steps = ((yn * MP_LIMB_BITS) + MP_FIXED_WIDTH - 1) / MP_FIXED_WIDTH;
+static void
+mpn_comb_powm_sec(mp_limb_t *zp, const mp_limb_t *yp,
+                                 mp_bits_t spacing,
+                                 const mp_limb_t *wp,
+                                 const mp_limb_t *mp, mp_size_t mn,
+                                 mp_limb_t k,
+                                 mp_limb_t *scratch) {
+  /* Fixed-base comb (constant time).
+   *
+   * The exponent must be zero-padded to
+   * MP_COMB_TABLES * MP_FIXED_WIDTH * spacing
+   * bits. Every column costs one squaring and
+   * MP_COMB_TABLES multiplications.
+   */
+  mp_limb_t *rp = &scratch[0 * mn]; /* mn */
+  mp_limb_t *sp = &scratch[1 * mn]; /* mn */
+  mp_limb_t *tp = &scratch[2 * mn]; /* 2 * mn + 1 + mul_n_itch */
+  mp_bits_t c, i, u;
+  mp_limb_t e;
 
-  mpn_copyi(rp, WND(0), mn);
   mpn_zero(sp, mn);
 
-  for (i = steps - 1; i >= 0; i--) {
-    b = mpn_getbits(yp, yn, i * MP_FIXED_WIDTH, MP_FIXED_WIDTH);
+  for (c = spacing - 1; c >= 0; c--) {
+    if (c != spacing - 1)
+      mpn_sec_montsqr(rp, rp, mp, mn, k, tp);
 
-    for (j = 0; j < MP_FIXED_SIZE; j++)
-      mpn_cnd_select(sp, sp, WND(j), mn, j == b);
+    for (u = 0; u < MP_COMB_TABLES; u++) {
+      e = 0;
 
-    if (i == steps - 1) {
-      mpn_copyi(rp, sp, mn);
-    } else {
-      for (j = 0; j < MP_FIXED_WIDTH; j++)
-        mpn_sec_montmul(rp, rp, rp, mp, mn, k, tp);
+      for (i = 0; i < MP_FIXED_WIDTH; i++) {
+        mp_bits_t pos = (u * MP_FIXED_WIDTH + i) * spacing + c;
 
-      mpn_sec_montmul(rp, rp, sp, mp, mn, k, tp);
+        e |= (mp_limb_t)mpn_tstbit(yp, pos) << i;
+      }
+
+      mpn_sec_tabselect(sp, &wp[u * MP_FIXED_SIZE * mn],
+                        mn, MP_FIXED_SIZE, e);
+
+      if (c == spacing - 1 && u == 0)
+        mpn_copyi(rp, sp, mn);
+      else
+        mpn_sec_montmul(rp, rp, sp, mp, mn, k, tp);
     }
   }
 
-#undef WND
-
-  mpn_set_1(rr, mn, 1);
-  mpn_sec_montmul(zp, rp, rr, mp, mn, k, tp);
+  mpn_set_1(sp, mn, 1);
+  mpn_sec_montmul(zp, rp, sp, mp, mn, k, tp);
 }
 
 /*
@@ -5542,14 +6355,12 @@ mpz_sqr(mpz_t z, const mpz_t x) {
     mpn_copyi(zp, tp, zn);
 
     mp_free_vla(tp, tn);
-  } else if (zn <= mp_alloca_max) {
+  } else {
     tp = mp_alloc_vla(zn);
 
     mpn_sqr(zp, xp, xn, tp);
 
     mp_free_vla(tp, zn);
-  } else {
-    mpn_mul(zp, xp, xn, xp, xn);
   }
 
   zn -= (zp[zn - 1] == 0);
@@ -7622,6 +8433,336 @@ mpz_powm_sec(mpz_t z, const mpz_t x, const mpz_t y, const mpz_t m) {
   }
 }
 
+void
+mpz_mont_init(mpz_mont_t mont) {
+  mont->limbs = NULL;
+  mont->alloc = 0;
+  mont->size = 0;
+  mont->k = 0;
+}
+
+void
+mpz_mont_clear(mpz_mont_t mont) {
+  if (mont->alloc > 0) {
+    mpn_cleanse(mont->limbs, mont->alloc);
+    mp_free_limbs(mont->limbs);
+  }
+
+  mpz_mont_init(mont);
+}
+
+int
+mpz_mont_set(mpz_mont_t mont, const mpz_t m) {
+  /* Precompute k = -m^-1 mod 2^L and r^2 mod m. */
+  mp_size_t mn = m->size;
+  mp_size_t tn = mn * 2 + 1;
+  mp_limb_t *tp;
+
+  if (mn <= 0 || (m->limbs[0] & 1) == 0)
+    return 0;
+
+  if (mont->alloc < mn * 2) {
+    if (mont->alloc > 0)
+      mpn_cleanse(mont->limbs, mont->alloc);
+
+    mont->limbs = mp_realloc_limbs(mont->limbs, mn * 2);
+    mont->alloc = mn * 2;
+  }
+
+  tp = mp_alloc_vla(tn);
+
+  mpn_copyi(mont->limbs, m->limbs, mn);
+  mpn_mont(&mont->k, mont->limbs + mn, m->limbs, mn, tp);
+
+  mont->size = mn;
+
+  mp_free_vla(tp, tn);
+
+  return 1;
+}
+
+static void
+mpz_mont_powm_inner(mpz_t z, const mpz_t x,
+                             const mpz_t y,
+                             const mpz_mont_t mont) {
+  const mp_limb_t *mp = mont->limbs;
+  const mp_limb_t *rr = mont->limbs + mont->size;
+  mp_size_t xn = MP_ABS(x->size);
+  mp_size_t yn = mpn_strip(y->limbs, MP_ABS(y->size));
+  mp_size_t mn = mont->size;
+  mp_limb_t *zp = mpz_grow(z, mn);
+  mp_size_t itch = MPN_POWM_ITCH(yn, mn);
+  mp_limb_t *scratch;
+
+  if (mn == 1 && mp[0] == 1) {
+    /* x^y mod 1 = 0 */
+    mpn_zero(zp, mn);
+  } else if (yn == 0) {
+    /* x^0 mod m = 1 */
+    mpn_set_1(zp, mn, 1);
+  } else if (xn == 0) {
+    /* 0^y mod m = 0 */
+    mpn_zero(zp, mn);
+  } else {
+    /* The precomputed r^2 makes montgomery
+       worthwhile even for short exponents. */
+    scratch = mp_alloc_limbs(itch);
+
+    mpn_mont_powm_inner(zp, x->limbs, xn,
+                            y->limbs, yn,
+                            mp, mn,
+                            mont->k, rr,
+                            scratch);
+
+    mp_free_limbs(scratch);
+  }
+
+  z->size = mpn_strip(zp, mn);
+}
+
+void
+mpz_mont_powm(mpz_t z, const mpz_t x, const mpz_t y, const mpz_mont_t mont) {
+  mpz_t m, t;
+
+  if (mont->size == 0)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  mpz_roinit_n(m, mont->limbs, mont->size);
+
+  if (y->size < 0) {
+    mpz_init(t);
+
+    if (!mpz_invert(t, x, m))
+      torsion_abort(); /* LCOV_EXCL_LINE */
+
+    mpz_mont_powm_inner(z, t, y, mont);
+    mpz_clear(t);
+  } else if (x->size < 0 || mpz_cmpabs(x, m) >= 0) {
+    mpz_init_vla(t, mont->size + 1);
+    mpz_mod(t, x, m);
+    mpz_mont_powm_inner(z, t, y, mont);
+    mpz_clear_vla(t);
+  } else {
+    mpz_mont_powm_inner(z, x, y, mont);
+  }
+}
+
+static void
+mpz_mont_powm2_inner(mpz_t z, const mpz_t x,
+                              const mpz_t y,
+                              const mpz_t u,
+                              const mpz_t v,
+                              const mpz_mont_t mont) {
+  const mp_limb_t *mp = mont->limbs;
+  const mp_limb_t *rr = mont->limbs + mont->size;
+  mp_size_t xn = MP_ABS(x->size);
+  mp_size_t yn = mpn_strip(y->limbs, MP_ABS(y->size));
+  mp_size_t un = MP_ABS(u->size);
+  mp_size_t vn = mpn_strip(v->limbs, MP_ABS(v->size));
+  mp_size_t mn = mont->size;
+  mp_limb_t *zp = mpz_grow(z, mn);
+  mp_size_t itch = MPN_POWM2_ITCH(mn);
+  mp_limb_t *scratch;
+
+  if (mn == 1 && mp[0] == 1) {
+    /* x^y * u^v mod 1 = 0 */
+    mpn_zero(zp, mn);
+  } else {
+    scratch = mp_alloc_limbs(itch);
+
+    mpn_mont_powm2_inner(zp, x->limbs, xn,
+                             y->limbs, yn,
+                             u->limbs, un,
+                             v->limbs, vn,
+                             mp, mn,
+                             mont->k, rr,
+                             scratch);
+
+    mp_free_limbs(scratch);
+  }
+
+  z->size = mpn_strip(zp, mn);
+}
+
+void
+mpz_mont_powm2(mpz_t z, const mpz_t x,
+                        const mpz_t y,
+                        const mpz_t u,
+                        const mpz_t v,
+                        const mpz_mont_t mont) {
+  /* Compute x^y * u^v mod m. */
+  mpz_srcptr a = x;
+  mpz_srcptr b = u;
+  mpz_t m, s, t;
+
+  if (y->size < 0 || v->size < 0 || mont->size == 0)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  mpz_roinit_n(m, mont->limbs, mont->size);
+
+  mpz_init_vla(s, mont->size + 1);
+  mpz_init_vla(t, mont->size + 1);
+
+  if (x->size < 0 || mpz_cmpabs(x, m) >= 0) {
+    mpz_mod(s, x, m);
+    a = s;
+  }
+
+  if (u->size < 0 || mpz_cmpabs(u, m) >= 0) {
+    mpz_mod(t, u, m);
+    b = t;
+  }
+
+  mpz_mont_powm2_inner(z, a, y, b, v, mont);
+
+  mpz_clear_vla(s);
+  mpz_clear_vla(t);
+}
+
+static void
+mpz_mont_powm_sec_inner(mpz_t z, const mpz_t x,
+                                 const mpz_t y,
+                                 const mpz_mont_t mont) {
+  const mp_limb_t *mp = mont->limbs;
+  const mp_limb_t *rr = mont->limbs + mont->size;
+  mp_size_t xn = MP_ABS(x->size);
+  mp_size_t yn = MP_ABS(y->size);
+  mp_size_t mn = mont->size;
+  mp_limb_t *zp = mpz_grow(z, mn);
+  mp_size_t itch = MPN_SEC_POWM_ITCH(mn);
+  mp_limb_t *scratch = mp_alloc_limbs(itch);
+
+  mpn_sec_powm_inner(zp, x->limbs, xn,
+                         y->limbs, yn,
+                         mp, mn,
+                         mont->k, rr,
+                         scratch);
+
+  z->size = mpn_strip(zp, mn);
+
+  mp_free_limbs(scratch);
+}
+
+void
+mpz_mont_powm_sec(mpz_t z, const mpz_t x,
+                           const mpz_t y,
+                           const mpz_mont_t mont) {
+  mpz_t m, t;
+
+  if (y->size < 0 || mont->size == 0)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  mpz_roinit_n(m, mont->limbs, mont->size);
+
+  if (x->size < 0 || mpz_cmpabs(x, m) >= 0) {
+    mpz_init_vla(t, mont->size + 1);
+    mpz_mod(t, x, m);
+    mpz_mont_powm_sec_inner(z, t, y, mont);
+    mpz_clear_vla(t);
+  } else {
+    mpz_mont_powm_sec_inner(z, x, y, mont);
+  }
+}
+
+void
+mpz_comb_init(mpz_comb_t comb) {
+  mpz_mont_init(comb->mont);
+
+  comb->limbs = NULL;
+  comb->alloc = 0;
+  comb->bits = 0;
+  comb->spacing = 0;
+}
+
+void
+mpz_comb_clear(mpz_comb_t comb) {
+  mpz_mont_clear(comb->mont);
+
+  if (comb->alloc > 0) {
+    mpn_cleanse(comb->limbs, comb->alloc);
+    mp_free_limbs(comb->limbs);
+  }
+
+  mpz_comb_init(comb);
+}
+
+int
+mpz_comb_set(mpz_comb_t comb, const mpz_t x, mp_bits_t bits, const mpz_t m) {
+  /* Precompute x^y mod m for 0 <= y < 2^bits. */
+  mp_bits_t span = MP_COMB_TABLES * MP_FIXED_WIDTH;
+  mp_size_t mn, size, itch;
+  mp_limb_t *scratch;
+  mpz_t t;
+
+  if (bits <= 0)
+    return 0;
+
+  if (!mpz_mont_set(comb->mont, m))
+    return 0;
+
+  mn = comb->mont->size;
+  size = MP_COMB_TABLES * MP_FIXED_SIZE * mn;
+  itch = 3 * mn + 1 + MPN_MUL_N_ITCH(mn);
+
+  if (comb->alloc < size) {
+    if (comb->alloc > 0)
+      mpn_cleanse(comb->limbs, comb->alloc);
+
+    comb->limbs = mp_realloc_limbs(comb->limbs, size);
+    comb->alloc = size;
+  }
+
+  comb->bits = bits;
+  comb->spacing = (bits + span - 1) / span;
+
+  mpz_init_vla(t, mn + 1);
+  mpz_mod(t, x, m);
+
+  scratch = mp_alloc_limbs(itch);
+
+  mpn_comb_build(comb->limbs, t->limbs, t->size,
+                              comb->spacing,
+                              comb->mont->limbs, mn,
+                              comb->mont->k,
+                              comb->mont->limbs + mn,
+                              scratch);
+
+  mp_free_limbs(scratch);
+  mpz_clear_vla(t);
+
+  return 1;
+}
+
+void
+mpz_comb_powm_sec(mpz_t z, const mpz_t y, const mpz_comb_t comb) {
+  mp_bits_t span = MP_COMB_TABLES * MP_FIXED_WIDTH;
+  mp_size_t mn = comb->mont->size;
+  mp_size_t yn = (span * comb->spacing + MP_LIMB_BITS - 1) / MP_LIMB_BITS;
+  mp_size_t itch = yn + 4 * mn + 1 + MPN_MUL_N_ITCH(mn);
+  mp_limb_t *zp, *yp, *scratch;
+
+  if (mn == 0 || y->size < 0 || mpz_bitlen(y) > comb->bits)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  zp = mpz_grow(z, mn);
+  scratch = mp_alloc_limbs(itch);
+  yp = scratch;
+
+  mpn_copyi(yp, y->limbs, y->size);
+  mpn_zero(yp + y->size, yn - y->size);
+
+  mpn_comb_powm_sec(zp, yp, comb->spacing,
+                            comb->limbs,
+                            comb->mont->limbs, mn,
+                            comb->mont->k,
+                            scratch + yn);
+
+  z->size = mpn_strip(zp, mn);
+
+  mpn_cleanse(yp, yn);
+  mp_free_limbs(scratch);
+}
+
 static int
 mpz_sqrtm_3mod4(mpz_t z, const mpz_t x, const mpz_t p) {
   /* Square Root (p = 3 mod 4). */
@@ -8567,8 +9708,16 @@ mpz_probab_prime_p(const mpz_t x, int rounds, mp_rng_f *rng, void *arg) {
 
 void
 mpz_randprime(mpz_t z, mp_bits_t bits, mp_rng_f *rng, void *arg) {
-  static const mp_limb_t max = MP_LIMB_C(1) << 20;
-  mp_limb_t r, ra, rb, delta;
+  /* Incremental search from a random starting
+   * point[1]. Sieving an entire interval means
+   * a composite candidate costs us a few bit
+   * operations rather than a fresh random number
+   * and another round of trial division.
+   *
+   * [1] https://doi.org/10.1007/3-540-46766-1_29
+   */
+  static const mp_limb_t two = 2;
+  mpz_t d = MPZ_ROINIT_N(&two, 1);
 
   CHECK(bits > 1);
 
@@ -8579,45 +9728,10 @@ mpz_randprime(mpz_t z, mp_bits_t bits, mp_rng_f *rng, void *arg) {
     mpz_setbit(z, bits - 2);
     mpz_setbit(z, 0);
 
-    if (bits > 6) {
-      mpz_mod_primorial(&ra, &rb, z);
-
-      for (delta = 0; delta < max; delta += 2) {
-        r = ra + delta;
-
-        if (r % 3 == 0
-            || r % 5 == 0
-            || r % 7 == 0
-            || r % 11 == 0
-            || r % 13 == 0
-            || r % 17 == 0
-            || r % 19 == 0
-            || r % 23 == 0
-            || r % 37 == 0) {
-          continue;
-        }
-
-        r = rb + delta;
-
-        if (r % 29 == 0
-            || r % 31 == 0
-            || r % 41 == 0
-            || r % 43 == 0
-            || r % 47 == 0
-            || r % 53 == 0) {
-          continue;
-        }
-
-        mpz_add_ui(z, z, delta);
-
-        break;
-      }
-
-      if (mpz_bitlen(z) != bits)
-        continue;
-    }
+    if (!mpz_sieveprime(z, z, d, MP_SIEVE_WINDOW, 20, rng, arg))
+      continue;
 
-    if (!mpz_probab_prime_p(z, 20, rng, arg))
+    if (mpz_bitlen(z) != bits)
       continue;
 
     break;
@@ -8626,6 +9740,9 @@ mpz_randprime(mpz_t z, mp_bits_t bits, mp_rng_f *rng, void *arg) {
 
 void
 mpz_nextprime(mpz_t z, const mpz_t x, mp_rng_f *rng, void *arg) {
+  static const mp_limb_t two = 2;
+  mpz_t d = MPZ_ROINIT_N(&two, 1);
+
   if (mpz_cmp_ui(x, 2) < 0) {
     mpz_set_ui(z, 2);
     return;
@@ -8633,13 +9750,13 @@ mpz_nextprime(mpz_t z, const mpz_t x, mp_rng_f *rng, void *arg) {
 
   mpz_add_ui(z, x, 1 + mpz_odd_p(x));
 
-  while (!mpz_probab_prime_p(z, 20, rng, arg))
-    mpz_add_ui(z, z, 2);
+  CHECK(mpz_sieveprime(z, z, d, MP_LIMB_MAX, 20, rng, arg));
 }
 
 int
 mpz_findprime(mpz_t z, const mpz_t x, mp_limb_t max, mp_rng_f *rng, void *arg) {
-  mp_limb_t i;
+  static const mp_limb_t two = 2;
+  mpz_t d = MPZ_ROINIT_N(&two, 1);
 
   mpz_set(z, x);
 
@@ -8654,14 +9771,153 @@ mpz_findprime(mpz_t z, const mpz_t x, mp_limb_t max, mp_rng_f *rng, void *arg) {
 
   max = (max / 2) + 1;
 
-  for (i = 0; i < max; i++) {
-    if (mpz_probab_prime_p(z, 20, rng, arg))
-      return 1;
+  return mpz_sieveprime(z, z, d, max, 20, rng, arg);
+}
+
+static mp_limb_t
+mp_inv_small(mp_limb_t a, mp_limb_t p) {
+  /* Compute a^-1 mod p (extended euclid). */
+  mp_long_t r0 = p;
+  mp_long_t r1 = a;
+  mp_long_t t0 = 0;
+  mp_long_t t1 = 1;
+  mp_long_t q, t;
+
+  while (r1 != 0) {
+    q = r0 / r1;
 
-    mpz_add_ui(z, z, 2);
+    t = r0 - q * r1;
+    r0 = r1;
+    r1 = t;
+
+    t = t0 - q * t1;
+    t0 = t1;
+    t1 = t;
   }
 
-  return 0;
+  ASSERT(r0 == 1);
+
+  if (t0 < 0)
+    t0 += p;
+
+  return t0;
+}
+
+int
+mpz_sieveprime(mpz_t z, const mpz_t x, const mpz_t d, mp_limb_t max,
+               int rounds, mp_rng_f *rng, void *arg) {
+  /* Find the first probable prime of the form
+   * x + j * d where 0 <= j < max.
+   *
+   * Candidates are processed in windows of
+   * MP_SIEVE_WINDOW. Every window is sieved by
+   * the primes below MP_SIEVE_BOUND and only the
+   * survivors are handed to the BPSW test. For
+   * each sieving prime we track the index of the
+   * next candidate it divides, so the residues
+   * of x and d are only computed once.
+   */
+  mp_limb_t wp[MP_SIEVE_WINDOW / MP_LIMB_BITS];
+  mp_limb_t *sp, *pp, *op;
+  mp_limb_t i, j, k, w, s, r;
+  mp_limb_t base = 0;
+  mp_size_t sn, pn;
+  int ret = 0;
+  mpz_t u, v;
+
+  CHECK(x->size >= 0);
+  CHECK(d->size > 0);
+
+  mpz_init_set(u, x);
+  mpz_init_set(v, d);
+
+  /* Sieving requires every candidate to be larger
+     than the sieving primes. Small inputs are
+     rare enough to simply test one by one. */
+  if (mpz_cmp_ui(u, MP_SIEVE_BOUND) <= 0) {
+    for (j = 0; j < max; j++) {
+      mpz_mul_ui(z, v, j);
+      mpz_add(z, z, u);
+
+      if (mpz_probab_prime_p(z, rounds, rng, arg)) {
+        ret = 1;
+        break;
+      }
+    }
+
+    goto done;
+  }
+
+  sn = mpn_sieve_size(MP_SIEVE_BOUND - 1);
+  sp = mp_alloc_vla(sn);
+
+  mpn_sieve(sp, MP_SIEVE_BOUND - 1);
+
+  pn = mpn_popcount(sp, sn);
+  pp = mp_alloc_limbs(pn * 2);
+  op = pp + pn;
+  pn = 0;
+
+  for (s = 2; s < MP_SIEVE_BOUND; s++) {
+    if (!mpn_tstbit(sp, s))
+      continue;
+
+    r = mpz_rem_ui(v, s);
+    k = mpz_rem_ui(u, s);
+
+    if (r == 0) {
+      /* Every candidate is divisible by s. */
+      if (k == 0)
+        goto cleanup;
+
+      /* No candidate is divisible by s. */
+      continue;
+    }
+
+    /* x + j * d == 0 mod s => j == -x / d mod s */
+    pp[pn] = s;
+    op[pn] = ((s - k) * mp_inv_small(r, s)) % s;
+    pn++;
+  }
+
+  while (base < max) {
+    w = MP_MIN(max - base, MP_SIEVE_WINDOW);
+
+    for (i = 0; i < MP_SIEVE_WINDOW / MP_LIMB_BITS; i++)
+      wp[i] = MP_LIMB_MAX;
+
+    for (i = 0; i < (mp_limb_t)pn; i++) {
+      s = pp[i];
+
+      for (j = op[i]; j < MP_SIEVE_WINDOW; j += s)
+        mpn_clrbit(wp, j);
+
+      op[i] = j - MP_SIEVE_WINDOW;
+    }
+
+    for (j = 0; j < w; j++) {
+      if (!mpn_tstbit(wp, j))
+        continue;
+
+      mpz_mul_ui(z, v, base + j);
+      mpz_add(z, z, u);
+
+      if (mpz_probab_prime_p(z, rounds, rng, arg)) {
+        ret = 1;
+        goto cleanup;
+      }
+    }
+
+    base += w;
+  }
+
+cleanup:
+  mp_free_limbs(pp);
+  mp_free_vla(sp, sn);
+done:
+  mpz_clear(u);
+  mpz_clear(v);
+  return ret;
 }
 
 /*
@@ -230,6 +230,16 @@
 #define mpz_powm torsion__mpz_powm
 #define mpz_powm_ui torsion__mpz_powm_ui
 #define mpz_powm_sec torsion__mpz_powm_sec
+#define mpz_mont_init torsion__mpz_mont_init
+#define mpz_mont_clear torsion__mpz_mont_clear
+#define mpz_mont_set torsion__mpz_mont_set
+#define mpz_mont_powm torsion__mpz_mont_powm
+#define mpz_mont_powm2 torsion__mpz_mont_powm2
+#define mpz_mont_powm_sec torsion__mpz_mont_powm_sec
+#define mpz_comb_init torsion__mpz_comb_init
+#define mpz_comb_clear torsion__mpz_comb_clear
+#define mpz_comb_set torsion__mpz_comb_set
+#define mpz_comb_powm_sec torsion__mpz_comb_powm_sec
 #define mpz_sqrtm torsion__mpz_sqrtm
 #define mpz_sqrtpq torsion__mpz_sqrtpq
 #define mpz_remove torsion__mpz_remove
@@ -250,6 +260,7 @@
 #define mpz_randprime torsion__mpz_randprime
 #define mpz_nextprime torsion__mpz_nextprime
 #define mpz_findprime torsion__mpz_findprime
+#define mpz_sieveprime torsion__mpz_sieveprime
 #define mpz_fits_ui_p torsion__mpz_fits_ui_p
 #define mpz_fits_si_p torsion__mpz_fits_si_p
 #define mpz_odd_p torsion__mpz_odd_p
@@ -334,6 +345,25 @@ struct mpz_s {
 
 typedef struct mpz_s mpz_t[1];
 
+struct mpz_mont_s {
+  mp_limb_t *limbs; /* m || r^2 mod m */
+  mp_size_t alloc;
+  mp_size_t size;
+  mp_limb_t k;
+};
+
+typedef struct mpz_mont_s mpz_mont_t[1];
+
+struct mpz_comb_s {
+  mpz_mont_t mont;
+  mp_limb_t *limbs; /* tables (montgomery form) */
+  mp_size_t alloc;
+  mp_bits_t bits;
+  mp_bits_t spacing;
+};
+
+typedef struct mpz_comb_s mpz_comb_t[1];
+
 /* Note: these types aren't strictly documented,
  * but they are sometimes referenced in the docs[1],
  * and they are no doubt used by programmers as
@@ -362,26 +392,45 @@ typedef void mp_end_f(uint64_t *start, uint64_t ops);
 #define MP_SLIDE_SIZE (1 << (MP_SLIDE_WIDTH - 1))
 #define MP_FIXED_WIDTH 4
 #define MP_FIXED_SIZE (1 << MP_FIXED_WIDTH)
+#define MP_COMB_TABLES 8
+#define MP_SIEVE_BOUND (1 << 13)
+#define MP_SIEVE_WINDOW 4096
+
+/* Crossover points (in limbs) for subquadratic
+   multiplication. See `bench_mpi_internal`. */
+#define MP_MUL_KARATSUBA_THRESHOLD 20
+#define MP_MUL_TOOM3_THRESHOLD 96
+#define MP_SQR_KARATSUBA_THRESHOLD 30
+#define MP_SQR_TOOM3_THRESHOLD 224
+#define MP_MONTSQR_THRESHOLD 12
 
 /*
  * Itches
  */
 
+#define MPN_MUL_N_ITCH(n) (((n) < MP_MUL_KARATSUBA_THRESHOLD   \
+                         && (n) < MP_SQR_KARATSUBA_THRESHOLD) \
+                         ? 2 * (n) : 5 * (n) + 64)
 #define MPN_SQR_ITCH(n) (2 * (n))
 #define MPN_MULSHIFT_ITCH(n) (2 * (n))
 #define MPN_REDUCE_WEAK_ITCH(n) (n)
 #define MPN_BARRETT_ITCH(shift) ((shift) + 1)
 #define MPN_REDUCE_ITCH(n, shift) (1 + (shift) + ((shift) - (n) + 1))
 #define MPN_MONT_ITCH(n) (2 * (n) + 1)
-#define MPN_MONTMUL_ITCH(n) (2 * (n))
+#define MPN_MONTMUL_ITCH(n) ((n) < MP_MUL_KARATSUBA_THRESHOLD \
+                           ? 2 * (n) : 2 * (n) + MPN_MUL_N_ITCH(n))
 #define MPN_GCD_ITCH(xn, yn) ((xn) + (yn))
 #define MPN_GCD_1_ITCH(xn) (xn)
 #define MPN_INVERT_ITCH(n) (4 * ((n) + 1))
 #define MPN_SEC_INVERT_ITCH(n) ((n) + MPN_SEC_POWM_ITCH(n))
 #define MPN_JACOBI_ITCH(n) (2 * (n))
 #define MPN_SLIDE_ITCH(yn, mn) ((yn) > 2 ? (MP_SLIDE_SIZE * (mn)) : 0)
-#define MPN_POWM_ITCH(yn, mn) (6 * (mn) + MPN_SLIDE_ITCH(yn, mn))
-#define MPN_SEC_POWM_ITCH(n) (5 * (n) + MP_FIXED_SIZE * (n) + 1)
+#define MPN_POWM_ITCH(yn, mn) \
+  (6 * (mn) + MPN_MUL_N_ITCH(mn) + MPN_SLIDE_ITCH(yn, mn))
+#define MPN_POWM2_ITCH(mn) \
+  (3 * (mn) + MPN_MUL_N_ITCH(mn) + 2 * MP_SLIDE_SIZE * (mn))
+#define MPN_SEC_POWM_ITCH(n) \
+  (5 * (n) + MP_FIXED_SIZE * (n) + 1 + MPN_MUL_N_ITCH(n))
 
 /* Either Barrett or Montgomery precomputation. */
 #define MPN_BARRETT_MONT_ITCH(shift) ((shift) + 2)
@@ -1404,6 +1453,42 @@ mpz_powm_ui(mpz_t z, const mpz_t x, mp_limb_t y, const mpz_t m);
 void
 mpz_powm_sec(mpz_t z, const mpz_t x, const mpz_t y, const mpz_t m);
 
+void
+mpz_mont_init(mpz_mont_t mont);
+
+void
+mpz_mont_clear(mpz_mont_t mont);
+
+int
+mpz_mont_set(mpz_mont_t mont, const mpz_t m);
+
+void
+mpz_mont_powm(mpz_t z, const mpz_t x, const mpz_t y, const mpz_mont_t mont);
+
+void
+mpz_mont_powm2(mpz_t z, const mpz_t x,
+                        const mpz_t y,
+                        const mpz_t u,
+                        const mpz_t v,
+                        const mpz_mont_t mont);
+
+void
+mpz_mont_powm_sec(mpz_t z, const mpz_t x,
+                           const mpz_t y,
+                           const mpz_mont_t mont);
+
+void
+mpz_comb_init(mpz_comb_t comb);
+
+void
+mpz_comb_clear(mpz_comb_t comb);
+
+int
+mpz_comb_set(mpz_comb_t comb, const mpz_t x, mp_bits_t bits, const mpz_t m);
+
+void
+mpz_comb_powm_sec(mpz_t z, const mpz_t y, const mpz_comb_t comb);
+
 int
 mpz_sqrtm(mpz_t z, const mpz_t x, const mpz_t p);
 
@@ -1468,6 +1553,10 @@ mpz_nextprime(mpz_t z, const mpz_t x, mp_rng_f *rng, void *arg);
 int
 mpz_findprime(mpz_t z, const mpz_t x, mp_limb_t max, mp_rng_f *rng, void *arg);
 
+int
+mpz_sieveprime(mpz_t z, const mpz_t x, const mpz_t d, mp_limb_t max,
+               int rounds, mp_rng_f *rng, void *arg);
+
 /*
  * Helpers
  */
@@ -211,8 +211,16 @@ static const unsigned char pss_prefix[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 typedef struct rsa_pub_s {
   mpz_t n;
   mpz_t e;
+  mpz_mont_t mont_n;
 } rsa_pub_t;
 
+typedef struct rsa_prime_s {
+  mpz_t r;
+  mpz_t d;
+  mpz_t t;
+  mpz_mont_t mont_r;
+} rsa_prime_t;
+
 typedef struct rsa_priv_s {
   mpz_t n;
   mpz_t e;
@@ -222,8 +230,28 @@ typedef struct rsa_priv_s {
   mpz_t dp;
   mpz_t dq;
   mpz_t qi;
+  mpz_mont_t mont_n;
+  mpz_mont_t mont_p;
+  mpz_mont_t mont_q;
+  rsa_prime_t others[RSA_MAX_PRIMES - 2];
+  int count;
+  rsa_run_f *run;
+  void *arg;
 } rsa_priv_t;
 
+typedef struct rsa_powm_s {
+  mpz_ptr z;
+  mpz_srcptr x;
+  mpz_srcptr y;
+  const struct mpz_mont_s *mont;
+} rsa_powm_t;
+
+typedef struct rsa_blind_s {
+  mpz_t b;
+  mpz_t bi;
+  unsigned int uses;
+} rsa_blind_t;
+
 /*
  * Helpers
  */
@@ -266,6 +294,8 @@ safe_memequal(const unsigned char *x, const unsigned char *y, size_t len) {
 
 static void
 rsa_priv_init(rsa_priv_t *k) {
+  int i;
+
   mpz_init(k->n);
   mpz_init(k->e);
   mpz_init(k->d);
@@ -274,10 +304,26 @@ rsa_priv_init(rsa_priv_t *k) {
   mpz_init(k->dp);
   mpz_init(k->dq);
   mpz_init(k->qi);
+  mpz_mont_init(k->mont_n);
+  mpz_mont_init(k->mont_p);
+  mpz_mont_init(k->mont_q);
+
+  for (i = 0; i < RSA_MAX_PRIMES - 2; i++) {
+    mpz_init(k->others[i].r);
+    mpz_init(k->others[i].d);
+    mpz_init(k->others[i].t);
+    mpz_mont_init(k->others[i].mont_r);
+  }
+
+  k->count = 0;
+  k->run = NULL;
+  k->arg = NULL;
 }
 
 static void
 rsa_priv_clear(rsa_priv_t *k) {
+  int i;
+
   mpz_cleanse(k->n);
   mpz_cleanse(k->e);
   mpz_cleanse(k->d);
@@ -286,10 +332,24 @@ rsa_priv_clear(rsa_priv_t *k) {
   mpz_cleanse(k->dp);
   mpz_cleanse(k->dq);
   mpz_cleanse(k->qi);
+  mpz_mont_clear(k->mont_n);
+  mpz_mont_clear(k->mont_p);
+  mpz_mont_clear(k->mont_q);
+
+  for (i = 0; i < RSA_MAX_PRIMES - 2; i++) {
+    mpz_cleanse(k->others[i].r);
+    mpz_cleanse(k->others[i].d);
+    mpz_cleanse(k->others[i].t);
+    mpz_mont_clear(k->others[i].mont_r);
+  }
+
+  k->count = 0;
 }
 
 static void
 rsa_priv_set(rsa_priv_t *r, const rsa_priv_t *k) {
+  int i;
+
   mpz_set(r->n, k->n);
   mpz_set(r->e, k->e);
   mpz_set(r->d, k->d);
@@ -298,15 +358,70 @@ rsa_priv_set(rsa_priv_t *r, const rsa_priv_t *k) {
   mpz_set(r->dp, k->dp);
   mpz_set(r->dq, k->dq);
   mpz_set(r->qi, k->qi);
+
+  for (i = 0; i < k->count; i++) {
+    mpz_set(r->others[i].r, k->others[i].r);
+    mpz_set(r->others[i].d, k->others[i].d);
+    mpz_set(r->others[i].t, k->others[i].t);
+  }
+
+  r->count = k->count;
+}
+
+static int
+rsa_prime_import(rsa_prime_t *x, const unsigned char **data, size_t *len) {
+  /* OtherPrimeInfo ::= SEQUENCE {
+   *   prime INTEGER, -- r_i
+   *   exponent INTEGER, -- d_i
+   *   coefficient INTEGER -- t_i
+   * }
+   */
+  const unsigned char *seq = *data;
+  size_t seq_len = *len;
+  size_t size;
+
+  if (seq_len == 0 || *seq != 0x30)
+    return 0;
+
+  seq += 1;
+  seq_len -= 1;
+
+  if (!asn1_read_size(&size, &seq, &seq_len, 1))
+    return 0;
+
+  if (size > seq_len)
+    return 0;
+
+  *data = seq + size;
+  *len = seq_len - size;
+
+  seq_len = size;
+
+  if (!asn1_read_mpz(x->r, &seq, &seq_len, 1))
+    return 0;
+
+  if (!asn1_read_mpz(x->d, &seq, &seq_len, 1))
+    return 0;
+
+  if (!asn1_read_mpz(x->t, &seq, &seq_len, 1))
+    return 0;
+
+  return seq_len == 0;
 }
 
 static int
 rsa_priv_import(rsa_priv_t *k, const unsigned char *data, size_t len) {
+  int multi = 0;
+
   if (!asn1_read_seq(&data, &len, 1))
     return 0;
 
-  if (!asn1_read_version(&data, &len, 0, 1))
-    return 0;
+  if (!asn1_read_version(&data, &len, 0, 1)) {
+    if (!asn1_read_version(&data, &len, 1, 1))
+      return 0;
+
+    multi = 1;
+  }
 
   if (!asn1_read_mpz(k->n, &data, &len, 1))
     return 0;
@@ -332,18 +447,59 @@ rsa_priv_import(rsa_priv_t *k, const unsigned char *data, size_t len) {
   if (!asn1_read_mpz(k->qi, &data, &len, 1))
     return 0;
 
+  k->count = 0;
+
+  if (multi) {
+    /* OtherPrimeInfos ::= SEQUENCE SIZE(1..MAX) OF OtherPrimeInfo */
+    if (!asn1_read_seq(&data, &len, 1))
+      return 0;
+
+    while (len > 0) {
+      if (k->count == RSA_MAX_PRIMES - 2)
+        return 0;
+
+      if (!rsa_prime_import(&k->others[k->count], &data, &len))
+        return 0;
+
+      k->count += 1;
+    }
+
+    if (k->count == 0)
+      return 0;
+  }
+
   if (len != 0)
     return 0;
 
   return 1;
 }
 
+static size_t
+rsa_prime_size(const rsa_prime_t *x) {
+  size_t size = 0;
+
+  size += asn1_size_mpz(x->r);
+  size += asn1_size_mpz(x->d);
+  size += asn1_size_mpz(x->t);
+
+  return size;
+}
+
 static void
 rsa_priv_export(unsigned char *out, size_t *out_len, const rsa_priv_t *k) {
+  int version = (k->count > 0);
+  size_t others = 0;
   size_t size = 0;
   size_t pos = 0;
+  size_t item;
+  int i;
 
-  size += asn1_size_version(0);
+  for (i = 0; i < k->count; i++) {
+    item = rsa_prime_size(&k->others[i]);
+    others += 1 + asn1_size_size(item) + item;
+  }
+
+  size += asn1_size_version(version);
   size += asn1_size_mpz(k->n);
   size += asn1_size_mpz(k->e);
   size += asn1_size_mpz(k->d);
@@ -353,8 +509,11 @@ rsa_priv_export(unsigned char *out, size_t *out_len, const rsa_priv_t *k) {
   size += asn1_size_mpz(k->dq);
   size += asn1_size_mpz(k->qi);
 
+  if (k->count > 0)
+    size += 1 + asn1_size_size(others) + others;
+
   pos = asn1_write_seq(out, pos, size);
-  pos = asn1_write_version(out, pos, 0);
+  pos = asn1_write_version(out, pos, version);
   pos = asn1_write_mpz(out, pos, k->n);
   pos = asn1_write_mpz(out, pos, k->e);
   pos = asn1_write_mpz(out, pos, k->d);
@@ -364,6 +523,17 @@ rsa_priv_export(unsigned char *out, size_t *out_len, const rsa_priv_t *k) {
   pos = asn1_write_mpz(out, pos, k->dq);
   pos = asn1_write_mpz(out, pos, k->qi);
 
+  if (k->count > 0) {
+    pos = asn1_write_seq(out, pos, others);
+
+    for (i = 0; i < k->count; i++) {
+      pos = asn1_write_seq(out, pos, rsa_prime_size(&k->others[i]));
+      pos = asn1_write_mpz(out, pos, k->others[i].r);
+      pos = asn1_write_mpz(out, pos, k->others[i].d);
+      pos = asn1_write_mpz(out, pos, k->others[i].t);
+    }
+  }
+
   *out_len = pos;
 }
 
@@ -412,11 +582,46 @@ rsa_priv_export_dumb(unsigned char *out, size_t *out_len, const rsa_priv_t *k) {
   *out_len = pos;
 }
 
+static int
+rsa_max_primes(mp_bits_t bits) {
+  /* Maximum number of primes for a modulus
+     size (the same limits as OpenSSL). */
+  if (bits < 1024)
+    return 2;
+
+  if (bits < 4096)
+    return 3;
+
+  if (bits < 8192)
+    return 4;
+
+  return RSA_MAX_PRIMES;
+}
+
+typedef struct rsa_prime_job_s {
+  mpz_ptr r;
+  mp_bits_t bits;
+  drbg_t rng;
+  int done;
+} rsa_prime_job_t;
+
+static void
+rsa_prime_job(void *ptr) {
+  rsa_prime_job_t *job = (rsa_prime_job_t *)ptr;
+
+  mpz_randprime(job->r, job->bits, drbg_rng, &job->rng);
+
+  job->done = 1;
+}
+
 static int
 rsa_priv_generate(rsa_priv_t *k,
                   mp_bits_t bits,
                   uint64_t exp,
-                  const unsigned char *entropy) {
+                  int primes,
+                  const unsigned char *entropy,
+                  rsa_run_f *run,
+                  void *arg) {
   /* [RFC8017] Page 9, Section 3.2.
    * [FIPS186] Page 51, Appendix B.3.1
    *           Page 55, Appendix B.3.3
@@ -434,19 +639,38 @@ rsa_priv_generate(rsa_priv_t *k,
    * when used with RSA, however, Carmichael's
    * may lend itself to some perf benefits.
    *
+   * For multi-prime keys, `n` is split evenly
+   * among the primes, and the remaining primes
+   * are stored as the `otherPrimeInfos` of
+   * [RFC8017] Page 55, Appendix A.1.2.
+   *
    * [1] https://crypto.stackexchange.com/a/29595
+   *
+   * Every prime is searched for with its own
+   * DRBG, seeded from the main one, so that the
+   * searches may be handed to a runner without
+   * changing the resulting key.
    */
+  unsigned char seed[ENTROPY_SIZE];
+  rsa_prime_job_t jobs[RSA_MAX_PRIMES];
+  void *args[RSA_MAX_PRIMES];
   mpz_t pm1, qm1, phi, lam, tmp;
+  mpz_ptr rs[RSA_MAX_PRIMES];
+  mp_bits_t size;
+  int ret = 0;
 #if MP_LIMB_BITS == 32
   mp_limb_t *limbs;
 #endif
   drbg_t rng;
+  int i, j;
 
   if (bits < RSA_MIN_MOD_BITS
       || bits > RSA_MAX_MOD_BITS
       || exp < RSA_MIN_EXP
       || exp > RSA_MAX_EXP
-      || (exp & 1) == 0) {
+      || (exp & 1) == 0
+      || primes < 2
+      || primes > rsa_max_primes(bits)) {
     return 0;
   }
 
@@ -469,9 +693,41 @@ rsa_priv_generate(rsa_priv_t *k,
   mpz_limbs_finish(k->e, 2);
 #endif
 
+  rs[0] = k->p;
+  rs[1] = k->q;
+
+  for (i = 2; i < primes; i++)
+    rs[i] = k->others[i - 2].r;
+
+  k->count = primes - 2;
+
+  size = bits / primes;
+
   for (;;) {
-    mpz_randprime(k->p, (bits >> 1) + (bits & 1), drbg_rng, &rng);
-    mpz_randprime(k->q, bits >> 1, drbg_rng, &rng);
+    for (i = 0; i < primes; i++) {
+      rsa_prime_job_t *job = &jobs[i];
+
+      drbg_generate(&rng, seed, sizeof(seed));
+      drbg_init(&job->rng, HASH_SHA256, seed, sizeof(seed));
+
+      job->r = rs[i];
+      job->bits = size + (i < bits % primes);
+      job->done = 0;
+
+      args[i] = job;
+    }
+
+    if (run != NULL) {
+      run(rsa_prime_job, args, primes, arg);
+    } else {
+      for (i = 0; i < primes; i++)
+        rsa_prime_job(&jobs[i]);
+    }
+
+    for (i = 0; i < primes; i++) {
+      if (!jobs[i].done)
+        goto fail;
+    }
 
     if (mpz_cmp(k->p, k->q) == 0)
       continue;
@@ -479,30 +735,50 @@ rsa_priv_generate(rsa_priv_t *k,
     if (mpz_cmp(k->p, k->q) < 0)
       mpz_swap(k->p, k->q);
 
-    mpz_sub(tmp, k->p, k->q);
+    /* Every pair of primes must be far apart. */
+    for (i = 0; i < primes; i++) {
+      for (j = i + 1; j < primes; j++) {
+        mpz_sub(tmp, rs[i], rs[j]);
+
+        if (mpz_bitlen(tmp) <= size - 99)
+          break;
+      }
+
+      if (j < primes)
+        break;
+    }
 
-    if (mpz_bitlen(tmp) <= (bits >> 1) - 99)
+    if (i < primes)
       continue;
 
     mpz_mul(k->n, k->p, k->q);
 
+    for (i = 2; i < primes; i++)
+      mpz_mul(k->n, k->n, rs[i]);
+
     if (mpz_bitlen(k->n) != bits)
       continue;
 
-    /* Euler's totient: (p - 1) * (q - 1). */
+    /* Euler's totient: (p - 1) * (q - 1) * ... */
     mpz_sub_ui(pm1, k->p, 1);
     mpz_sub_ui(qm1, k->q, 1);
     mpz_mul(phi, pm1, qm1);
 
+    /* Carmichael's function: lcm(p - 1, q - 1, ...). */
+    mpz_gcd(tmp, pm1, qm1);
+    mpz_divexact(lam, phi, tmp);
+
+    for (i = 2; i < primes; i++) {
+      mpz_sub_ui(tmp, rs[i], 1);
+      mpz_mul(phi, phi, tmp);
+      mpz_lcm(lam, lam, tmp);
+    }
+
     mpz_gcd(tmp, k->e, phi);
 
     if (mpz_cmp_ui(tmp, 1) != 0)
       continue;
 
-    /* Carmichael's function: lcm(p - 1, q - 1). */
-    mpz_gcd(tmp, pm1, qm1);
-    mpz_divexact(lam, phi, tmp);
-
     if (!mpz_invert(k->d, k->e, lam))
       continue;
 
@@ -514,9 +790,27 @@ rsa_priv_generate(rsa_priv_t *k,
 
     ASSERT(mpz_invert(k->qi, k->q, k->p));
 
+    /* t_i = (r_1 * r_2 * ... * r_(i-1))^-1 mod r_i */
+    mpz_mul(tmp, k->p, k->q);
+
+    for (i = 0; i < k->count; i++) {
+      rsa_prime_t *x = &k->others[i];
+
+      mpz_sub_ui(pm1, x->r, 1);
+      mpz_mod(x->d, k->d, pm1);
+
+      ASSERT(mpz_invert(x->t, tmp, x->r));
+
+      mpz_mul(tmp, tmp, x->r);
+    }
+
     break;
   }
 
+  ret = 1;
+fail:
+  torsion_memzero(seed, sizeof(seed));
+  torsion_memzero(jobs, sizeof(jobs));
   torsion_memzero(&rng, sizeof(rng));
 
   mpz_cleanse(pm1);
@@ -525,11 +819,29 @@ rsa_priv_generate(rsa_priv_t *k,
   mpz_cleanse(lam);
   mpz_cleanse(tmp);
 
-  return 1;
+  return ret;
 }
 
 static int
 rsa_priv_is_sane(const rsa_priv_t *k) {
+  int i;
+
+  if (k->count < 0 || k->count > RSA_MAX_PRIMES - 2)
+    return 0;
+
+  for (i = 0; i < k->count; i++) {
+    const rsa_prime_t *x = &k->others[i];
+
+    if (mpz_sgn(x->r) <= 0 || mpz_bitlen(x->r) > RSA_MAX_MOD_BITS)
+      return 0;
+
+    if (mpz_sgn(x->d) <= 0 || mpz_bitlen(x->d) > RSA_MAX_MOD_BITS)
+      return 0;
+
+    if (mpz_sgn(x->t) <= 0 || mpz_bitlen(x->t) > RSA_MAX_MOD_BITS)
+      return 0;
+  }
+
   /* DoS limits. */
   return mpz_sgn(k->n) > 0
       && mpz_sgn(k->e) > 0
@@ -552,8 +864,11 @@ rsa_priv_is_sane(const rsa_priv_t *k) {
 static int
 rsa_priv_verify(const rsa_priv_t *k) {
   /* [RFC8017] Page 9, Section 3.2. */
+  mpz_srcptr rs[RSA_MAX_PRIMES];
   mpz_t pm1, qm1, phi, lam, tmp;
+  int primes = k->count + 2;
   int ret = 0;
+  int i, j;
 
   if (!rsa_priv_is_sane(k))
     return 0;
@@ -564,6 +879,12 @@ rsa_priv_verify(const rsa_priv_t *k) {
   mpz_init(lam);
   mpz_init(tmp);
 
+  rs[0] = k->p;
+  rs[1] = k->q;
+
+  for (i = 2; i < primes; i++)
+    rs[i] = k->others[i - 2].r;
+
   /* n >= 2^511 and n mod 2 != 0 */
   if (mpz_bitlen(k->n) < RSA_MIN_MOD_BITS || !mpz_odd_p(k->n))
     goto fail;
@@ -572,19 +893,27 @@ rsa_priv_verify(const rsa_priv_t *k) {
   if (mpz_cmp_ui(k->e, RSA_MIN_EXP) < 0 || !mpz_odd_p(k->e))
     goto fail;
 
-  /* p >= 3 and p mod 2 != 0 */
-  if (mpz_cmp_ui(k->p, 3) < 0 || !mpz_odd_p(k->p))
-    goto fail;
-
-  /* q >= 3 and q mod 2 != 0 */
-  if (mpz_cmp_ui(k->q, 3) < 0 || !mpz_odd_p(k->q))
-    goto fail;
+  /* r_i >= 3 and r_i mod 2 != 0 */
+  for (i = 0; i < primes; i++) {
+    if (mpz_cmp_ui(rs[i], 3) < 0 || !mpz_odd_p(rs[i]))
+      goto fail;
+  }
 
-  /* phi = (p - 1) * (q - 1)  */
+  /* phi = (p - 1) * (q - 1) * ... */
   mpz_sub_ui(pm1, k->p, 1);
   mpz_sub_ui(qm1, k->q, 1);
   mpz_mul(phi, pm1, qm1);
 
+  /* lam = lcm(p - 1, q - 1, ...) */
+  mpz_gcd(tmp, pm1, qm1);
+  mpz_divexact(lam, phi, tmp);
+
+  for (i = 2; i < primes; i++) {
+    mpz_sub_ui(tmp, rs[i], 1);
+    mpz_mul(phi, phi, tmp);
+    mpz_lcm(lam, lam, tmp);
+  }
+
   /* d >= 2 and d < phi */
   if (mpz_cmp_ui(k->d, 2) < 0 || mpz_cmp(k->d, phi) >= 0)
     goto fail;
@@ -601,20 +930,23 @@ rsa_priv_verify(const rsa_priv_t *k) {
   if (mpz_cmp_ui(k->qi, 2) < 0 || mpz_cmp(k->qi, k->p) >= 0)
     goto fail;
 
-  /* p != q */
-  if (mpz_cmp(k->p, k->q) == 0)
-    goto fail;
+  /* r_i != r_j */
+  for (i = 0; i < primes; i++) {
+    for (j = i + 1; j < primes; j++) {
+      if (mpz_cmp(rs[i], rs[j]) == 0)
+        goto fail;
+    }
+  }
 
-  /* n == p * q */
+  /* n == p * q * ... */
   mpz_mul(tmp, k->p, k->q);
 
+  for (i = 2; i < primes; i++)
+    mpz_mul(tmp, tmp, rs[i]);
+
   if (mpz_cmp(tmp, k->n) != 0)
     goto fail;
 
-  /* lam = lcm(p - 1, q - 1) */
-  mpz_gcd(tmp, pm1, qm1);
-  mpz_divexact(lam, phi, tmp);
-
   /* e * d mod lam == 1 */
   mpz_mul(tmp, k->e, k->d);
   mpz_mod(tmp, tmp, lam);
@@ -641,6 +973,33 @@ rsa_priv_verify(const rsa_priv_t *k) {
   if (mpz_cmp_ui(tmp, 1) != 0)
     goto fail;
 
+  /* phi = p * q */
+  mpz_mul(phi, k->p, k->q);
+
+  for (i = 0; i < k->count; i++) {
+    const rsa_prime_t *x = &k->others[i];
+
+    mpz_sub_ui(pm1, x->r, 1);
+
+    /* d_i == d mod (r_i - 1) */
+    mpz_mod(tmp, k->d, pm1);
+
+    if (mpz_cmp(tmp, x->d) != 0)
+      goto fail;
+
+    /* t_i < r_i and (r_1 * ... * r_(i-1)) * t_i mod r_i == 1 */
+    if (mpz_cmp(x->t, x->r) >= 0)
+      goto fail;
+
+    mpz_mul(tmp, phi, x->t);
+    mpz_mod(tmp, tmp, x->r);
+
+    if (mpz_cmp_ui(tmp, 1) != 0)
+      goto fail;
+
+    mpz_mul(phi, phi, x->r);
+  }
+
   ret = 1;
 fail:
   mpz_cleanse(pm1);
@@ -651,6 +1010,39 @@ fail:
   return ret;
 }
 
+static int
+rsa_priv_precompute(rsa_priv_t *k) {
+  /* Montgomery constants for n and each prime. */
+  int i;
+
+  if (!mpz_mont_set(k->mont_n, k->n))
+    return 0;
+
+  if (!mpz_mont_set(k->mont_p, k->p))
+    return 0;
+
+  if (!mpz_mont_set(k->mont_q, k->q))
+    return 0;
+
+  for (i = 0; i < k->count; i++) {
+    if (!mpz_mont_set(k->others[i].mont_r, k->others[i].r))
+      return 0;
+  }
+
+  return 1;
+}
+
+static int
+rsa_priv_load(rsa_priv_t *k, const unsigned char *data, size_t len) {
+  if (!rsa_priv_import(k, data, len))
+    return 0;
+
+  if (!rsa_priv_verify(k))
+    return 0;
+
+  return rsa_priv_precompute(k);
+}
+
 static int
 rsa_priv_set_pqe(rsa_priv_t *out,
                  const mpz_t p0,
@@ -902,8 +1294,87 @@ done:
   return ret;
 }
 
+/*
+ * Blinding
+ */
+
+/* Number of operations before a blinding pair is
+ * discarded and regenerated. Between refreshes the
+ * pair is squared, as is done in OpenSSL.
+ */
+#define RSA_BLIND_REFRESH 32
+
+static void
+rsa_blind_init(rsa_blind_t *blind) {
+  mpz_init(blind->b);
+  mpz_init(blind->bi);
+  blind->uses = 0;
+}
+
+static void
+rsa_blind_clear(rsa_blind_t *blind) {
+  mpz_cleanse(blind->b);
+  mpz_cleanse(blind->bi);
+  blind->uses = 0;
+}
+
+static void
+rsa_blind_generate(mpz_t b, mpz_t bi, const rsa_priv_t *k, drbg_t *rng) {
+  mpz_t s;
+
+  mpz_init(s);
+
+  do {
+    /* s = random integer in [1,n-1] */
+    /* bi = s^-1 mod n */
+    mpz_urandomm(s, k->n, drbg_rng, rng);
+  } while (!mpz_invert(bi, s, k->n));
+
+  /* b = s^e mod n */
+  mpz_mont_powm(b, s, k->e, k->mont_n);
+
+  mpz_cleanse(s);
+}
+
+static void
+rsa_blind_update(rsa_blind_t *blind, const rsa_priv_t *k, drbg_t *rng) {
+  if (blind->uses == 0) {
+    rsa_blind_generate(blind->b, blind->bi, k, rng);
+    blind->uses = RSA_BLIND_REFRESH;
+  } else {
+    /* (s^2)^e = b^2 mod n */
+    /* (s^2)^-1 = bi^2 mod n */
+    mpz_sqr(blind->b, blind->b);
+    mpz_mod(blind->b, blind->b, k->n);
+    mpz_sqr(blind->bi, blind->bi);
+    mpz_mod(blind->bi, blind->bi, k->n);
+  }
+
+  blind->uses--;
+}
+
+static void
+rsa_powm_job(void *arg) {
+  rsa_powm_t *job = (rsa_powm_t *)arg;
+
+  mpz_mont_powm_sec(job->z, job->x, job->y, job->mont);
+}
+
+static void
+rsa_powm_set(rsa_powm_t *job,
+             mpz_t z,
+             const mpz_t x,
+             const mpz_t y,
+             const mpz_mont_t mont) {
+  job->z = z;
+  job->x = x;
+  job->y = y;
+  job->mont = mont;
+}
+
 static int
 rsa_priv_decrypt(const rsa_priv_t *k,
+                 rsa_blind_t *blind,
                  unsigned char *out,
                  const unsigned char *msg,
                  size_t msg_len, int use_crt,
@@ -911,13 +1382,17 @@ rsa_priv_decrypt(const rsa_priv_t *k,
   /* [RFC8017] Page 13, Section 5.1.2.
    *           Page 15, Section 5.2.1.
    */
-  mpz_t s, b, bi, c, m, mp, mq, md;
+  mpz_t b, bi, c, m, mp, mq, md, pr;
+  mpz_t mr[RSA_MAX_PRIMES - 2];
+  rsa_powm_t jobs[RSA_MAX_PRIMES];
+  void *args[RSA_MAX_PRIMES];
+  int len = 2 + k->count;
   int ret = 0;
   drbg_t rng;
+  int i;
 
   drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
 
-  mpz_init(s);
   mpz_init(b);
   mpz_init(bi);
   mpz_init(c);
@@ -925,6 +1400,10 @@ rsa_priv_decrypt(const rsa_priv_t *k,
   mpz_init(mp);
   mpz_init(mq);
   mpz_init(md);
+  mpz_init(pr);
+
+  for (i = 0; i < RSA_MAX_PRIMES - 2; i++)
+    mpz_init(mr[i]);
 
   if (mpz_sgn(k->n) <= 0 || mpz_sgn(k->d) <= 0)
     goto fail;
@@ -939,20 +1418,28 @@ rsa_priv_decrypt(const rsa_priv_t *k,
   if (mpz_sgn(k->dq) <= 0 || !mpz_odd_p(k->q))
     goto fail;
 
+  /* Ensure rsa_priv_precompute was called. */
+  if (k->mont_n->size == 0 || k->mont_p->size == 0 || k->mont_q->size == 0)
+    goto fail;
+
+  for (i = 0; i < k->count; i++) {
+    if (k->others[i].mont_r->size == 0)
+      goto fail;
+  }
+
   mpz_import(c, msg, msg_len, 1);
 
   if (mpz_cmp(c, k->n) >= 0)
     goto fail;
 
-  /* Generate blinding factor. */
-  do {
-    /* s = random integer in [1,n-1] */
-    /* bi = s^-1 mod n */
-    mpz_urandomm(s, k->n, drbg_rng, &rng);
-  } while (!mpz_invert(bi, s, k->n));
-
-  /* b = s^e mod n */
-  mpz_powm(b, s, k->e, k->n);
+  /* Generate or update blinding factor. */
+  if (blind != NULL) {
+    rsa_blind_update(blind, k, &rng);
+    mpz_set(b, blind->b);
+    mpz_set(bi, blind->bi);
+  } else {
+    rsa_blind_generate(b, bi, k, &rng);
+  }
 
   /* c = c * b mod n (blind) */
   mpz_mul(c, c, b);
@@ -967,9 +1454,39 @@ rsa_priv_decrypt(const rsa_priv_t *k,
      *   mq = c^(d mod q-1) mod q
      *   md = (mp - mq) / q mod p
      *   m = (md * q + mq) mod n
+     *
+     * Multi-prime keys continue with Garner's
+     * algorithm ([RFC8017] Page 14, Section 5.1.2):
+     *
+     *   R = p * q * ... * r_(i-1)
+     *   mr = c^(d mod r_i-1) mod r_i
+     *   md = (mr - m) * t_i mod r_i
+     *   m = m + R * md
+     *
+     * The exponentiations do not depend on each
+     * other and are computed up front, handing them
+     * to the caller's runner if one was installed.
+     * A runner which drops a job is caught by the
+     * m^e == c check below.
      */
-    mpz_powm_sec(mp, c, k->dp, k->p);
-    mpz_powm_sec(mq, c, k->dq, k->q);
+    rsa_powm_set(&jobs[0], mp, c, k->dp, k->mont_p);
+    rsa_powm_set(&jobs[1], mq, c, k->dq, k->mont_q);
+
+    for (i = 0; i < k->count; i++) {
+      const rsa_prime_t *x = &k->others[i];
+
+      rsa_powm_set(&jobs[2 + i], mr[i], c, x->d, x->mont_r);
+    }
+
+    if (k->run != NULL) {
+      for (i = 0; i < len; i++)
+        args[i] = &jobs[i];
+
+      k->run(rsa_powm_job, args, len, k->arg);
+    } else {
+      for (i = 0; i < len; i++)
+        rsa_powm_job(&jobs[i]);
+    }
 
     mpz_sub(md, mp, mq);
     mpz_mul(md, md, k->qi);
@@ -979,13 +1496,30 @@ rsa_priv_decrypt(const rsa_priv_t *k,
     mpz_add(m, m, mq);
     mpz_mod(m, m, k->n);
 
-    mpz_powm(mp, m, k->e, k->n);
+    if (k->count > 0) {
+      mpz_mul(pr, k->p, k->q);
 
-    if (mpz_cmp(mp, c) != 0)
-      goto fail;
-  } else {
+      for (i = 0; i < k->count; i++) {
+        const rsa_prime_t *x = &k->others[i];
+
+        mpz_sub(md, mr[i], m);
+        mpz_mul(md, md, x->t);
+        mpz_mod(md, md, x->r);
+
+        mpz_mul(md, md, pr);
+        mpz_add(m, m, md);
+
+        mpz_mul(pr, pr, x->r);
+      }
+    }
+
+    mpz_mont_powm(mp, m, k->e, k->mont_n);
+
+    if (mpz_cmp(mp, c) != 0)
+      goto fail;
+  } else {
     /* m = c^d mod n */
-    mpz_powm_sec(m, c, k->d, k->n);
+    mpz_mont_powm_sec(m, c, k->d, k->mont_n);
   }
 
   /* m = m * bi mod n (unblind) */
@@ -995,7 +1529,6 @@ rsa_priv_decrypt(const rsa_priv_t *k,
 
   ret = 1;
 fail:
-  mpz_cleanse(s);
   mpz_cleanse(b);
   mpz_cleanse(bi);
   mpz_cleanse(c);
@@ -1003,6 +1536,11 @@ fail:
   mpz_cleanse(mp);
   mpz_cleanse(mq);
   mpz_cleanse(md);
+  mpz_cleanse(pr);
+
+  for (i = 0; i < RSA_MAX_PRIMES - 2; i++)
+    mpz_cleanse(mr[i]);
+
   return ret;
 }
 
@@ -1014,12 +1552,14 @@ static void
 rsa_pub_init(rsa_pub_t *k) {
   mpz_init(k->n);
   mpz_init(k->e);
+  mpz_mont_init(k->mont_n);
 }
 
 static void
 rsa_pub_clear(rsa_pub_t *k) {
   mpz_cleanse(k->n);
   mpz_cleanse(k->e);
+  mpz_mont_clear(k->mont_n);
 }
 
 TORSION_UNUSED static void
@@ -1106,6 +1646,22 @@ rsa_pub_verify(const rsa_pub_t *k) {
   return 1;
 }
 
+static int
+rsa_pub_precompute(rsa_pub_t *k) {
+  return mpz_mont_set(k->mont_n, k->n);
+}
+
+static int
+rsa_pub_load(rsa_pub_t *k, const unsigned char *data, size_t len) {
+  if (!rsa_pub_import(k, data, len))
+    return 0;
+
+  if (!rsa_pub_verify(k))
+    return 0;
+
+  return rsa_pub_precompute(k);
+}
+
 static int
 rsa_pub_encrypt(const rsa_pub_t *k,
                 unsigned char *out,
@@ -1122,13 +1678,17 @@ rsa_pub_encrypt(const rsa_pub_t *k,
   if (mpz_sgn(k->n) <= 0 || mpz_sgn(k->e) <= 0)
     goto fail;
 
+  /* Ensure rsa_pub_precompute was called. */
+  if (k->mont_n->size == 0)
+    goto fail;
+
   mpz_import(m, msg, msg_len, 1);
 
   if (mpz_cmp(m, k->n) >= 0)
     goto fail;
 
   /* c = m^e mod n */
-  mpz_powm(m, m, k->e, k->n);
+  mpz_mont_powm(m, m, k->e, k->mont_n);
   mpz_export(out, m, mpz_bytelen(k->n), 1);
 
   ret = 1;
@@ -1445,7 +2005,59 @@ rsa_privkey_generate(unsigned char *out,
   if (bits > RSA_MAX_MOD_BITS)
     goto fail;
 
-  if (!rsa_priv_generate(&k, bits, exp, entropy))
+  if (!rsa_priv_generate(&k, bits, exp, 2, entropy, NULL, NULL))
+    goto fail;
+
+  rsa_priv_export(out, out_len, &k);
+  ret = 1;
+fail:
+  rsa_priv_clear(&k);
+  return ret;
+}
+
+int
+rsa_privkey_generate_multi(unsigned char *out,
+                           size_t *out_len,
+                           unsigned int bits,
+                           uint64_t exp,
+                           unsigned int primes,
+                           const unsigned char *entropy) {
+  rsa_priv_t k;
+  int ret = 0;
+
+  rsa_priv_init(&k);
+
+  if (bits > RSA_MAX_MOD_BITS || primes > RSA_MAX_PRIMES)
+    goto fail;
+
+  if (!rsa_priv_generate(&k, bits, exp, primes, entropy, NULL, NULL))
+    goto fail;
+
+  rsa_priv_export(out, out_len, &k);
+  ret = 1;
+fail:
+  rsa_priv_clear(&k);
+  return ret;
+}
+
+int
+rsa_privkey_generate_with_runner(unsigned char *out,
+                                 size_t *out_len,
+                                 unsigned int bits,
+                                 uint64_t exp,
+                                 unsigned int primes,
+                                 const unsigned char *entropy,
+                                 rsa_run_f *run,
+                                 void *arg) {
+  rsa_priv_t k;
+  int ret = 0;
+
+  rsa_priv_init(&k);
+
+  if (bits > RSA_MAX_MOD_BITS || primes > RSA_MAX_PRIMES)
+    goto fail;
+
+  if (!rsa_priv_generate(&k, bits, exp, primes, entropy, run, arg))
     goto fail;
 
   rsa_priv_export(out, out_len, &k);
@@ -1544,6 +2156,10 @@ rsa_privkey_export(unsigned char *out,
   if (!rsa_priv_verify(&k))
     goto fail;
 
+  /* The raw format has no room for other primes. */
+  if (k.count > 0)
+    goto fail;
+
   rsa_priv_export_dumb(out, out_len, &k);
   ret = 1;
 fail:
@@ -1662,15 +2278,15 @@ fail:
   return ret;
 }
 
-int
-rsa_sign(unsigned char *out,
-         size_t *out_len,
-         hash_id_t type,
-         const unsigned char *msg,
-         size_t msg_len,
-         const unsigned char *key,
-         size_t key_len,
-         const unsigned char *entropy) {
+static int
+rsa_sign_inner(unsigned char *out,
+               size_t *out_len,
+               hash_id_t type,
+               const unsigned char *msg,
+               size_t msg_len,
+               const rsa_priv_t *k,
+               rsa_blind_t *blind,
+               const unsigned char *entropy) {
   /* [RFC8017] Page 36, Section 8.2.1.
    *           Page 45, Section 9.2.
    */
@@ -1678,31 +2294,21 @@ rsa_sign(unsigned char *out,
   size_t i, prefix_len, tlen, klen;
   const unsigned char *prefix;
   unsigned char *em = out;
-  rsa_priv_t k;
-  int ret = 0;
-
-  rsa_priv_init(&k);
 
   if (!get_digest_info(&prefix, &prefix_len, type))
-    goto fail;
+    return 0;
 
   if (type == HASH_NONE)
     hlen = msg_len;
 
   if (msg_len != hlen)
-    goto fail;
-
-  if (!rsa_priv_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_priv_verify(&k))
-    goto fail;
+    return 0;
 
   tlen = prefix_len + hlen;
-  klen = mpz_bytelen(k.n);
+  klen = mpz_bytelen(k->n);
 
   if (klen < tlen + 11)
-    goto fail;
+    return 0;
 
   /* EM = 0x00 || 0x01 || PS || 0x00 || T */
   em[0] = 0x00;
@@ -1719,24 +2325,43 @@ rsa_sign(unsigned char *out,
   if (msg_len > 0)
     memcpy(em + klen - hlen, msg, msg_len);
 
-  if (!rsa_priv_decrypt(&k, out, em, klen, 1, entropy))
-    goto fail;
+  if (!rsa_priv_decrypt(k, blind, out, em, klen, 1, entropy))
+    return 0;
 
   *out_len = klen;
-  ret = 1;
-fail:
+
+  return 1;
+}
+
+int
+rsa_sign(unsigned char *out,
+         size_t *out_len,
+         hash_id_t type,
+         const unsigned char *msg,
+         size_t msg_len,
+         const unsigned char *key,
+         size_t key_len,
+         const unsigned char *entropy) {
+  rsa_priv_t k;
+  int ret = 0;
+
+  rsa_priv_init(&k);
+
+  if (rsa_priv_load(&k, key, key_len))
+    ret = rsa_sign_inner(out, out_len, type, msg, msg_len, &k, NULL, entropy);
+
   rsa_priv_clear(&k);
+
   return ret;
 }
 
-int
-rsa_verify(hash_id_t type,
-           const unsigned char *msg,
-           size_t msg_len,
-           const unsigned char *sig,
-           size_t sig_len,
-           const unsigned char *key,
-           size_t key_len) {
+static int
+rsa_verify_inner(hash_id_t type,
+                 const unsigned char *msg,
+                 size_t msg_len,
+                 const unsigned char *sig,
+                 size_t sig_len,
+                 const rsa_pub_t *k) {
   /* [RFC8017] Page 37, Section 8.2.2.
    *           Page 45, Section 9.2.
    */
@@ -1746,11 +2371,8 @@ rsa_verify(hash_id_t type,
   const unsigned char *prefix;
   unsigned char *em = NULL;
   uint32_t ok;
-  rsa_pub_t k;
   int ret = 0;
 
-  rsa_pub_init(&k);
-
   if (!get_digest_info(&prefix, &prefix_len, type))
     goto fail;
 
@@ -1760,14 +2382,8 @@ rsa_verify(hash_id_t type,
   if (msg_len != hlen)
     goto fail;
 
-  if (!rsa_pub_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_pub_verify(&k))
-    goto fail;
-
   tlen = prefix_len + hlen;
-  klen = mpz_bytelen(k.n);
+  klen = mpz_bytelen(k->n);
 
   if (sig_len != klen)
     goto fail;
@@ -1780,7 +2396,7 @@ rsa_verify(hash_id_t type,
   if (em == NULL)
     goto fail;
 
-  if (!rsa_pub_encrypt(&k, em, sig, sig_len))
+  if (!rsa_pub_encrypt(k, em, sig, sig_len))
     goto fail;
 
   /* EM = 0x00 || 0x01 || PS || 0x00 || T */
@@ -1798,38 +2414,48 @@ rsa_verify(hash_id_t type,
 
   ret = (ok == 1);
 fail:
-  rsa_pub_clear(&k);
   if (em != NULL) free(em);
   return ret;
 }
 
 int
-rsa_encrypt(unsigned char *out,
-            size_t *out_len,
-            const unsigned char *msg,
-            size_t msg_len,
-            const unsigned char *key,
-            size_t key_len,
-            const unsigned char *entropy) {
+rsa_verify(hash_id_t type,
+           const unsigned char *msg,
+           size_t msg_len,
+           const unsigned char *sig,
+           size_t sig_len,
+           const unsigned char *key,
+           size_t key_len) {
+  rsa_pub_t k;
+  int ret = 0;
+
+  rsa_pub_init(&k);
+
+  if (rsa_pub_load(&k, key, key_len))
+    ret = rsa_verify_inner(type, msg, msg_len, sig, sig_len, &k);
+
+  rsa_pub_clear(&k);
+
+  return ret;
+}
+
+static int
+rsa_encrypt_inner(unsigned char *out,
+                  size_t *out_len,
+                  const unsigned char *msg,
+                  size_t msg_len,
+                  const rsa_pub_t *k,
+                  const unsigned char *entropy) {
   /* [RFC8017] Page 28, Section 7.2.1. */
   unsigned char *em = out;
   size_t i, mlen, plen;
   size_t klen = 0;
-  rsa_pub_t k;
   int ret = 0;
   drbg_t rng;
 
   drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
 
-  rsa_pub_init(&k);
-
-  if (!rsa_pub_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_pub_verify(&k))
-    goto fail;
-
-  klen = mpz_bytelen(k.n);
+  klen = mpz_bytelen(k->n);
 
   if (klen < 11)
     goto fail;
@@ -1856,43 +2482,54 @@ rsa_encrypt(unsigned char *out,
   if (msg_len > 0)
     memcpy(em + klen - mlen, msg, msg_len);
 
-  if (!rsa_pub_encrypt(&k, out, em, klen))
+  if (!rsa_pub_encrypt(k, out, em, klen))
     goto fail;
 
   *out_len = klen;
   ret = 1;
 fail:
-  rsa_pub_clear(&k);
   torsion_memzero(&rng, sizeof(rng));
   if (ret == 0) torsion_memzero(out, klen);
   return ret;
 }
 
 int
-rsa_decrypt(unsigned char *out,
+rsa_encrypt(unsigned char *out,
             size_t *out_len,
             const unsigned char *msg,
             size_t msg_len,
             const unsigned char *key,
             size_t key_len,
             const unsigned char *entropy) {
+  rsa_pub_t k;
+  int ret = 0;
+
+  rsa_pub_init(&k);
+
+  if (rsa_pub_load(&k, key, key_len))
+    ret = rsa_encrypt_inner(out, out_len, msg, msg_len, &k, entropy);
+
+  rsa_pub_clear(&k);
+
+  return ret;
+}
+
+static int
+rsa_decrypt_inner(unsigned char *out,
+                  size_t *out_len,
+                  const unsigned char *msg,
+                  size_t msg_len,
+                  const rsa_priv_t *k,
+                  rsa_blind_t *blind,
+                  const unsigned char *entropy) {
   /* [RFC8017] Page 29, Section 7.2.2. */
   unsigned char *em = out;
   uint32_t i, zero, two, index, looking;
   uint32_t equals0, validps, valid, offset;
   size_t klen = 0;
-  rsa_priv_t k;
   int ret = 0;
 
-  rsa_priv_init(&k);
-
-  if (!rsa_priv_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_priv_verify(&k))
-    goto fail;
-
-  klen = mpz_bytelen(k.n);
+  klen = mpz_bytelen(k->n);
 
   if (msg_len != klen)
     goto fail;
@@ -1900,7 +2537,7 @@ rsa_decrypt(unsigned char *out,
   if (klen < 11)
     goto fail;
 
-  if (!rsa_priv_decrypt(&k, em, msg, msg_len, 1, entropy))
+  if (!rsa_priv_decrypt(k, blind, em, msg, msg_len, 1, entropy))
     goto fail;
 
   /* EM = 0x00 || 0x02 || PS || 0x00 || M */
@@ -1927,21 +2564,41 @@ rsa_decrypt(unsigned char *out,
 
   ret = 1;
 fail:
-  rsa_priv_clear(&k);
   if (ret == 0) torsion_memzero(out, klen);
   return ret;
 }
 
 int
-rsa_sign_pss(unsigned char *out,
-             size_t *out_len,
-             hash_id_t type,
-             const unsigned char *msg,
-             size_t msg_len,
-             const unsigned char *key,
-             size_t key_len,
-             size_t salt_len,
-             const unsigned char *entropy) {
+rsa_decrypt(unsigned char *out,
+            size_t *out_len,
+            const unsigned char *msg,
+            size_t msg_len,
+            const unsigned char *key,
+            size_t key_len,
+            const unsigned char *entropy) {
+  rsa_priv_t k;
+  int ret = 0;
+
+  rsa_priv_init(&k);
+
+  if (rsa_priv_load(&k, key, key_len))
+    ret = rsa_decrypt_inner(out, out_len, msg, msg_len, &k, NULL, entropy);
+
+  rsa_priv_clear(&k);
+
+  return ret;
+}
+
+static int
+rsa_sign_pss_inner(unsigned char *out,
+                   size_t *out_len,
+                   hash_id_t type,
+                   const unsigned char *msg,
+                   size_t msg_len,
+                   const rsa_priv_t *k,
+                   rsa_blind_t *blind,
+                   size_t salt_len,
+                   const unsigned char *entropy) {
   /* [RFC8017] Page 33, Section 8.1.1. */
   size_t hlen = hash_output_size(type);
   unsigned char *salt = NULL;
@@ -1949,25 +2606,16 @@ rsa_sign_pss(unsigned char *out,
   size_t klen = 0;
   mp_bits_t bits;
   size_t emlen;
-  rsa_priv_t k;
   int ret = 0;
   drbg_t rng;
 
-  rsa_priv_init(&k);
-
   if (!hash_has_backend(type))
     goto fail;
 
   if (msg_len != hlen)
     goto fail;
 
-  if (!rsa_priv_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_priv_verify(&k))
-    goto fail;
-
-  bits = mpz_bitlen(k.n);
+  bits = mpz_bitlen(k->n);
   klen = (bits + 7) / 8;
   emlen = (bits + 6) / 8;
 
@@ -2000,13 +2648,12 @@ rsa_sign_pss(unsigned char *out,
    * than the modulus size in the case
    * of (bits - 1) mod 8 == 0.
    */
-  if (!rsa_priv_decrypt(&k, out, em, emlen, 1, entropy))
+  if (!rsa_priv_decrypt(k, blind, out, em, emlen, 1, entropy))
     goto fail;
 
   *out_len = klen;
   ret = 1;
 fail:
-  rsa_priv_clear(&k);
   torsion_memzero(&rng, sizeof(rng));
   if (salt != NULL) free(salt);
   if (ret == 0) torsion_memzero(out, klen);
@@ -2014,37 +2661,51 @@ fail:
 }
 
 int
-rsa_verify_pss(hash_id_t type,
-               const unsigned char *msg,
-               size_t msg_len,
-               const unsigned char *sig,
-               size_t sig_len,
-               const unsigned char *key,
-               size_t key_len,
-               size_t salt_len) {
+rsa_sign_pss(unsigned char *out,
+             size_t *out_len,
+             hash_id_t type,
+             const unsigned char *msg,
+             size_t msg_len,
+             const unsigned char *key,
+             size_t key_len,
+             size_t salt_len,
+             const unsigned char *entropy) {
+  rsa_priv_t k;
+  int ret = 0;
+
+  rsa_priv_init(&k);
+
+  if (rsa_priv_load(&k, key, key_len))
+    ret = rsa_sign_pss_inner(out, out_len, type, msg, msg_len,
+                             &k, NULL, salt_len, entropy);
+
+  rsa_priv_clear(&k);
+
+  return ret;
+}
+
+static int
+rsa_verify_pss_inner(hash_id_t type,
+                     const unsigned char *msg,
+                     size_t msg_len,
+                     const unsigned char *sig,
+                     size_t sig_len,
+                     const rsa_pub_t *k,
+                     size_t salt_len) {
   /* [RFC8017] Page 34, Section 8.1.2. */
   size_t hlen = hash_output_size(type);
   unsigned char *em = NULL;
   size_t klen = 0;
   mp_bits_t bits;
-  rsa_pub_t k;
   int ret = 0;
 
-  rsa_pub_init(&k);
-
   if (!hash_has_backend(type))
     goto fail;
 
   if (msg_len != hlen)
     goto fail;
 
-  if (!rsa_pub_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_pub_verify(&k))
-    goto fail;
-
-  bits = mpz_bitlen(k.n);
+  bits = mpz_bitlen(k->n);
   klen = (bits + 7) / 8;
 
   if (sig_len != klen)
@@ -2063,7 +2724,7 @@ rsa_verify_pss(hash_id_t type,
   if (em == NULL)
     goto fail;
 
-  if (!rsa_pub_encrypt(&k, em, sig, sig_len))
+  if (!rsa_pub_encrypt(k, em, sig, sig_len))
     goto fail;
 
   /* Edge case: the encoding crossed a
@@ -2085,22 +2746,43 @@ rsa_verify_pss(hash_id_t type,
 
   ret = 1;
 fail:
-  rsa_pub_clear(&k);
   if (em != NULL) free(em);
   return ret;
 }
 
 int
-rsa_encrypt_oaep(unsigned char *out,
-                 size_t *out_len,
-                 hash_id_t type,
-                 const unsigned char *msg,
-                 size_t msg_len,
-                 const unsigned char *key,
-                 size_t key_len,
-                 const unsigned char *label,
-                 size_t label_len,
-                 const unsigned char *entropy) {
+rsa_verify_pss(hash_id_t type,
+               const unsigned char *msg,
+               size_t msg_len,
+               const unsigned char *sig,
+               size_t sig_len,
+               const unsigned char *key,
+               size_t key_len,
+               size_t salt_len) {
+  rsa_pub_t k;
+  int ret = 0;
+
+  rsa_pub_init(&k);
+
+  if (rsa_pub_load(&k, key, key_len))
+    ret = rsa_verify_pss_inner(type, msg, msg_len,
+                               sig, sig_len, &k, salt_len);
+
+  rsa_pub_clear(&k);
+
+  return ret;
+}
+
+static int
+rsa_encrypt_oaep_inner(unsigned char *out,
+                       size_t *out_len,
+                       hash_id_t type,
+                       const unsigned char *msg,
+                       size_t msg_len,
+                       const rsa_pub_t *k,
+                       const unsigned char *label,
+                       size_t label_len,
+                       const unsigned char *entropy) {
   /* [RFC8017] Page 22, Section 7.1.1. */
   unsigned char lhash[HASH_MAX_OUTPUT_SIZE];
   unsigned char *em = out;
@@ -2109,23 +2791,14 @@ rsa_encrypt_oaep(unsigned char *out,
   size_t klen = 0;
   size_t mlen = msg_len;
   size_t slen, dlen;
-  rsa_pub_t k;
   hash_t hash;
   int ret = 0;
   drbg_t rng;
 
-  rsa_pub_init(&k);
-
   if (!hash_has_backend(type))
     goto fail;
 
-  if (!rsa_pub_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_pub_verify(&k))
-    goto fail;
-
-  klen = mpz_bytelen(k.n);
+  klen = mpz_bytelen(k->n);
 
   if (klen < 2 * hlen + 2)
     goto fail;
@@ -2159,13 +2832,12 @@ rsa_encrypt_oaep(unsigned char *out,
   mgf1xor(type, db, dlen, seed, slen);
   mgf1xor(type, seed, slen, db, dlen);
 
-  if (!rsa_pub_encrypt(&k, out, em, klen))
+  if (!rsa_pub_encrypt(k, out, em, klen))
     goto fail;
 
   *out_len = klen;
   ret = 1;
 fail:
-  rsa_pub_clear(&k);
   torsion_memzero(&rng, sizeof(drbg_t));
   torsion_memzero(&hash, sizeof(hash_t));
   if (ret == 0) torsion_memzero(out, klen);
@@ -2173,7 +2845,7 @@ fail:
 }
 
 int
-rsa_decrypt_oaep(unsigned char *out,
+rsa_encrypt_oaep(unsigned char *out,
                  size_t *out_len,
                  hash_id_t type,
                  const unsigned char *msg,
@@ -2183,6 +2855,31 @@ rsa_decrypt_oaep(unsigned char *out,
                  const unsigned char *label,
                  size_t label_len,
                  const unsigned char *entropy) {
+  rsa_pub_t k;
+  int ret = 0;
+
+  rsa_pub_init(&k);
+
+  if (rsa_pub_load(&k, key, key_len))
+    ret = rsa_encrypt_oaep_inner(out, out_len, type, msg, msg_len,
+                                 &k, label, label_len, entropy);
+
+  rsa_pub_clear(&k);
+
+  return ret;
+}
+
+static int
+rsa_decrypt_oaep_inner(unsigned char *out,
+                       size_t *out_len,
+                       hash_id_t type,
+                       const unsigned char *msg,
+                       size_t msg_len,
+                       const rsa_priv_t *k,
+                       rsa_blind_t *blind,
+                       const unsigned char *label,
+                       size_t label_len,
+                       const unsigned char *entropy) {
   /* [RFC8017] Page 25, Section 7.1.2. */
   unsigned char *em = out;
   unsigned char *seed, *db, *rest, *lhash;
@@ -2192,22 +2889,13 @@ rsa_decrypt_oaep(unsigned char *out,
   uint32_t zero, lvalid, looking, index;
   uint32_t invalid, valid, equals0, equals1;
   unsigned char expect[HASH_MAX_OUTPUT_SIZE];
-  rsa_priv_t k;
   hash_t hash;
   int ret = 0;
 
-  rsa_priv_init(&k);
-
   if (!hash_has_backend(type))
     goto fail;
 
-  if (!rsa_priv_import(&k, key, key_len))
-    goto fail;
-
-  if (!rsa_priv_verify(&k))
-    goto fail;
-
-  klen = mpz_bytelen(k.n);
+  klen = mpz_bytelen(k->n);
 
   if (msg_len != klen)
     goto fail;
@@ -2215,7 +2903,7 @@ rsa_decrypt_oaep(unsigned char *out,
   if (klen < hlen * 2 + 2)
     goto fail;
 
-  if (!rsa_priv_decrypt(&k, em, msg, msg_len, 1, entropy))
+  if (!rsa_priv_decrypt(k, blind, em, msg, msg_len, 1, entropy))
     goto fail;
 
   hash_init(&hash, type);
@@ -2259,12 +2947,36 @@ rsa_decrypt_oaep(unsigned char *out,
 
   ret = 1;
 fail:
-  rsa_priv_clear(&k);
   torsion_memzero(&hash, sizeof(hash));
   if (ret == 0) torsion_memzero(out, klen);
   return ret;
 }
 
+int
+rsa_decrypt_oaep(unsigned char *out,
+                 size_t *out_len,
+                 hash_id_t type,
+                 const unsigned char *msg,
+                 size_t msg_len,
+                 const unsigned char *key,
+                 size_t key_len,
+                 const unsigned char *label,
+                 size_t label_len,
+                 const unsigned char *entropy) {
+  rsa_priv_t k;
+  int ret = 0;
+
+  rsa_priv_init(&k);
+
+  if (rsa_priv_load(&k, key, key_len))
+    ret = rsa_decrypt_oaep_inner(out, out_len, type, msg, msg_len,
+                                 &k, NULL, label, label_len, entropy);
+
+  rsa_priv_clear(&k);
+
+  return ret;
+}
+
 int
 rsa_veil(unsigned char *out,
          size_t *out_len,
@@ -2343,3 +3055,199 @@ fail:
   rsa_pub_clear(&k);
   return ret;
 }
+
+/*
+ * Key Handles
+ */
+
+struct rsa_key_s {
+  rsa_pub_t pub;
+  rsa_priv_t priv;
+  rsa_blind_t blind;
+  int has_priv;
+};
+
+static rsa_key_t *
+rsa_key_alloc(void) {
+  rsa_key_t *key = (rsa_key_t *)malloc(sizeof(rsa_key_t));
+
+  if (key == NULL)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  rsa_pub_init(&key->pub);
+  rsa_priv_init(&key->priv);
+  rsa_blind_init(&key->blind);
+
+  key->has_priv = 0;
+
+  return key;
+}
+
+rsa_key_t *
+rsa_key_create_private(const unsigned char *key, size_t key_len) {
+  rsa_key_t *k = rsa_key_alloc();
+
+  if (!rsa_priv_load(&k->priv, key, key_len))
+    goto fail;
+
+  mpz_set(k->pub.n, k->priv.n);
+  mpz_set(k->pub.e, k->priv.e);
+
+  if (!rsa_pub_precompute(&k->pub))
+    goto fail;
+
+  k->has_priv = 1;
+
+  return k;
+fail:
+  rsa_key_destroy(k);
+  return NULL;
+}
+
+rsa_key_t *
+rsa_key_create_public(const unsigned char *key, size_t key_len) {
+  rsa_key_t *k = rsa_key_alloc();
+
+  if (!rsa_pub_load(&k->pub, key, key_len)) {
+    rsa_key_destroy(k);
+    return NULL;
+  }
+
+  return k;
+}
+
+void
+rsa_key_destroy(rsa_key_t *key) {
+  if (key != NULL) {
+    rsa_pub_clear(&key->pub);
+    rsa_priv_clear(&key->priv);
+    rsa_blind_clear(&key->blind);
+    torsion_memzero(key, sizeof(*key));
+    free(key);
+  }
+}
+
+int
+rsa_key_has_private(const rsa_key_t *key) {
+  return key->has_priv;
+}
+
+unsigned int
+rsa_key_bits(const rsa_key_t *key) {
+  return mpz_bitlen(key->pub.n);
+}
+
+void
+rsa_key_set_runner(rsa_key_t *key, rsa_run_f *run, void *arg) {
+  key->priv.run = run;
+  key->priv.arg = run != NULL ? arg : NULL;
+}
+
+int
+rsa_key_sign(unsigned char *out,
+             size_t *out_len,
+             hash_id_t type,
+             const unsigned char *msg,
+             size_t msg_len,
+             rsa_key_t *key,
+             const unsigned char *entropy) {
+  if (!key->has_priv)
+    return 0;
+
+  return rsa_sign_inner(out, out_len, type, msg, msg_len,
+                        &key->priv, &key->blind, entropy);
+}
+
+int
+rsa_key_verify(hash_id_t type,
+               const unsigned char *msg,
+               size_t msg_len,
+               const unsigned char *sig,
+               size_t sig_len,
+               const rsa_key_t *key) {
+  return rsa_verify_inner(type, msg, msg_len, sig, sig_len, &key->pub);
+}
+
+int
+rsa_key_encrypt(unsigned char *out,
+                size_t *out_len,
+                const unsigned char *msg,
+                size_t msg_len,
+                const rsa_key_t *key,
+                const unsigned char *entropy) {
+  return rsa_encrypt_inner(out, out_len, msg, msg_len, &key->pub, entropy);
+}
+
+int
+rsa_key_decrypt(unsigned char *out,
+                size_t *out_len,
+                const unsigned char *msg,
+                size_t msg_len,
+                rsa_key_t *key,
+                const unsigned char *entropy) {
+  if (!key->has_priv)
+    return 0;
+
+  return rsa_decrypt_inner(out, out_len, msg, msg_len,
+                           &key->priv, &key->blind, entropy);
+}
+
+int
+rsa_key_sign_pss(unsigned char *out,
+                 size_t *out_len,
+                 hash_id_t type,
+                 const unsigned char *msg,
+                 size_t msg_len,
+                 rsa_key_t *key,
+                 size_t salt_len,
+                 const unsigned char *entropy) {
+  if (!key->has_priv)
+    return 0;
+
+  return rsa_sign_pss_inner(out, out_len, type, msg, msg_len,
+                            &key->priv, &key->blind, salt_len, entropy);
+}
+
+int
+rsa_key_verify_pss(hash_id_t type,
+                   const unsigned char *msg,
+                   size_t msg_len,
+                   const unsigned char *sig,
+                   size_t sig_len,
+                   const rsa_key_t *key,
+                   size_t salt_len) {
+  return rsa_verify_pss_inner(type, msg, msg_len, sig, sig_len, &key->pub,
+                              salt_len);
+}
+
+int
+rsa_key_encrypt_oaep(unsigned char *out,
+                     size_t *out_len,
+                     hash_id_t type,
+                     const unsigned char *msg,
+                     size_t msg_len,
+                     const rsa_key_t *key,
+                     const unsigned char *label,
+                     size_t label_len,
+                     const unsigned char *entropy) {
+  return rsa_encrypt_oaep_inner(out, out_len, type, msg, msg_len, &key->pub,
+                                label, label_len, entropy);
+}
+
+int
+rsa_key_decrypt_oaep(unsigned char *out,
+                     size_t *out_len,
+                     hash_id_t type,
+                     const unsigned char *msg,
+                     size_t msg_len,
+                     rsa_key_t *key,
+                     const unsigned char *label,
+                     size_t label_len,
+                     const unsigned char *entropy) {
+  if (!key->has_priv)
+    return 0;
+
+  return rsa_decrypt_oaep_inner(out, out_len, type, msg, msg_len,
+                                &key->priv, &key->blind,
+                                label, label_len, entropy);
+}
@@ -9,9 +9,12 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <torsion/aead.h>
 #include <torsion/drbg.h>
+#include <torsion/dsa.h>
 #include <torsion/ecc.h>
 #include <torsion/hash.h>
+#include <torsion/kdf.h>
 #include <torsion/rsa.h>
 #include <torsion/stream.h>
 
@@ -140,6 +143,49 @@ bench_ecdsa_pubkey_tweak_add(drbg_t *rng) {
   wei_curve_destroy(ec);
 }
 
+static void
+bench_ecdsa_pubkey_tweak_add_batch(drbg_t *rng) {
+  wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
+  unsigned char entropy1[ENTROPY_SIZE];
+  unsigned char entropy2[ENTROPY_SIZE];
+  unsigned char priv[32];
+  unsigned char tweak[32];
+  unsigned char pub[33];
+  unsigned char out[64 * 33];
+  unsigned char *outs[64];
+  const unsigned char *pubs[64];
+  const unsigned char *tweaks[64];
+  size_t pub_lens[64];
+  bench_t tv;
+  size_t i;
+
+  drbg_generate(rng, entropy1, sizeof(entropy1));
+  drbg_generate(rng, entropy2, sizeof(entropy2));
+
+  ecdsa_privkey_generate(ec, priv, entropy1);
+  ecdsa_privkey_generate(ec, tweak, entropy2);
+
+  ASSERT(ecdsa_pubkey_create(ec, pub, NULL, priv, 1));
+
+  for (i = 0; i < 64; i++) {
+    outs[i] = &out[i * 33];
+    pubs[i] = pub;
+    tweaks[i] = tweak;
+    pub_lens[i] = 33;
+  }
+
+  bench_start(&tv, "ecdsa_pubkey_tweak_add_batch");
+
+  for (i = 0; i < 10000; i += 64) {
+    ASSERT(ecdsa_pubkey_tweak_add_batch(ec, outs, NULL, pubs, pub_lens,
+                                        tweaks, NULL, 64, 1));
+  }
+
+  bench_end(&tv, i);
+
+  wei_curve_destroy(ec);
+}
+
 static void
 bench_ecdsa_sign(drbg_t *rng) {
   wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
@@ -165,6 +211,43 @@ bench_ecdsa_sign(drbg_t *rng) {
   wei_curve_destroy(ec);
 }
 
+static void
+bench_ecdsa_sign_presigned(drbg_t *rng) {
+  wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
+  unsigned char entropy[ENTROPY_SIZE];
+  unsigned char priv[32];
+  unsigned char msg[32];
+  unsigned char sig[64];
+  ecdsa_presign_t *pool;
+  bench_t tv;
+  size_t i;
+
+  drbg_generate(rng, entropy, sizeof(entropy));
+  drbg_generate(rng, msg, sizeof(msg));
+
+  ecdsa_privkey_generate(ec, priv, entropy);
+
+  drbg_generate(rng, entropy, sizeof(entropy));
+
+  pool = ecdsa_presign_create(ec, 10000, entropy);
+
+  bench_start(&tv, "ecdsa_presign_fill");
+
+  ASSERT(ecdsa_presign_fill(ec, pool, 10000) == 10000);
+
+  bench_end(&tv, 10000);
+
+  bench_start(&tv, "ecdsa_sign_presigned");
+
+  for (i = 0; i < 10000; i++)
+    ASSERT(ecdsa_sign_presigned(ec, sig, NULL, msg, 32, priv, pool));
+
+  bench_end(&tv, i);
+
+  ecdsa_presign_destroy(ec, pool);
+  wei_curve_destroy(ec);
+}
+
 static void
 bench_ecdsa_verify(drbg_t *rng) {
   wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
@@ -194,6 +277,153 @@ bench_ecdsa_verify(drbg_t *rng) {
   wei_curve_destroy(ec);
 }
 
+static void
+bench_ecdsa_recover(drbg_t *rng) {
+  wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
+  unsigned char entropy[ENTROPY_SIZE];
+  unsigned char priv[32];
+  unsigned char msg[32];
+  unsigned char sig[64];
+  unsigned char pub[33];
+  unsigned int param;
+  bench_t tv;
+  size_t i;
+
+  drbg_generate(rng, entropy, sizeof(entropy));
+  drbg_generate(rng, msg, sizeof(msg));
+
+  ecdsa_privkey_generate(ec, priv, entropy);
+
+  ASSERT(ecdsa_sign(ec, sig, &param, msg, 32, priv));
+
+  bench_start(&tv, "ecdsa_recover");
+
+  for (i = 0; i < 10000; i++)
+    ASSERT(ecdsa_recover(ec, pub, NULL, msg, 32, sig, param, 1));
+
+  bench_end(&tv, i);
+
+  wei_curve_destroy(ec);
+}
+
+static void
+bench_ecdsa_recover_batch(drbg_t *rng) {
+  wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
+  unsigned char entropy[ENTROPY_SIZE];
+  unsigned char priv[32];
+  unsigned char msg[32];
+  unsigned char sig[64];
+  unsigned char pub[64 * 33];
+  unsigned char *pubs[64];
+  const unsigned char *msgs[64];
+  const unsigned char *sigs[64];
+  size_t msg_lens[64];
+  unsigned int params[64];
+  unsigned int param;
+  bench_t tv;
+  size_t i;
+
+  drbg_generate(rng, entropy, sizeof(entropy));
+  drbg_generate(rng, msg, sizeof(msg));
+
+  ecdsa_privkey_generate(ec, priv, entropy);
+
+  ASSERT(ecdsa_sign(ec, sig, &param, msg, 32, priv));
+
+  for (i = 0; i < 64; i++) {
+    pubs[i] = &pub[i * 33];
+    msgs[i] = msg;
+    sigs[i] = sig;
+    msg_lens[i] = 32;
+    params[i] = param;
+  }
+
+  bench_start(&tv, "ecdsa_recover_batch");
+
+  for (i = 0; i < 10000; i += 64) {
+    ASSERT(ecdsa_recover_batch(ec, pubs, NULL, msgs, msg_lens,
+                               sigs, params, NULL, 64, 1));
+  }
+
+  bench_end(&tv, i);
+
+  wei_curve_destroy(ec);
+}
+
+static void
+bench_bip340_tweak_check(drbg_t *rng) {
+  wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
+  unsigned char priv[32];
+  unsigned char tweak[32];
+  unsigned char pub[32];
+  unsigned char out[32];
+  bench_t tv;
+  int negated;
+  size_t i;
+
+  drbg_generate(rng, priv, sizeof(priv));
+  drbg_generate(rng, tweak, sizeof(tweak));
+
+  priv[0] = 0;
+  tweak[0] = 0;
+
+  ASSERT(bip340_pubkey_create(ec, pub, priv));
+  ASSERT(bip340_pubkey_tweak_add(ec, out, &negated, pub, tweak));
+
+  bench_start(&tv, "bip340_tweak_check");
+
+  for (i = 0; i < 10000; i++)
+    ASSERT(bip340_pubkey_tweak_add_check(ec, pub, tweak, out, negated));
+
+  bench_end(&tv, i);
+
+  wei_curve_destroy(ec);
+}
+
+static void
+bench_bip340_tweak_check_batch(drbg_t *rng) {
+  wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
+  wei_scratch_t *scratch = wei_scratch_create(ec, 64);
+  unsigned char priv[32];
+  unsigned char tweak[32];
+  unsigned char pub[32];
+  unsigned char out[32];
+  const unsigned char *pubs[64];
+  const unsigned char *tweaks[64];
+  const unsigned char *outs[64];
+  int negated[64];
+  bench_t tv;
+  size_t i;
+
+  drbg_generate(rng, priv, sizeof(priv));
+  drbg_generate(rng, tweak, sizeof(tweak));
+
+  priv[0] = 0;
+  tweak[0] = 0;
+
+  ASSERT(bip340_pubkey_create(ec, pub, priv));
+  ASSERT(bip340_pubkey_tweak_add(ec, out, &negated[0], pub, tweak));
+
+  for (i = 0; i < 64; i++) {
+    pubs[i] = pub;
+    tweaks[i] = tweak;
+    outs[i] = out;
+    negated[i] = negated[0];
+  }
+
+  bench_start(&tv, "bip340_tweak_check_batch");
+
+  for (i = 0; i < 10000; i += 64) {
+    ASSERT(bip340_pubkey_tweak_check_batch(ec, pubs, tweaks, outs,
+                                           negated, 64, scratch));
+  }
+
+  bench_end(&tv, i);
+
+  wei_scratch_destroy(ec, scratch);
+  wei_curve_destroy(ec);
+}
+
 static void
 bench_ecdsa_derive(drbg_t *rng) {
   wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
@@ -225,6 +455,29 @@ bench_ecdsa_derive(drbg_t *rng) {
   wei_curve_destroy(ec);
 }
 
+static void
+bench_ecdh_pubkey_create(drbg_t *rng) {
+  mont_curve_t *ec = mont_curve_create(MONT_CURVE_X25519);
+  unsigned char entropy[ENTROPY_SIZE];
+  unsigned char priv[32];
+  unsigned char pub[32];
+  bench_t tv;
+  size_t i;
+
+  drbg_generate(rng, entropy, sizeof(entropy));
+
+  ecdh_privkey_generate(ec, priv, entropy);
+
+  bench_start(&tv, "ecdh_pubkey_create");
+
+  for (i = 0; i < 10000; i++)
+    ecdh_pubkey_create(ec, pub, priv);
+
+  bench_end(&tv, i);
+
+  mont_curve_destroy(ec);
+}
+
 static void
 bench_ecdh_derive(drbg_t *rng) {
   mont_curve_t *ec = mont_curve_create(MONT_CURVE_X25519);
@@ -250,6 +503,40 @@ bench_ecdh_derive(drbg_t *rng) {
   mont_curve_destroy(ec);
 }
 
+static void
+bench_ecdh_derive_batch(drbg_t *rng) {
+  mont_curve_t *ec = mont_curve_create(MONT_CURVE_X25519);
+  unsigned char entropy[ENTROPY_SIZE];
+  unsigned char privs[16][32];
+  unsigned char pubs[16][32];
+  unsigned char secrets[16][32];
+  const unsigned char *priv_ptrs[16];
+  const unsigned char *pub_ptrs[16];
+  unsigned char *secret_ptrs[16];
+  bench_t tv;
+  size_t i;
+
+  for (i = 0; i < 16; i++) {
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ecdh_privkey_generate(ec, privs[i], entropy);
+    ecdh_pubkey_create(ec, pubs[i], privs[i]);
+
+    priv_ptrs[i] = privs[i];
+    pub_ptrs[i] = pubs[i];
+    secret_ptrs[i] = secrets[i];
+  }
+
+  bench_start(&tv, "ecdh_derive_batch");
+
+  for (i = 0; i < 10000; i += 16)
+    ASSERT(ecdh_derive_batch(ec, secret_ptrs, pub_ptrs, priv_ptrs, 16));
+
+  bench_end(&tv, i);
+
+  mont_curve_destroy(ec);
+}
+
 static void
 bench_eddsa_sign(drbg_t *rng) {
   edwards_curve_t *ec = edwards_curve_create(EDWARDS_CURVE_ED25519);
@@ -346,6 +633,67 @@ bench_mpi_internal(drbg_t *rng) {
   torsion__bench_mpi_internal(bench_start, bench_end, drbg_rng, rng);
 }
 
+static void
+bench_dsa_sign(drbg_t *rng) {
+  static unsigned char params[DSA_MAX_PARAMS_SIZE];
+  static unsigned char priv[DSA_MAX_PRIV_SIZE];
+  unsigned char out[DSA_MAX_SIG_SIZE];
+  unsigned char entropy[ENTROPY_SIZE];
+  unsigned char msg[32];
+  size_t params_len, priv_len, len;
+  bench_t tv;
+  int i;
+
+  drbg_generate(rng, entropy, sizeof(entropy));
+  drbg_generate(rng, msg, sizeof(msg));
+
+  ASSERT(dsa_params_generate(params, &params_len, 2048, entropy));
+  ASSERT(dsa_privkey_create(priv, &priv_len, params, params_len, entropy));
+
+  bench_start(&tv, "dsa_sign");
+
+  for (i = 0; i < 1000; i++) {
+    ASSERT(dsa_sign(out, &len, msg, sizeof(msg),
+                    priv, priv_len, entropy));
+  }
+
+  bench_end(&tv, i);
+}
+
+static void
+bench_dsa_sign_domain(drbg_t *rng) {
+  static unsigned char params[DSA_MAX_PARAMS_SIZE];
+  static unsigned char priv[DSA_MAX_PRIV_SIZE];
+  unsigned char out[DSA_MAX_SIG_SIZE];
+  unsigned char entropy[ENTROPY_SIZE];
+  unsigned char msg[32];
+  size_t params_len, priv_len, len;
+  dsa_domain_t *domain;
+  bench_t tv;
+  int i;
+
+  drbg_generate(rng, entropy, sizeof(entropy));
+  drbg_generate(rng, msg, sizeof(msg));
+
+  ASSERT(dsa_params_generate(params, &params_len, 2048, entropy));
+
+  domain = dsa_domain_create(params, params_len);
+
+  ASSERT(domain != NULL);
+  ASSERT(dsa_domain_privkey_create(priv, &priv_len, domain, entropy));
+
+  bench_start(&tv, "dsa_sign_domain");
+
+  for (i = 0; i < 1000; i++) {
+    ASSERT(dsa_domain_sign(out, &len, msg, sizeof(msg),
+                           priv, priv_len, domain, entropy));
+  }
+
+  bench_end(&tv, i);
+
+  dsa_domain_destroy(domain);
+}
+
 static void
 bench_rsa_generate(drbg_t *rng) {
   static const unsigned char entropy[ENTROPY_SIZE] = {0};
@@ -521,6 +869,38 @@ bench_rsa_sign(drbg_t *rng) {
   bench_end(&tv, i);
 }
 
+static void
+bench_rsa_sign_key(drbg_t *rng) {
+  static unsigned char priv[RSA_MAX_PRIV_SIZE];
+  static unsigned char out[RSA_MAX_MOD_SIZE];
+  unsigned char entropy[ENTROPY_SIZE];
+  unsigned char msg[32];
+  size_t priv_len, len;
+  rsa_key_t *key;
+  bench_t tv;
+  int i;
+
+  drbg_generate(rng, entropy, sizeof(entropy));
+  drbg_generate(rng, msg, sizeof(msg));
+
+  ASSERT(rsa_privkey_generate(priv, &priv_len, 2048, 65537, entropy));
+
+  key = rsa_key_create_private(priv, priv_len);
+
+  ASSERT(key != NULL);
+
+  bench_start(&tv, "rsa_sign_key");
+
+  for (i = 0; i < 1000; i++) {
+    ASSERT(rsa_key_sign(out, &len, HASH_SHA256, msg, sizeof(msg),
+                        key, entropy));
+  }
+
+  bench_end(&tv, i);
+
+  rsa_key_destroy(key);
+}
+
 static void
 bench_rsa_verify(drbg_t *rng) {
   static const unsigned char pub[] = {
@@ -656,6 +1036,27 @@ bench_sha3(drbg_t *rng) {
   bench_end(&tv, i);
 }
 
+static void
+bench_pbkdf2(drbg_t *rng) {
+  unsigned char pass[32];
+  unsigned char salt[16];
+  unsigned char out[64];
+  bench_t tv;
+  size_t i;
+
+  drbg_generate(rng, pass, sizeof(pass));
+  drbg_generate(rng, salt, sizeof(salt));
+
+  bench_start(&tv, "pbkdf2");
+
+  for (i = 0; i < 1000; i++) {
+    ASSERT(pbkdf2_derive(out, HASH_SHA512, pass, sizeof(pass),
+                         salt, sizeof(salt), 2048, sizeof(out)));
+  }
+
+  bench_end(&tv, i);
+}
+
 static void
 bench_aes_ctr(drbg_t *rng) {
   unsigned char raw[977];
@@ -731,6 +1132,66 @@ bench_chacha20(drbg_t *rng) {
   bench_end(&tv, i);
 }
 
+static void
+bench_chachapoly(drbg_t *rng) {
+  unsigned char raw[64][128];
+  unsigned char key[32];
+  unsigned char iv[12];
+  unsigned char tag[16];
+  chachapoly_t ctx;
+  bench_t tv;
+  size_t i, j;
+
+  drbg_generate(rng, raw, sizeof(raw));
+  drbg_generate(rng, key, sizeof(key));
+  drbg_generate(rng, iv, sizeof(iv));
+
+  bench_start(&tv, "chachapoly");
+
+  for (i = 0; i < 10000; i++) {
+    for (j = 0; j < 64; j++) {
+      chachapoly_init(&ctx, key, iv, sizeof(iv));
+      chachapoly_encrypt(&ctx, raw[j], raw[j], sizeof(raw[j]));
+      chachapoly_final(&ctx, tag);
+    }
+  }
+
+  bench_end(&tv, i * j);
+}
+
+static void
+bench_chachapoly_batch(drbg_t *rng) {
+  unsigned char raw[64][128];
+  unsigned char tags[64][16];
+  unsigned char key[32];
+  unsigned char iv[12];
+  chachapoly_msg_t msgs[64];
+  bench_t tv;
+  size_t i;
+
+  drbg_generate(rng, raw, sizeof(raw));
+  drbg_generate(rng, key, sizeof(key));
+  drbg_generate(rng, iv, sizeof(iv));
+
+  for (i = 0; i < 64; i++) {
+    msgs[i].key = key;
+    msgs[i].iv = iv;
+    msgs[i].iv_len = sizeof(iv);
+    msgs[i].aad = NULL;
+    msgs[i].aad_len = 0;
+    msgs[i].data = raw[i];
+    msgs[i].len = sizeof(raw[i]);
+    msgs[i].tag = tags[i];
+  }
+
+  bench_start(&tv, "chachapoly_batch");
+
+  for (i = 0; i < 10000; i++)
+    chachapoly_seal_batch(msgs, 64);
+
+  bench_end(&tv, i * 64);
+}
+
 /*
  * Benchmark Registry
  */
@@ -740,25 +1201,39 @@ static const struct {
   void (*run)(drbg_t *);
 } torsion_benches[] = {
 #define B(name) { #name, bench_ ## name }
+  B(dsa_sign),
+  B(dsa_sign_domain),
   B(ecdsa_pubkey_create),
   B(ecdsa_pubkey_tweak_add),
+  B(ecdsa_pubkey_tweak_add_batch),
   B(ecdsa_sign),
+  B(ecdsa_sign_presigned),
   B(ecdsa_verify),
+  B(ecdsa_recover),
+  B(ecdsa_recover_batch),
   B(ecdsa_derive),
+  B(bip340_tweak_check),
+  B(bip340_tweak_check_batch),
+  B(ecdh_pubkey_create),
   B(ecdh_derive),
+  B(ecdh_derive_batch),
   B(eddsa_sign),
   B(eddsa_verify),
   B(eddsa_derive),
   B(mpi_internal),
   B(rsa_generate),
   B(rsa_sign),
+  B(rsa_sign_key),
   B(rsa_verify),
   B(hash),
   B(sha256),
   B(sha3),
+  B(pbkdf2),
   B(aes_ctr),
   B(aes_gcm),
-  B(chacha20)
+  B(chacha20),
+  B(chachapoly),
+  B(chachapoly_batch)
 #undef B
 };
 
@@ -88,6 +88,22 @@ static const pbkdf2_vector_t pbkdf2_vectors[] = {
     1,
     "47"
   },
+  {
+    HASH_SHA224,
+    "8c135899d89b491682ed58646a04f9081ad871a639cd5915ff7f54ea9b8a6bd6ba3372fa2b",
+    "386fc868accaaf9086328bac6c4c4783",
+    1331,
+    71,
+    "d28b8d71b7cc82cbb59c5d28e573e2b601fcc531586294d9002a166646e43936d42023b739ae04bc4056eaf0276c5b7a73d90365e6519cfdbbb225374945ffea0c0e5445b08473"
+  },
+  {
+    HASH_SHA224,
+    "c038d169f5c9788424c04ec14c96b5a57865d29ed9c6e519bbf0e35edb234326b057cd118d65296aa0a76d7748ef9ea82752bedfd8b2f9f7a2bbbbf7ac34ab4703f8c10566ec6ae98c226f264aea02f5dfde0cb90ac2a54e1e01",
+    "f0a084e10ef209",
+    902,
+    28,
+    "ad8f9855ed41e6190e3f6d877a71c949a6b8bc14ed0ac81d9ed3ba0b"
+  },
   {
     HASH_SHA256,
     "3aa6edd68f51c102e8414b143d2e37fb60258fb0199f8ff172c44929577fe2434e3ff0f989db6a8344ee0c9db0a21ffc3a333d8dd07da03fa0ee5d37cfc35859050c2d00a5f4938755d0446cd89e",
@@ -168,6 +184,22 @@ static const pbkdf2_vector_t pbkdf2_vectors[] = {
     55,
     "2edc2c010a0fc29a76b056cf12e8ea1cbfada628992f26ba0efb1caf1f7a6a5747f6f312f9e527fa4194ad455421bacf13a4844ddb3f6a"
   },
+  {
+    HASH_SHA384,
+    "83c302262cb7725e3b1007bb31417f0520311cbd2ad808a5c860dd393334a2dee0883ef1553ae1d3c3009f1dcbb49240503baf6ac8f80ee452694b93e2294968ac1d6f0d60697fc9e506a8536323262b589e7867a583ff165332f079e90b71d438963bd0eb722cdea583a7562a2d08f3a3740da18cebf8b976b14f0d1bed4d3b51381d30b3da9a2ab7331bcc4051ec5c02265e30d1d2",
+    "3a6e38efa340408a565164764c35a81dbc29c296fa9012a7",
+    1519,
+    101,
+    "0f49963daa615518c20e3fed7994d609864570f7c1f58c209c169ae622f44b51eff574beff4489fd41b01b5d148a1cb0461199f2931a9aa53df0242e6b0a269cc8df5b48b61faa7aee52f1e3b82df78f0ee965f133f80d2c31cdd33f6d839b1428bcb183d5"
+  },
+  {
+    HASH_SHA384,
+    "4112fccfcc1ac2e33834200a",
+    "",
+    774,
+    48,
+    "6794d70498934fcbcd6be1c9ab1563b0bb4964654175b09437c9ce8d7515e50fe1ff8cd30bd4f0ef79f9c9a6e312f844"
+  },
   {
     HASH_SHA512,
     "e16686a5b0fc4fe90ee2d6e435f806a41a37c5ae917ebb2aba0672e9f644d060c945df81bcd5852d9ff5fb388c2a85d824e6edd23496930fb57afbf37e7ffd0cbc109595039300c5916d00b784040de8dd708a599da0d74626458abeb0a783bb326e4adeb5ef25e06e2a82b1dc2b9dce8ee29901e5a0315700a5a4f6d2ce6f74229d99a7aa57504be0a889dad2ceead050d2b20759d2678d2f4796709d031dc9b1e1064e4ebd3b306a908e5383877a50e2f148def9b8472eba50a261524d06b26b7fdb897d0c69f14b81962a96bf35fbc9abc780b8f127a7bc2e796226c123a819023aa08aff8ab45ef3c3fc0207cfe9a1240f0f",
@@ -248,6 +280,14 @@ static const pbkdf2_vector_t pbkdf2_vectors[] = {
     30,
     "4033a59df9c287b34751201156c5881e178151bc31cdf3d36720366b9d0d"
   },
+  {
+    HASH_SHA512,
+    "6162616e646f6e206162616e646f6e206162616e646f6e206162616e646f6e206162616e646f6e206162616e646f6e206162616e646f6e206162616e646f6e206162616e646f6e206162616e646f6e206162616e646f6e2061626f7574",
+    "6d6e656d6f6e69635452455a4f52",
+    2048,
+    64,
+    "c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e53495531f09a6987599d18264c1e1c92f2cf141630c7a3c4ab7c81b2f001698e7463b04"
+  },
   {
     HASH_SHA3_256,
     "bb836494373faf0ad51400437faa45edb27b0ffe2045de14819c6b49b7652d5e650d88c5c7ccbe75c9767dfc0384ffaca2383f5ef874eb9b2b557735fe621a6c42e8277eaf576820345f093588e7ce41c24b7c9f61c75da9ee240205394f2eb3728cee30e8209b90482b964ed79dd5254b3f2ebfb0cc",
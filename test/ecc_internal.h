@@ -734,6 +734,205 @@ test_field_element(drbg_t *unused) {
   ASSERT(!fe_import(fe, t, raw));
 }
 
+static void
+test_field_p256_adx(drbg_t *rng) {
+#if defined(P256_HAVE_ADX)
+  prime_field_t field;
+  prime_field_t *fe = &field;
+  fe_t x, y, z1, z2;
+  int i;
+
+  printf("  - P256 MULX/ADX kernel sanity check.\n");
+
+  if (!torsion_has_adx())
+    return;
+
+  prime_field_init(fe, &field_p256, 1);
+
+  for (i = 0; i < 10000; i++) {
+    fe_random(fe, x, rng);
+    fe_random(fe, y, rng);
+
+    /* Edge cases: 0, 1, p - 1. */
+    if (i == 0)
+      fe_zero(fe, x);
+
+    if (i == 1)
+      fe_set(fe, x, fe->one);
+
+    if (i == 2 || i == 3)
+      fe_set(fe, x, fe->mone);
+
+    if (i == 3)
+      fe_set(fe, y, fe->mone);
+
+    fiat_p256_mul(z1, x, y);
+    p256_fe_mul_adx(z2, x, y);
+
+    ASSERT(p256_fe_equal(z1, z2));
+
+    fiat_p256_square(z1, x);
+    p256_fe_sqr_adx(z2, x);
+
+    ASSERT(p256_fe_equal(z1, z2));
+
+    fiat_p256_mul(z1, x, y);
+    p256_fe_mul_adx(x, x, y);
+
+    ASSERT(p256_fe_equal(x, z1));
+  }
+#else
+  (void)rng;
+#endif
+}
+
+static void
+test_field_secp256k1_52(drbg_t *rng) {
+#if defined(SECP256K1_HAVE_52)
+  /* p - 1, little endian. */
+  static const unsigned char pm1[32] = {
+    0x2e, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  };
+  unsigned char xr[32], yr[32], u[32], v[32];
+  secp256k1_fe_t x1, y1, z1, w1;
+  secp256k1_52_fe_t x2, y2, z2, w2;
+  int i, r1, r2;
+
+  printf("  - SECP256K1 5x52 kernel sanity check.\n");
+
+  if (!torsion_has_adx())
+    return;
+
+  for (i = 0; i < 10000; i++) {
+    drbg_generate(rng, xr, sizeof(xr));
+    drbg_generate(rng, yr, sizeof(yr));
+
+    xr[31] &= 0x7f;
+    yr[31] &= 0x7f;
+
+    /* Edge cases: 0, 1, p - 1. */
+    if (i == 0 || i == 1) {
+      memset(xr, 0, sizeof(xr));
+      xr[0] = i;
+    }
+
+    if (i == 2 || i == 3)
+      memcpy(xr, pm1, sizeof(pm1));
+
+    if (i == 3)
+      memcpy(yr, pm1, sizeof(pm1));
+
+    fiat_secp256k1_from_bytes(x1, xr);
+    fiat_secp256k1_from_bytes(y1, yr);
+
+    secp256k1_52_from_bytes(x2, xr);
+    secp256k1_52_from_bytes(y2, yr);
+
+    fiat_secp256k1_to_bytes(u, x1);
+    secp256k1_52_to_bytes(v, x2);
+
+    ASSERT(memcmp(u, v, 32) == 0);
+
+    /* Uncarried inputs. */
+    switch (i & 3) {
+      case 1:
+        fiat_secp256k1_add(w1, x1, y1);
+        secp256k1_52_add(w2, x2, y2);
+        break;
+      case 2:
+        fiat_secp256k1_sub(w1, x1, y1);
+        secp256k1_52_sub(w2, x2, y2);
+        break;
+      case 3:
+        fiat_secp256k1_opp(w1, y1);
+        secp256k1_52_opp(w2, y2);
+        break;
+      default:
+        secp256k1_fe_set(w1, x1);
+        secp256k1_52_fe_set(w2, x2);
+        break;
+    }
+
+    fiat_secp256k1_carry(z1, w1);
+    secp256k1_52_carry(z2, w2);
+    fiat_secp256k1_to_bytes(u, z1);
+    secp256k1_52_to_bytes(v, z2);
+
+    ASSERT(memcmp(u, v, 32) == 0);
+
+    fiat_secp256k1_carry_mul(z1, w1, y1);
+    secp256k1_52_carry_mul(z2, w2, y2);
+    fiat_secp256k1_to_bytes(u, z1);
+    secp256k1_52_to_bytes(v, z2);
+
+    ASSERT(memcmp(u, v, 32) == 0);
+
+    fiat_secp256k1_carry_square(z1, w1);
+    secp256k1_52_carry_square(z2, w2);
+    fiat_secp256k1_to_bytes(u, z1);
+    secp256k1_52_to_bytes(v, z2);
+
+    ASSERT(memcmp(u, v, 32) == 0);
+
+    fiat_secp256k1_carry_scmul_3(z1, w1);
+    secp256k1_52_carry_scmul_3(z2, w2);
+    fiat_secp256k1_to_bytes(u, z1);
+    secp256k1_52_to_bytes(v, z2);
+
+    ASSERT(memcmp(u, v, 32) == 0);
+
+    fiat_secp256k1_carry_scmul_8(z1, w1);
+    secp256k1_52_carry_scmul_8(z2, w2);
+    fiat_secp256k1_to_bytes(u, z1);
+    secp256k1_52_to_bytes(v, z2);
+
+    ASSERT(memcmp(u, v, 32) == 0);
+
+    /* Aliased output. */
+    fiat_secp256k1_carry_mul(w1, w1, y1);
+    secp256k1_52_carry_mul(w2, w2, y2);
+    fiat_secp256k1_to_bytes(u, w1);
+    secp256k1_52_to_bytes(v, w2);
+
+    ASSERT(memcmp(u, v, 32) == 0);
+
+    if (i < 100) {
+      secp256k1_fe_invert(z1, x1);
+      secp256k1_52_fe_invert(z2, x2);
+      fiat_secp256k1_to_bytes(u, z1);
+      secp256k1_52_to_bytes(v, z2);
+
+      ASSERT(memcmp(u, v, 32) == 0);
+
+      r1 = secp256k1_fe_sqrt(z1, x1);
+      r2 = secp256k1_52_fe_sqrt(z2, x2);
+
+      ASSERT(r1 == r2);
+
+      fiat_secp256k1_to_bytes(u, z1);
+      secp256k1_52_to_bytes(v, z2);
+
+      ASSERT(memcmp(u, v, 32) == 0);
+
+      r1 = secp256k1_fe_isqrt(z1, x1, y1);
+      r2 = secp256k1_52_fe_isqrt(z2, x2, y2);
+
+      ASSERT(r1 == r2);
+
+      fiat_secp256k1_to_bytes(u, z1);
+      secp256k1_52_to_bytes(v, z2);
+
+      ASSERT(memcmp(u, v, 32) == 0);
+    }
+  }
+#else
+  (void)rng;
+#endif
+}
+
 /*
  * Utils
  */
@@ -3220,6 +3419,85 @@ test_edwards_multi_mul_ed25519(drbg_t *unused) {
                                                 scalar3, expect);
 }
 
+static void
+test_edwards_avx2_ed25519(drbg_t *rng) {
+#if defined(P25519_HAVE_AVX2) && defined(TORSION_SPECIALIZE)
+  unsigned char entropy[ENTROPY_SIZE];
+  edwards_t *ec = edwards_curve_create(EDWARDS_CURVE_ED25519);
+  edwards_scratch_t *scratch = edwards_scratch_create(ec, 5);
+  const edwards_group_t *group = ec->group;
+  scalar_field_t *sc = &ec->sc;
+  xge_t points[5];
+  sc_t coeffs[5];
+  xge_t q, r;
+  size_t j;
+  sc_t k;
+  int i;
+
+  printf("  - AVX2 edwards multiplication sanity check (ED25519).\n");
+
+  if (group == NULL || group->mul_g == NULL) {
+    edwards_scratch_destroy(ec, scratch);
+    edwards_curve_destroy(ec);
+    return;
+  }
+
+  drbg_generate(rng, entropy, sizeof(entropy));
+  edwards_randomize(ec, entropy);
+
+  for (i = 0; i < 24; i++) {
+    size_t len = i % 6;
+
+    sc_random(sc, k, rng);
+
+    for (j = 0; j < 5; j++) {
+      sc_random(sc, coeffs[j], rng);
+      edwards_mul_g(ec, &points[j], coeffs[j]);
+      xge_randomize(ec, &points[j], &points[j], rng);
+      sc_random(sc, coeffs[j], rng);
+    }
+
+    /* Edge cases: zero scalars and the identity. */
+    if (i == 0)
+      sc_zero(sc, k);
+
+    if (i == 1)
+      sc_zero(sc, coeffs[0]);
+
+    if (i == 2)
+      xge_zero(ec, &points[0]);
+
+    edwards_mul_g(ec, &q, k);
+    ec->group = NULL;
+    edwards_mul_g(ec, &r, k);
+    ec->group = group;
+
+    ASSERT(xge_equal(ec, &q, &r));
+
+    edwards_mul_double_var(ec, &q, k, &points[0], coeffs[0]);
+    ec->group = NULL;
+    edwards_mul_double_var(ec, &r, k, &points[0], coeffs[0]);
+    ec->group = group;
+
+    ASSERT(xge_equal(ec, &q, &r));
+
+    edwards_mul_multi_var(ec, &q, k, points,
+                          (const sc_t *)coeffs, len, scratch);
+    ec->group = NULL;
+    edwards_mul_multi_var(ec, &r, k, points,
+                          (const sc_t *)coeffs, len, scratch);
+    ec->group = group;
+
+    ASSERT(xge_equal(ec, &q, &r));
+  }
+
+  edwards_scratch_destroy(ec, scratch);
+  edwards_curve_destroy(ec);
+#else
+  (void)rng;
+#endif
+}
+
 static void
 test_edwards_points_ed448(drbg_t *rng) {
   static const unsigned char points[3][MAX_FIELD_SIZE + 1] = {
@@ -3934,6 +4212,8 @@ test_ecc_internal(drbg_t *rng) {
 
   /* Field Element */
   test_field_element(rng);
+  test_field_p256_adx(rng);
+  test_field_secp256k1_52(rng);
 
   /* Utils */
   test_bytes_lt(rng);
@@ -3967,6 +4247,7 @@ test_ecc_internal(drbg_t *rng) {
   test_edwards_mul_ed25519(rng);
   test_edwards_double_mul_ed25519(rng);
   test_edwards_multi_mul_ed25519(rng);
+  test_edwards_avx2_ed25519(rng);
   test_edwards_points_ed448(rng);
   test_edwards_mul_g_ed448(rng);
   test_edwards_mul_ed448(rng);
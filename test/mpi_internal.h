@@ -2286,6 +2286,120 @@ test_mpn_sqr(mp_rng_f *rng, void *arg) {
   }
 }
 
+static void
+test_mpn_mul_large(mp_rng_f *rng, void *arg) {
+  /* Exercise the Karatsuba and Toom-3 paths against the
+     basecase, including the all-ones operands which
+     maximize the carries during interpolation. */
+  static const mp_size_t sizes[] = {
+    MP_MUL_KARATSUBA_THRESHOLD,
+    MP_MUL_KARATSUBA_THRESHOLD + 1,
+    MP_SQR_KARATSUBA_THRESHOLD + 3,
+    MP_MUL_TOOM3_THRESHOLD - 1,
+    MP_MUL_TOOM3_THRESHOLD,
+    MP_MUL_TOOM3_THRESHOLD + 1,
+    MP_MUL_TOOM3_THRESHOLD + 2,
+    MP_SQR_TOOM3_THRESHOLD + 5,
+    3 * MP_MUL_TOOM3_THRESHOLD + 7,
+    256
+  };
+
+  mp_size_t n = MP_MAX(3 * MP_MUL_TOOM3_THRESHOLD + 7, 256);
+  mp_limb_t *xp = mp_alloc_limbs(n * 2);
+  mp_limb_t *yp = mp_alloc_limbs(n);
+  mp_limb_t *zp = mp_alloc_limbs(n * 4);
+  mp_limb_t *ep = mp_alloc_limbs(n * 4);
+  mp_limb_t *tp = mp_alloc_limbs(n * 4);
+  mp_size_t i, j, xn, yn;
+
+  printf("  - MPN mul (subquadratic).\n");
+
+  for (i = 0; i < (mp_size_t)ARRAY_SIZE(sizes); i++) {
+    yn = sizes[i];
+
+    ASSERT(yn <= n);
+
+    for (j = 0; j < 8; j++) {
+      xn = yn + (j >= 6 ? mp_random_limb(rng, arg) % (n + 1) : 0);
+
+      if (j == 0) {
+        mpn_zero(xp, xn);
+        mpn_zero(yp, yn);
+        mpn_sub_1(xp, xp, xn, 1);
+        mpn_sub_1(yp, yp, yn, 1);
+      } else {
+        mpn_random(xp, xn, rng, arg);
+        mpn_random(yp, yn, rng, arg);
+      }
+
+      mpn_mul(zp, xp, xn, yp, yn);
+      mpn_mul_basecase(ep, xp, xn, yp, yn);
+
+      ASSERT(mpn_cmp(zp, ep, xn + yn) == 0);
+
+      mpn_mul(zp, yp, yn, xp, xn);
+
+      ASSERT(mpn_cmp(zp, ep, xn + yn) == 0);
+
+      mpn_sqr(zp, xp, xn, tp);
+      mpn_sqr_basecase(ep, xp, xn, tp);
+
+      ASSERT(mpn_cmp(zp, ep, xn * 2) == 0);
+    }
+  }
+
+  mp_free_limbs(xp);
+  mp_free_limbs(yp);
+  mp_free_limbs(zp);
+  mp_free_limbs(ep);
+  mp_free_limbs(tp);
+}
+
+#if defined(MP_HAVE_ADX)
+static void
+test_mpn_addmul_1_adx(mp_rng_f *rng, void *arg) {
+  mp_limb_t xp[40], zp[40], ep[40];
+  mp_limb_t y, c, e;
+  mp_size_t i, j, xn;
+
+  if (!torsion_has_adx())
+    return;
+
+  printf("  - MPN addmul (adx).\n");
+
+  for (i = 0; i < 200; i++) {
+    xn = mp_random_limb(rng, arg) % 41;
+
+    if (i < 41) {
+      /* Maximize both carry chains. */
+      xn = i;
+      y = MP_LIMB_MAX;
+
+      mpn_zero(xp, xn);
+      mpn_sub_1(xp, xp, xn, 1);
+      mpn_copyi(zp, xp, xn);
+    } else {
+      y = mp_random_limb(rng, arg);
+
+      mpn_random(xp, xn, rng, arg);
+      mpn_random(zp, xn, rng, arg);
+    }
+
+    mpn_copyi(ep, zp, xn);
+
+    e = 0;
+
+    for (j = 0; j < xn; j++)
+      mp_addmul_1(ep[j], e, xp[j], y);
+
+    c = mpn_addmul_1_adx(zp, xp, xn, y);
+
+    ASSERT(c == e);
+    ASSERT(mpn_cmp(zp, ep, xn) == 0);
+  }
+}
+#endif
+
 static void
 test_mpn_mod(mp_rng_f *rng, void *arg) {
   mp_limb_t np[8], dp[4], qp[5], rp[4], tp[9];
@@ -7041,6 +7155,234 @@ test_mpz_powm(mp_rng_f *rng, void *arg) {
   mpz_clear(m);
 }
 
+static void
+test_mpz_mont_powm(mp_rng_f *rng, void *arg) {
+  mpz_t x, y, z, t, m;
+  mpz_mont_t mont;
+  mp_bits_t bits;
+  int i;
+
+  printf("  - MPZ powm (montgomery context).\n");
+
+  mpz_init(x);
+  mpz_init(y);
+  mpz_init(z);
+  mpz_init(t);
+  mpz_init(m);
+
+  mpz_mont_init(mont);
+
+  mpz_set_ui(m, 0);
+
+  ASSERT(!mpz_mont_set(mont, m));
+
+  mpz_set_ui(m, 10);
+
+  ASSERT(!mpz_mont_set(mont, m));
+
+  mpz_set_ui(m, 1);
+  mpz_set_ui(x, 3);
+  mpz_set_ui(y, 5);
+
+  ASSERT(mpz_mont_set(mont, m));
+
+  mpz_mont_powm(z, x, y, mont);
+
+  ASSERT(mpz_sgn(z) == 0);
+
+  for (i = 0; i < 200; i++) {
+    bits = 2 + mp_random_limb(rng, arg) % 2048;
+
+    mpz_random_nz(m, bits, rng, arg);
+    mpz_setbit(m, 0);
+
+    ASSERT(mpz_mont_set(mont, m));
+
+    mpz_random_nz(x, bits + 64, rng, arg);
+    mpz_random_nz(y, 1 + mp_random_limb(rng, arg) % 256, rng, arg);
+
+    if (i < 20)
+      mpz_set_ui(y, i);
+
+    if (mp_random_limb(rng, arg) & 1)
+      mpz_neg(x, x);
+
+    mpz_mont_powm_sec(z, x, y, mont);
+    mpz_powm_sec(t, x, y, m);
+
+    ASSERT(mpz_cmp(z, t) == 0);
+
+    if (mp_random_limb(rng, arg) & 1) {
+      if (mpz_invert(t, x, m))
+        mpz_neg(y, y);
+    }
+
+    mpz_mont_powm(z, x, y, mont);
+    mpz_powm(t, x, y, m);
+
+    ASSERT(mpz_cmp(z, t) == 0);
+
+    mpz_set(z, x);
+    mpz_mont_powm(z, z, y, mont);
+
+    ASSERT(mpz_cmp(z, t) == 0);
+  }
+
+  mpz_mont_clear(mont);
+
+  mpz_clear(x);
+  mpz_clear(y);
+  mpz_clear(z);
+  mpz_clear(t);
+  mpz_clear(m);
+}
+
+static void
+test_mpz_mont_powm2(mp_rng_f *rng, void *arg) {
+  mpz_t x, y, u, v, z, t, m;
+  mpz_mont_t mont;
+  mp_bits_t bits;
+  int i;
+
+  printf("  - MPZ powm2 (montgomery context).\n");
+
+  mpz_init(x);
+  mpz_init(y);
+  mpz_init(u);
+  mpz_init(v);
+  mpz_init(z);
+  mpz_init(t);
+  mpz_init(m);
+
+  mpz_mont_init(mont);
+
+  mpz_set_ui(m, 1);
+  mpz_set_ui(x, 3);
+  mpz_set_ui(y, 5);
+
+  ASSERT(mpz_mont_set(mont, m));
+
+  mpz_mont_powm2(z, x, y, x, y, mont);
+
+  ASSERT(mpz_sgn(z) == 0);
+
+  for (i = 0; i < 200; i++) {
+    bits = 2 + mp_random_limb(rng, arg) % 2048;
+
+    mpz_random_nz(m, bits, rng, arg);
+    mpz_setbit(m, 0);
+
+    ASSERT(mpz_mont_set(mont, m));
+
+    mpz_random_nz(x, bits + 64, rng, arg);
+    mpz_random_nz(u, bits, rng, arg);
+    mpz_random_nz(y, 1 + mp_random_limb(rng, arg) % 256, rng, arg);
+    mpz_random_nz(v, 1 + mp_random_limb(rng, arg) % 512, rng, arg);
+
+    if (i < 10)
+      mpz_set_ui(y, i);
+
+    if (i >= 5 && i < 15)
+      mpz_set_ui(v, i - 5);
+
+    if (i == 15)
+      mpz_set_ui(u, 0);
+
+    if (mp_random_limb(rng, arg) & 1)
+      mpz_neg(x, x);
+
+    mpz_powm(z, x, y, m);
+    mpz_powm(t, u, v, m);
+    mpz_mul(t, t, z);
+    mpz_mod(t, t, m);
+
+    mpz_mont_powm2(z, x, y, u, v, mont);
+
+    ASSERT(mpz_cmp(z, t) == 0);
+
+    mpz_set(z, u);
+    mpz_mont_powm2(z, x, y, z, v, mont);
+
+    ASSERT(mpz_cmp(z, t) == 0);
+  }
+
+  mpz_mont_clear(mont);
+
+  mpz_clear(x);
+  mpz_clear(y);
+  mpz_clear(u);
+  mpz_clear(v);
+  mpz_clear(z);
+  mpz_clear(t);
+  mpz_clear(m);
+}
+
+static void
+test_mpz_comb_powm(mp_rng_f *rng, void *arg) {
+  mpz_t x, y, z, t, m;
+  mpz_comb_t comb;
+  mp_bits_t bits;
+  int i, j;
+
+  printf("  - MPZ powm (fixed-base comb).\n");
+
+  mpz_init(x);
+  mpz_init(y);
+  mpz_init(z);
+  mpz_init(t);
+  mpz_init(m);
+
+  mpz_comb_init(comb);
+
+  mpz_set_ui(m, 10);
+  mpz_set_ui(x, 3);
+
+  ASSERT(!mpz_comb_set(comb, x, 64, m));
+
+  mpz_set_ui(m, 11);
+
+  ASSERT(!mpz_comb_set(comb, x, 0, m));
+
+  for (i = 0; i < 50; i++) {
+    mpz_random_nz(m, 2 + mp_random_limb(rng, arg) % 2048, rng, arg);
+    mpz_setbit(m, 0);
+
+    mpz_random_nz(x, mpz_bitlen(m) + 64, rng, arg);
+
+    if (mp_random_limb(rng, arg) & 1)
+      mpz_neg(x, x);
+
+    bits = 1 + mp_random_limb(rng, arg) % 512;
+
+    ASSERT(mpz_comb_set(comb, x, bits, m));
+
+    for (j = 0; j < 4; j++) {
+      mpz_urandomb(y, bits, rng, arg);
+
+      if (j == 0)
+        mpz_set_ui(y, i & 1);
+
+      if (j == 1) {
+        mpz_set_ui(y, 0);
+        mpz_setbit(y, bits - 1);
+      }
+
+      mpz_comb_powm_sec(z, y, comb);
+      mpz_powm(t, x, y, m);
+
+      ASSERT(mpz_cmp(z, t) == 0);
+    }
+  }
+
+  mpz_comb_clear(comb);
+
+  mpz_clear(x);
+  mpz_clear(y);
+  mpz_clear(z);
+  mpz_clear(t);
+  mpz_clear(m);
+}
+
 static void
 test_mpz_sqrtm(mp_rng_f *rng, void *arg) {
   mpz_t x, z, t, p;
@@ -7608,6 +7950,68 @@ test_mpz_findprime(void) {
   mpz_clear(x);
 }
 
+static void
+test_mpz_sieveprime(void) {
+  arc4_t arc4 = arc4_initial;
+  mpz_t x, d, z, t;
+  mp_limb_t j;
+
+  printf("  - MPZ sieve prime.\n");
+
+  mpz_init(x);
+  mpz_init(d);
+  mpz_init(z);
+  mpz_init(t);
+
+  /* Compare against a naive search. */
+  mpz_urandomb(x, 128, arc4_rng, &arc4);
+  mpz_urandomb(d, 64, arc4_rng, &arc4);
+
+  mpz_setbit(x, 0);
+  mpz_nextprime(d, d, arc4_rng, &arc4);
+  mpz_mul_2exp(d, d, 1);
+
+  ASSERT(mpz_sieveprime(z, x, d, 8192, 20, arc4_rng, &arc4));
+  ASSERT(mpz_probab_prime_p(z, 20, arc4_rng, &arc4));
+
+  for (j = 0;; j++) {
+    mpz_mul_ui(t, d, j);
+    mpz_add(t, t, x);
+
+    if (mpz_cmp(t, z) == 0)
+      break;
+
+    ASSERT(!mpz_probab_prime_p(t, 20, arc4_rng, &arc4));
+  }
+
+  /* Empty interval. */
+  ASSERT(!mpz_sieveprime(z, x, d, j, 20, arc4_rng, &arc4));
+
+  /* Every candidate is divisible by 3. */
+  mpz_mul_ui(x, x, 3);
+  mpz_mul_ui(d, d, 3);
+
+  ASSERT(!mpz_sieveprime(z, x, d, 8192, 20, arc4_rng, &arc4));
+
+  /* Small inputs. */
+  mpz_set_ui(x, 0);
+  mpz_set_ui(d, 1);
+
+  ASSERT(mpz_sieveprime(z, x, d, 3, 20, arc4_rng, &arc4));
+  ASSERT(mpz_cmp_ui(z, 2) == 0);
+
+  mpz_set_ui(x, 8191 + 2);
+  mpz_set_ui(d, 2);
+
+  ASSERT(mpz_sieveprime(z, x, d, 10, 20, arc4_rng, &arc4));
+  ASSERT(mpz_cmp_ui(z, 8209) == 0);
+
+  mpz_clear(x);
+  mpz_clear(d);
+  mpz_clear(z);
+  mpz_clear(t);
+}
+
 static void
 test_mpz_helpers(void) {
   static const mp_limb_t trailp[4] = {4, 3, 2, 0};
@@ -8359,6 +8763,71 @@ bench_mpn_invert(mp_start_f *start, mp_end_f *end, mp_rng_f *rng, void *arg) {
   end(&tv, i);
 }
 
+static void
+bench_mpn_mul(mp_start_f *start, mp_end_f *end, mp_rng_f *rng, void *arg) {
+  /* Times one level of each algorithm (recursing
+     through the current thresholds) at a range of
+     sizes, for picking the crossover points. */
+  static const mp_size_t sizes[] = {16, 24, 32, 48, 64, 96, 128, 192, 256};
+  static const char *names[] = {"basecase", "karatsuba", "toom3"};
+  mp_size_t n = sizes[ARRAY_SIZE(sizes) - 1];
+  mp_limb_t *xp = mp_alloc_limbs(n);
+  mp_limb_t *yp = mp_alloc_limbs(n);
+  mp_limb_t *zp = mp_alloc_limbs(n * 2);
+  mp_limb_t *tp = mp_alloc_limbs(MPN_MUL_N_ITCH(n));
+  char name[64];
+  mp_size_t i;
+  uint64_t tv;
+  int j, k, sqr, iter;
+
+  mpn_random(xp, n, rng, arg);
+  mpn_random(yp, n, rng, arg);
+
+  for (sqr = 0; sqr < 2; sqr++) {
+    for (i = 0; i < (mp_size_t)ARRAY_SIZE(sizes); i++) {
+      n = sizes[i];
+      iter = (int)(50000000 / (n * n));
+
+      for (j = 0; j < 3; j++) {
+        sprintf(name, "mpn_%s/%s (%d)", sqr ? "sqr" : "mul",
+                                        names[j], (int)n);
+
+        start(&tv, name);
+
+        for (k = 0; k < iter; k++) {
+          switch (j * 2 + sqr) {
+            case 0:
+              mpn_mul_basecase(zp, xp, n, yp, n);
+              break;
+            case 1:
+              mpn_sqr_basecase(zp, xp, n, tp);
+              break;
+            case 2:
+              mpn_kara_mul_n(zp, xp, yp, n, tp);
+              break;
+            case 3:
+              mpn_kara_sqr(zp, xp, n, tp);
+              break;
+            case 4:
+              mpn_toom3_mul_n(zp, xp, yp, n, tp);
+              break;
+            case 5:
+              mpn_toom3_sqr(zp, xp, n, tp);
+              break;
+          }
+        }
+
+        end(&tv, k);
+      }
+    }
+  }
+
+  mp_free_limbs(xp);
+  mp_free_limbs(yp);
+  mp_free_limbs(zp);
+  mp_free_limbs(tp);
+}
+
 /*
  * Test
  */
@@ -8393,6 +8862,10 @@ test_mpi_internal(mp_rng_f *rng, void *arg) {
   test_mpn_addmul_1(rng, arg);
   test_mpn_submul_1(rng, arg);
   test_mpn_sqr(rng, arg);
+  test_mpn_mul_large(rng, arg);
+#if defined(MP_HAVE_ADX)
+  test_mpn_addmul_1_adx(rng, arg);
+#endif
   test_mpn_mod(rng, arg);
   test_mpn_mod_1(rng, arg);
   test_mpn_roots(rng, arg);
@@ -8493,6 +8966,9 @@ test_mpi_internal(mp_rng_f *rng, void *arg) {
   test_mpz_jacobi();
   test_mpz_kronecker();
   test_mpz_powm(rng, arg);
+  test_mpz_mont_powm(rng, arg);
+  test_mpz_mont_powm2(rng, arg);
+  test_mpz_comb_powm(rng, arg);
   test_mpz_sqrtm(rng, arg);
   test_mpz_sqrtpq(rng, arg);
   test_mpz_remove(rng, arg);
@@ -8505,6 +8981,7 @@ test_mpi_internal(mp_rng_f *rng, void *arg) {
   test_mpz_randprime(rng, arg);
   test_mpz_nextprime(rng, arg);
   test_mpz_findprime();
+  test_mpz_sieveprime();
   test_mpz_helpers();
   test_mpz_io(rng, arg);
   test_mpz_io_str(rng, arg);
@@ -8520,4 +8997,5 @@ test_mpi_internal(mp_rng_f *rng, void *arg) {
 void
 bench_mpi_internal(mp_start_f *start, mp_end_f *end, mp_rng_f *rng, void *arg) {
   bench_mpn_invert(start, end, rng, arg);
+  bench_mpn_mul(start, end, rng, arg);
 }
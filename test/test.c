@@ -216,6 +216,75 @@ hex_parse(unsigned char *out, size_t len, const char *str) {
   ASSERT(out_len == len);
 }
 
+/* Runners for the job-based interfaces
+   (rsa_run_f, kdf_run_f, dsa_run_f). */
+typedef void job_f(void *);
+
+static void
+run_reverse(job_f *job, void **args, size_t len, void *arg) {
+  size_t *count = (size_t *)arg;
+
+  while (len--) {
+    job(args[len]);
+    *count += 1;
+  }
+}
+
+static void
+run_drop(job_f *job, void **args, size_t len, void *arg) {
+  size_t i;
+
+  (void)arg;
+
+  for (i = 0; i < len - 1; i++)
+    job(args[i]);
+}
+
+#ifdef TORSION_HAVE_THREADS
+typedef struct task_s {
+  job_f *job;
+  void *arg;
+  torsion_thread_t *thread;
+} task_t;
+
+static void *
+thread_job(void *ptr) {
+  task_t *task = (task_t *)ptr;
+
+  task->job(task->arg);
+
+  return NULL;
+}
+
+static void
+run_threads(job_f *job, void **args, size_t len, void *arg) {
+  task_t *tasks = (task_t *)malloc(len * sizeof(task_t));
+  size_t i;
+
+  (void)arg;
+
+  ASSERT(tasks != NULL);
+
+  for (i = 1; i < len; i++) {
+    tasks[i].job = job;
+    tasks[i].arg = args[i];
+    tasks[i].thread = torsion_thread_alloc();
+
+    ASSERT(torsion_thread_create(tasks[i].thread, NULL, thread_job,
+                                 (void *)&tasks[i]) == 0);
+  }
+
+  job(args[0]);
+
+  for (i = 1; i < len; i++) {
+    ASSERT(torsion_thread_join(tasks[i].thread, NULL) == 0);
+    torsion_thread_free(tasks[i].thread);
+  }
+
+  free(tasks);
+}
+#endif /* TORSION_HAVE_THREADS */
+
 /*
  * Memcmp
  */
@@ -256,6 +325,7 @@ test_aead_chachapoly(drbg_t *unused) {
   static unsigned char output[8192];
   static unsigned char tag[16];
   static unsigned char mac[16];
+  chachapoly_iov_t iov[3];
   chachapoly_t ctx;
   unsigned int i;
 
@@ -315,6 +385,102 @@ test_aead_chachapoly(drbg_t *unused) {
 
     ASSERT(torsion_memcmp(mac, tag, 16) == 0);
     ASSERT(torsion_memequal(mac, tag, 16));
+
+    iov[0].data = data;
+    iov[0].len = data_len / 3;
+    iov[1].data = data + iov[0].len;
+    iov[1].len = 0;
+    iov[2].data = iov[1].data;
+    iov[2].len = data_len - iov[0].len;
+
+    chachapoly_seal(mac, iov, 3, aad, aad_len, key, nonce, nonce_len);
+
+    ASSERT(torsion_memcmp(data, output, output_len) == 0);
+    ASSERT(torsion_memcmp(mac, tag, 16) == 0);
+
+    ASSERT(chachapoly_open(tag, iov, 3, aad, aad_len, key, nonce, nonce_len));
+    ASSERT(torsion_memcmp(data, input, input_len) == 0);
+
+    tag[i & 15] ^= 1;
+
+    memcpy(data, output, output_len);
+    memset(raw, 0, data_len);
+
+    ASSERT(!chachapoly_open(tag, iov, 3, aad, aad_len, key, nonce, nonce_len));
+    ASSERT(torsion_memcmp(data, raw, data_len) == 0);
+  }
+}
+
+static void
+test_aead_chachapoly_batch(drbg_t *rng) {
+  static const size_t iv_sizes[4] = {8, 12, 16, 24};
+  static unsigned char keys[11][32];
+  static unsigned char ivs[11][24];
+  static unsigned char aads[11][32];
+  static unsigned char input[11][300];
+  static unsigned char data[11][300];
+  static unsigned char tags[11][16];
+  unsigned char expect[300];
+  unsigned char mac[16];
+  chachapoly_msg_t msgs[11];
+  chachapoly_t ctx;
+  int valid[11];
+  size_t i;
+
+  for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+    drbg_generate(rng, keys[i], 32);
+    drbg_generate(rng, ivs[i], 24);
+    drbg_generate(rng, aads[i], 32);
+    drbg_generate(rng, input[i], 300);
+
+    memcpy(data[i], input[i], 300);
+
+    msgs[i].key = keys[i];
+    msgs[i].iv = ivs[i];
+    msgs[i].iv_len = iv_sizes[i & 3];
+    msgs[i].aad = aads[i];
+    msgs[i].aad_len = drbg_uniform(rng, 33);
+    msgs[i].data = data[i];
+    msgs[i].len = i == 0 ? 0 : drbg_uniform(rng, 301);
+    msgs[i].tag = tags[i];
+  }
+
+  chachapoly_seal_batch(msgs, ARRAY_SIZE(msgs));
+
+  for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+    memcpy(expect, input[i], msgs[i].len);
+
+    chachapoly_init(&ctx, keys[i], ivs[i], msgs[i].iv_len);
+    chachapoly_aad(&ctx, aads[i], msgs[i].aad_len);
+    chachapoly_encrypt(&ctx, expect, expect, msgs[i].len);
+    chachapoly_final(&ctx, mac);
+
+    ASSERT(torsion_memcmp(data[i], expect, msgs[i].len) == 0);
+    ASSERT(torsion_memcmp(tags[i], mac, 16) == 0);
+  }
+
+  ASSERT(chachapoly_open_batch(valid, msgs, ARRAY_SIZE(msgs)));
+
+  for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+    ASSERT(valid[i] == 1);
+    ASSERT(torsion_memcmp(data[i], input[i], 300) == 0);
+  }
+
+  chachapoly_seal_batch(msgs, ARRAY_SIZE(msgs));
+
+  tags[5][0] ^= 1;
+
+  ASSERT(!chachapoly_open_batch(valid, msgs, ARRAY_SIZE(msgs)));
+
+  memset(expect, 0, sizeof(expect));
+
+  for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+    ASSERT(valid[i] == (i != 5));
+
+    if (valid[i])
+      ASSERT(torsion_memcmp(data[i], input[i], msgs[i].len) == 0);
+    else
+      ASSERT(torsion_memcmp(data[i], expect, msgs[i].len) == 0);
   }
 }
 
@@ -656,6 +822,84 @@ test_cipher_aead(drbg_t *rng) {
   }
 }
 
+static void
+test_cipher_gcm_batch(drbg_t *rng) {
+  static unsigned char ivs[9][16];
+  static unsigned char aads[9][32];
+  static unsigned char input[9][300];
+  static unsigned char data[9][300];
+  static unsigned char tags[9][16];
+  unsigned char expect[300];
+  unsigned char key[32];
+  unsigned char mac[16];
+  cipher_t ciphers[2];
+  gcm_msg_t msgs[9];
+  int valid[9];
+  gcm_t mode;
+  size_t i;
+
+  drbg_generate(rng, key, 32);
+
+  cipher_init(&ciphers[0], CIPHER_AES256, key, 32);
+  cipher_init(&ciphers[1], CIPHER_AES128, key, 16);
+
+  for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+    drbg_generate(rng, ivs[i], 16);
+    drbg_generate(rng, aads[i], 32);
+    drbg_generate(rng, input[i], 300);
+
+    memcpy(data[i], input[i], 300);
+
+    msgs[i].cipher = &ciphers[i >= 6];
+    msgs[i].iv = ivs[i];
+    msgs[i].iv_len = (i & 1) ? 16 : 12;
+    msgs[i].aad = aads[i];
+    msgs[i].aad_len = drbg_uniform(rng, 33);
+    msgs[i].data = data[i];
+    msgs[i].len = drbg_uniform(rng, 301);
+    msgs[i].tag = tags[i];
+  }
+
+  ASSERT(gcm_seal_batch(msgs, ARRAY_SIZE(msgs)));
+
+  for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+    memcpy(expect, input[i], msgs[i].len);
+
+    ASSERT(gcm_init(&mode, msgs[i].cipher, ivs[i], msgs[i].iv_len));
+
+    gcm_aad(&mode, aads[i], msgs[i].aad_len);
+    gcm_encrypt(&mode, msgs[i].cipher, expect, expect, msgs[i].len);
+    gcm_digest(&mode, mac);
+
+    ASSERT(torsion_memcmp(data[i], expect, msgs[i].len) == 0);
+    ASSERT(torsion_memcmp(tags[i], mac, 16) == 0);
+  }
+
+  ASSERT(gcm_open_batch(valid, msgs, ARRAY_SIZE(msgs)));
+
+  for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+    ASSERT(valid[i] == 1);
+    ASSERT(torsion_memcmp(data[i], input[i], 300) == 0);
+  }
+
+  ASSERT(gcm_seal_batch(msgs, ARRAY_SIZE(msgs)));
+
+  tags[7][15] ^= 1;
+
+  ASSERT(!gcm_open_batch(valid, msgs, ARRAY_SIZE(msgs)));
+
+  memset(expect, 0, sizeof(expect));
+
+  for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+    ASSERT(valid[i] == (i != 7));
+
+    if (valid[i])
+      ASSERT(torsion_memcmp(data[i], input[i], msgs[i].len) == 0);
+    else
+      ASSERT(torsion_memcmp(data[i], expect, msgs[i].len) == 0);
+  }
+}
+
 /*
  * DRBG
  */
@@ -943,6 +1187,97 @@ test_dsa_keygen(drbg_t *rng) {
   ASSERT(torsion_memcmp(alice_sec, bob_sec, bob_sec_len) == 0);
 }
 
+static void
+test_dsa_generate_runner(drbg_t *rng) {
+  unsigned char expect[DSA_MAX_PARAMS_SIZE];
+  unsigned char params[DSA_MAX_PARAMS_SIZE];
+  unsigned char entropy[ENTROPY_SIZE];
+  size_t expect_len, params_len;
+  size_t count = 0;
+
+  drbg_generate(rng, entropy, ENTROPY_SIZE);
+
+  ASSERT(dsa_params_generate(expect, &expect_len, 1024, entropy));
+
+  /* The search windows may run in any order. */
+  ASSERT(dsa_params_generate_with_runner(params, &params_len, 1024, entropy,
+                                         run_reverse, &count));
+
+  ASSERT(params_len == expect_len);
+  ASSERT(torsion_memcmp(params, expect, params_len) == 0);
+  ASSERT(count > 0);
+
+  ASSERT(!dsa_params_generate_with_runner(params, &params_len, 1024, entropy,
+                                          run_drop, NULL));
+
+#ifdef TORSION_HAVE_THREADS
+  ASSERT(dsa_params_generate_with_runner(params, &params_len, 1024, entropy,
+                                         run_threads, NULL));
+
+  ASSERT(params_len == expect_len);
+  ASSERT(torsion_memcmp(params, expect, params_len) == 0);
+#endif
+}
+
+static void
+test_dsa_domain(drbg_t *rng) {
+  unsigned char params[DSA_MAX_PARAMS_SIZE];
+  unsigned char other[DSA_MAX_PARAMS_SIZE];
+  unsigned char priv[DSA_MAX_PRIV_SIZE];
+  unsigned char pub[DSA_MAX_PUB_SIZE];
+  unsigned char sig1[DSA_MAX_SIG_SIZE];
+  unsigned char sig2[DSA_MAX_SIG_SIZE];
+  unsigned char entropy[ENTROPY_SIZE];
+  unsigned char msg[32];
+  size_t params_len, other_len, priv_len, pub_len;
+  size_t sig1_len, sig2_len;
+  dsa_domain_t *domain;
+  int i;
+
+  drbg_generate(rng, entropy, ENTROPY_SIZE);
+
+  ASSERT(dsa_params_generate(params, &params_len, 1024, entropy));
+
+  drbg_generate(rng, entropy, ENTROPY_SIZE);
+
+  ASSERT(dsa_params_generate(other, &other_len, 1024, entropy));
+
+  ASSERT(dsa_domain_create(params, params_len - 1) == NULL);
+
+  domain = dsa_domain_create(params, params_len);
+
+  ASSERT(domain != NULL);
+  ASSERT(dsa_domain_bits(domain) == 1024);
+  ASSERT(dsa_domain_qbits(domain) == 160);
+
+  for (i = 0; i < 4; i++) {
+    drbg_generate(rng, entropy, ENTROPY_SIZE);
+    drbg_generate(rng, msg, sizeof(msg));
+
+    ASSERT(dsa_domain_privkey_create(priv, &priv_len, domain, entropy));
+    ASSERT(dsa_privkey_verify(priv, priv_len));
+    ASSERT(dsa_pubkey_create(pub, &pub_len, priv, priv_len));
+
+    ASSERT(dsa_sign(sig1, &sig1_len, msg, sizeof(msg),
+                    priv, priv_len, entropy));
+
+    ASSERT(dsa_domain_sign(sig2, &sig2_len, msg, sizeof(msg),
+                           priv, priv_len, domain, entropy));
+
+    ASSERT(sig1_len == sig2_len);
+    ASSERT(torsion_memcmp(sig1, sig2, sig1_len) == 0);
+    ASSERT(dsa_verify(msg, sizeof(msg), sig2, sig2_len, pub, pub_len));
+  }
+
+  /* Keys from another domain are rejected. */
+  ASSERT(dsa_privkey_create(priv, &priv_len, other, other_len, entropy));
+
+  ASSERT(!dsa_domain_sign(sig2, &sig2_len, msg, sizeof(msg),
+                          priv, priv_len, domain, entropy));
+
+  dsa_domain_destroy(domain);
+}
+
 /*
  * ECC
  */
@@ -1223,6 +1558,212 @@ test_ecdsa_random(drbg_t *rng) {
   }
 }
 
+static void
+test_ecdsa_presign(drbg_t *rng) {
+  size_t i, j;
+
+  for (i = 0; i < ARRAY_SIZE(wei_curves); i++) {
+    wei_curve_id_t type = (wei_curve_id_t)i;
+    wei_curve_t *ec = wei_curve_create(type);
+    size_t sc_size = wei_curve_scalar_size(ec);
+    unsigned char entropy[ENTROPY_SIZE];
+    unsigned char priv[ECDSA_MAX_PRIV_SIZE];
+    unsigned char msg[WEI_MAX_SCALAR_SIZE];
+    unsigned char sig[ECDSA_MAX_SIG_SIZE];
+    unsigned char last[ECDSA_MAX_SIG_SIZE];
+    unsigned char pub[ECDSA_MAX_PUB_SIZE];
+    unsigned char rec[ECDSA_MAX_PUB_SIZE];
+    size_t pub_len, rec_len;
+    ecdsa_presign_t *pool;
+    unsigned int param;
+
+    printf("  - %s\n", wei_curves[type]);
+
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ecdsa_privkey_generate(ec, priv, entropy);
+
+    ASSERT(ecdsa_pubkey_create(ec, pub, &pub_len, priv, 1));
+
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    pool = ecdsa_presign_create(ec, 20, entropy);
+
+    ASSERT(ecdsa_presign_fill(ec, pool, 0) == 0);
+    ASSERT(!ecdsa_sign_presigned(ec, sig, &param, msg, sc_size, priv, pool));
+    ASSERT(ecdsa_presign_fill(ec, pool, 3) == 3);
+    ASSERT(ecdsa_presign_fill(ec, pool, 100) == 20);
+
+    memset(last, 0, sizeof(last));
+
+    for (j = 0; j < 20; j++) {
+      drbg_generate(rng, msg, sizeof(msg));
+
+      ASSERT(ecdsa_sign_presigned(ec, sig, &param, msg, sc_size, priv, pool));
+      ASSERT(ecdsa_is_low_s(ec, sig));
+      ASSERT(ecdsa_verify(ec, msg, sc_size, sig, pub, pub_len));
+      ASSERT(ecdsa_recover(ec, rec, &rec_len, msg, sc_size, sig, param, 1));
+      ASSERT(rec_len == pub_len);
+      ASSERT(torsion_memcmp(pub, rec, pub_len) == 0);
+      ASSERT(torsion_memcmp(sig, last, sc_size) != 0);
+
+      memcpy(last, sig, sc_size);
+    }
+
+    ASSERT(!ecdsa_sign_presigned(ec, sig, &param, msg, sc_size, priv, pool));
+    ASSERT(ecdsa_presign_fill(ec, pool, 1) == 1);
+    ASSERT(ecdsa_sign_presigned(ec, sig, &param, msg, sc_size, priv, pool));
+    ASSERT(ecdsa_verify(ec, msg, sc_size, sig, pub, pub_len));
+
+    ecdsa_presign_destroy(ec, pool);
+    wei_curve_destroy(ec);
+  }
+}
+
+static void
+test_ecdsa_recover_batch(drbg_t *rng) {
+  size_t i, j;
+
+  for (i = 0; i < ARRAY_SIZE(wei_curves); i++) {
+    wei_curve_id_t type = (wei_curve_id_t)i;
+    wei_curve_t *ec = wei_curve_create(type);
+    size_t sc_size = wei_curve_scalar_size(ec);
+    unsigned char entropy[ENTROPY_SIZE];
+    unsigned char priv[ECDSA_MAX_PRIV_SIZE];
+    unsigned char msgs[20][WEI_MAX_SCALAR_SIZE];
+    unsigned char sigs[20][ECDSA_MAX_SIG_SIZE];
+    unsigned char pubs[20][ECDSA_MAX_PUB_SIZE];
+    unsigned char recs[20][ECDSA_MAX_PUB_SIZE];
+    unsigned char rec[ECDSA_MAX_PUB_SIZE];
+    const unsigned char *msg_ptrs[20];
+    const unsigned char *sig_ptrs[20];
+    unsigned char *rec_ptrs[20];
+    size_t msg_lens[20];
+    size_t rec_lens[20];
+    unsigned int params[20];
+    int results[20];
+    size_t pub_len, rec_len;
+
+    printf("  - %s\n", wei_curves[type]);
+
+    for (j = 0; j < 20; j++) {
+      drbg_generate(rng, entropy, sizeof(entropy));
+      drbg_generate(rng, msgs[j], sizeof(msgs[j]));
+
+      ecdsa_privkey_generate(ec, priv, entropy);
+
+      ASSERT(ecdsa_sign(ec, sigs[j], &params[j], msgs[j], sc_size, priv));
+      ASSERT(ecdsa_pubkey_create(ec, pubs[j], &pub_len, priv, 0));
+
+      msg_ptrs[j] = msgs[j];
+      sig_ptrs[j] = sigs[j];
+      rec_ptrs[j] = recs[j];
+      msg_lens[j] = sc_size;
+    }
+
+    /* Zero r. */
+    memset(sigs[5], 0, sc_size);
+
+    ASSERT(!ecdsa_recover_batch(ec, rec_ptrs, rec_lens, msg_ptrs, msg_lens,
+                                sig_ptrs, params, results, 20, 0));
+
+    for (j = 0; j < 20; j++) {
+      int ok = ecdsa_recover(ec, rec, &rec_len, msgs[j], sc_size,
+                             sigs[j], params[j], 0);
+
+      ASSERT(results[j] == ok);
+      ASSERT(results[j] == (j != 5));
+      ASSERT(rec_lens[j] == rec_len);
+      ASSERT(torsion_memcmp(recs[j], rec, rec_len) == 0);
+
+      if (ok)
+        ASSERT(torsion_memcmp(recs[j], pubs[j], pub_len) == 0);
+    }
+
+    ASSERT(ecdsa_recover_batch(ec, rec_ptrs + 6, NULL, msg_ptrs + 6,
+                               msg_lens + 6, sig_ptrs + 6, params + 6,
+                               NULL, 14, 1));
+
+    ASSERT(ecdsa_recover_batch(ec, NULL, NULL, NULL, NULL,
+                               NULL, NULL, NULL, 0, 1));
+
+    wei_curve_destroy(ec);
+  }
+}
+
+static void
+test_ecdsa_tweak_add_batch(drbg_t *rng) {
+  size_t i, j;
+
+  for (i = 0; i < ARRAY_SIZE(wei_curves); i++) {
+    wei_curve_id_t type = (wei_curve_id_t)i;
+    wei_curve_t *ec = wei_curve_create(type);
+    unsigned char entropy[ENTROPY_SIZE];
+    unsigned char priv[ECDSA_MAX_PRIV_SIZE];
+    unsigned char pubs[20][ECDSA_MAX_PUB_SIZE];
+    unsigned char tweaks[20][ECDSA_MAX_PRIV_SIZE];
+    unsigned char outs[20][ECDSA_MAX_PUB_SIZE];
+    unsigned char out[ECDSA_MAX_PUB_SIZE];
+    const unsigned char *pub_ptrs[20];
+    const unsigned char *tweak_ptrs[20];
+    unsigned char *out_ptrs[20];
+    size_t pub_lens[20];
+    size_t out_lens[20];
+    int results[20];
+    size_t out_len;
+
+    printf("  - %s\n", wei_curves[type]);
+
+    for (j = 0; j < 20; j++) {
+      drbg_generate(rng, entropy, sizeof(entropy));
+      ecdsa_privkey_generate(ec, priv, entropy);
+
+      drbg_generate(rng, entropy, sizeof(entropy));
+      ecdsa_privkey_generate(ec, tweaks[j], entropy);
+
+      ASSERT(ecdsa_pubkey_create(ec, pubs[j], &pub_lens[j], priv, j & 1));
+
+      pub_ptrs[j] = pubs[j];
+      tweak_ptrs[j] = tweaks[j];
+      out_ptrs[j] = outs[j];
+    }
+
+    ASSERT(ecdsa_pubkey_tweak_add_batch(ec, out_ptrs, out_lens, pub_ptrs,
+                                        pub_lens, tweak_ptrs, NULL, 20, 1));
+
+    for (j = 0; j < 20; j++) {
+      ASSERT(ecdsa_pubkey_tweak_add(ec, out, &out_len, pubs[j], pub_lens[j],
+                                    tweaks[j], 1));
+      ASSERT(out_lens[j] == out_len);
+      ASSERT(torsion_memcmp(outs[j], out, out_len) == 0);
+    }
+
+    ASSERT(ecdsa_pubkey_tweak_add_batch(ec, out_ptrs, NULL, pub_ptrs,
+                                        pub_lens, tweak_ptrs, NULL, 20, 0));
+
+    for (j = 0; j < 20; j++) {
+      ASSERT(ecdsa_pubkey_tweak_add(ec, out, &out_len, pubs[j], pub_lens[j],
+                                    tweaks[j], 0));
+      ASSERT(torsion_memcmp(outs[j], out, out_len) == 0);
+    }
+
+    /* Tweak resulting in the point at infinity. */
+    ASSERT(ecdsa_privkey_negate(ec, tweaks[9], priv));
+
+    ASSERT(!ecdsa_pubkey_tweak_add_batch(ec, out_ptrs, NULL, pub_ptrs + 10,
+                                         pub_lens + 10, tweak_ptrs, results,
+                                         10, 1));
+
+    for (j = 0; j < 10; j++)
+      ASSERT(results[j] == (j != 9));
+
+    ASSERT(ecdsa_pubkey_tweak_add_batch(ec, out_ptrs, NULL, pub_ptrs,
+                                        pub_lens, tweak_ptrs, NULL, 0, 1));
+
+    wei_curve_destroy(ec);
+  }
+}
+
 static void
 test_ecdsa_sswu(drbg_t *unused) {
   static const unsigned char bytes[32] = {
@@ -1529,6 +2070,142 @@ test_bip340_random(drbg_t *rng) {
   }
 }
 
+static void
+test_bip340_tweak_batch(drbg_t *rng) {
+  wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
+  wei_scratch_t *scratch = wei_scratch_create(ec, 10);
+  unsigned char privs[20][32];
+  unsigned char pubs[20][32];
+  unsigned char tweaks[20][32];
+  unsigned char outs[20][32];
+  const unsigned char *pub_ptrs[20];
+  const unsigned char *tweak_ptrs[20];
+  const unsigned char *out_ptrs[20];
+  int negated[20];
+  size_t i;
+
+  printf("  - SECP256K1\n");
+
+  for (i = 0; i < 20; i++) {
+    drbg_generate(rng, privs[i], 32);
+    drbg_generate(rng, tweaks[i], 32);
+
+    privs[i][0] = 0;
+    tweaks[i][0] = 0;
+
+    /* Zero tweak (Q - P = O). */
+    if (i == 7)
+      memset(tweaks[i], 0, 32);
+
+    ASSERT(bip340_pubkey_create(ec, pubs[i], privs[i]));
+    ASSERT(bip340_pubkey_tweak_add(ec, outs[i], &negated[i],
+                                   pubs[i], tweaks[i]));
+    ASSERT(bip340_pubkey_tweak_add_check(ec, pubs[i], tweaks[i],
+                                         outs[i], negated[i]));
+
+    pub_ptrs[i] = pubs[i];
+    tweak_ptrs[i] = tweaks[i];
+    out_ptrs[i] = outs[i];
+  }
+
+  ASSERT(bip340_pubkey_tweak_check_batch(ec, pub_ptrs, tweak_ptrs, out_ptrs,
+                                         negated, 20, scratch));
+
+  ASSERT(bip340_pubkey_tweak_check_batch(ec, pub_ptrs, tweak_ptrs, out_ptrs,
+                                         negated, 0, scratch));
+
+  negated[17] ^= 1;
+
+  ASSERT(!bip340_pubkey_tweak_check_batch(ec, pub_ptrs, tweak_ptrs, out_ptrs,
+                                          negated, 20, scratch));
+
+  negated[17] ^= 1;
+  tweaks[3][31] ^= 1;
+
+  ASSERT(!bip340_pubkey_tweak_check_batch(ec, pub_ptrs, tweak_ptrs, out_ptrs,
+                                          negated, 20, scratch));
+
+  tweaks[3][31] ^= 1;
+  out_ptrs[11] = outs[12];
+
+  ASSERT(!bip340_pubkey_tweak_check_batch(ec, pub_ptrs, tweak_ptrs, out_ptrs,
+                                          negated, 20, scratch));
+
+  out_ptrs[11] = outs[11];
+
+  ASSERT(bip340_pubkey_tweak_check_batch(ec, pub_ptrs, tweak_ptrs, out_ptrs,
+                                         negated, 20, scratch));
+
+  wei_scratch_destroy(ec, scratch);
+  wei_curve_destroy(ec);
+}
+
+static void
+test_bip340_tweak_add_batch(drbg_t *rng) {
+  wei_curve_t *ec = wei_curve_create(WEI_CURVE_SECP256K1);
+  unsigned char priv[32];
+  unsigned char pubs[20][32];
+  unsigned char tweaks[20][32];
+  unsigned char outs[20][32];
+  unsigned char out[32];
+  const unsigned char *pub_ptrs[20];
+  const unsigned char *tweak_ptrs[20];
+  unsigned char *out_ptrs[20];
+  int negated[20];
+  int results[20];
+  int sign;
+  size_t i;
+
+  printf("  - SECP256K1\n");
+
+  for (i = 0; i < 20; i++) {
+    drbg_generate(rng, priv, 32);
+    drbg_generate(rng, tweaks[i], 32);
+
+    priv[0] = 0;
+    tweaks[i][0] = 0;
+
+    ASSERT(bip340_pubkey_create(ec, pubs[i], priv));
+
+    pub_ptrs[i] = pubs[i];
+    tweak_ptrs[i] = tweaks[i];
+    out_ptrs[i] = outs[i];
+  }
+
+  ASSERT(bip340_pubkey_tweak_add_batch(ec, out_ptrs, negated, pub_ptrs,
+                                       tweak_ptrs, results, 20));
+
+  for (i = 0; i < 20; i++) {
+    ASSERT(bip340_pubkey_tweak_add(ec, out, &sign, pubs[i], tweaks[i]));
+    ASSERT(torsion_memcmp(outs[i], out, 32) == 0);
+    ASSERT(negated[i] == sign);
+    ASSERT(results[i] == 1);
+  }
+
+  /* Tweak not less than the order. */
+  memset(tweaks[4], 0xff, 32);
+
+  /* Public key not on the curve. */
+  memset(pubs[13], 0xff, 32);
+
+  ASSERT(!bip340_pubkey_tweak_add_batch(ec, out_ptrs, NULL, pub_ptrs,
+                                        tweak_ptrs, results, 20));
+
+  for (i = 0; i < 20; i++) {
+    ASSERT(results[i] == (i != 4 && i != 13));
+
+    if (results[i]) {
+      ASSERT(bip340_pubkey_tweak_add(ec, out, NULL, pubs[i], tweaks[i]));
+      ASSERT(torsion_memcmp(outs[i], out, 32) == 0);
+    }
+  }
+
+  ASSERT(bip340_pubkey_tweak_add_batch(ec, NULL, NULL, NULL,
+                                       NULL, NULL, 0));
+
+  wei_curve_destroy(ec);
+}
+
 static void
 test_ecdh_x25519(drbg_t *unused) {
   /* From RFC 7748 */
@@ -1703,30 +2380,112 @@ test_ecdh_random(drbg_t *rng) {
     mont_curve_id_t type = (mont_curve_id_t)i;
     mont_curve_t *ec = mont_curve_create(type);
     size_t fe_size = mont_curve_field_size(ec);
+    unsigned char base[ECDH_MAX_PUB_SIZE];
+
+    printf("  - %s\n", mont_curves[type]);
+
+    /* u(G) = 9 (x25519) or 5 (x448). */
+    memset(base, 0, sizeof(base));
+
+    base[0] = type == MONT_CURVE_X25519 ? 9 : 5;
+
+    for (j = 0; j < 10; j++) {
+      unsigned char alice_priv[ECDH_MAX_PRIV_SIZE];
+      unsigned char alice_pub[ECDH_MAX_PUB_SIZE];
+      unsigned char alice_secret[ECDH_MAX_PUB_SIZE];
+      unsigned char bob_priv[ECDH_MAX_PRIV_SIZE];
+      unsigned char bob_pub[ECDH_MAX_PUB_SIZE];
+      unsigned char bob_secret[ECDH_MAX_PUB_SIZE];
+
+      drbg_generate(rng, alice_priv, sizeof(alice_priv));
+      drbg_generate(rng, bob_priv, sizeof(bob_priv));
+
+      ecdh_pubkey_create(ec, alice_pub, alice_priv);
+      ecdh_pubkey_create(ec, bob_pub, bob_priv);
+
+      /* Fixed-base result must match the ladder. */
+      ASSERT(ecdh_derive(ec, alice_secret, base, alice_priv));
+      ASSERT(torsion_memcmp(alice_secret, alice_pub, fe_size) == 0);
+
+      ASSERT(ecdh_pubkey_verify(ec, alice_pub));
+      ASSERT(ecdh_pubkey_verify(ec, bob_pub));
+
+      ASSERT(ecdh_derive(ec, alice_secret, bob_pub, alice_priv));
+      ASSERT(ecdh_derive(ec, bob_secret, alice_pub, bob_priv));
+
+      ASSERT(torsion_memcmp(alice_secret, bob_secret, fe_size) == 0);
+    }
+
+    mont_curve_destroy(ec);
+  }
+}
+
+static void
+test_ecdh_batch(drbg_t *rng) {
+  unsigned char privs[20][ECDH_MAX_PRIV_SIZE];
+  unsigned char pubs[20][ECDH_MAX_PUB_SIZE];
+  unsigned char secrets[20][ECDH_MAX_PUB_SIZE];
+  unsigned char expect[ECDH_MAX_PUB_SIZE];
+  const unsigned char *priv_ptrs[20];
+  const unsigned char *pub_ptrs[20];
+  unsigned char *secret_ptrs[20];
+  size_t i, j, n;
+
+  for (j = 0; j < 20; j++) {
+    priv_ptrs[j] = privs[j];
+    pub_ptrs[j] = pubs[j];
+    secret_ptrs[j] = secrets[j];
+  }
+
+  for (i = 0; i < ARRAY_SIZE(mont_curves); i++) {
+    mont_curve_id_t type = (mont_curve_id_t)i;
+    mont_curve_t *ec = mont_curve_create(type);
+    size_t fe_size = mont_curve_field_size(ec);
+
+    printf("  - %s\n", mont_curves[type]);
+
+    for (j = 0; j < 20; j++) {
+      drbg_generate(rng, privs[j], sizeof(privs[j]));
+      drbg_generate(rng, pubs[j], sizeof(pubs[j]));
+
+      ecdh_pubkey_create(ec, pubs[j], pubs[j]);
+    }
+
+    ASSERT(ecdh_derive_batch(ec, secret_ptrs, pub_ptrs, priv_ptrs, 20));
+
+    for (j = 0; j < 20; j++) {
+      ASSERT(ecdh_derive(ec, expect, pubs[j], privs[j]));
+      ASSERT(torsion_memcmp(secrets[j], expect, fe_size) == 0);
+    }
 
-    printf("  - %s\n", mont_curves[type]);
+    /* Small order point. */
+    memset(pubs[17], 0, sizeof(pubs[17]));
 
-    for (j = 0; j < 10; j++) {
-      unsigned char alice_priv[ECDH_MAX_PRIV_SIZE];
-      unsigned char alice_pub[ECDH_MAX_PUB_SIZE];
-      unsigned char alice_secret[ECDH_MAX_PUB_SIZE];
-      unsigned char bob_priv[ECDH_MAX_PRIV_SIZE];
-      unsigned char bob_pub[ECDH_MAX_PUB_SIZE];
-      unsigned char bob_secret[ECDH_MAX_PUB_SIZE];
+    ASSERT(!ecdh_derive_batch(ec, secret_ptrs, pub_ptrs, priv_ptrs, 20));
 
-      drbg_generate(rng, alice_priv, sizeof(alice_priv));
-      drbg_generate(rng, bob_priv, sizeof(bob_priv));
+    for (j = 0; j < 20; j++) {
+      ASSERT(ecdh_derive(ec, expect, pubs[j], privs[j]) == (j != 17));
+      ASSERT(torsion_memcmp(secrets[j], expect, fe_size) == 0);
+    }
 
-      ecdh_pubkey_create(ec, alice_pub, alice_priv);
-      ecdh_pubkey_create(ec, bob_pub, bob_priv);
+    ASSERT(ecdh_derive_batch(ec, secret_ptrs, pub_ptrs, priv_ptrs, 0));
 
-      ASSERT(ecdh_pubkey_verify(ec, alice_pub));
-      ASSERT(ecdh_pubkey_verify(ec, bob_pub));
+    /* Arbitrary coordinates and partial lane groups. */
+    for (j = 0; j < 20; j++)
+      drbg_generate(rng, pubs[j], sizeof(pubs[j]));
 
-      ASSERT(ecdh_derive(ec, alice_secret, bob_pub, alice_priv));
-      ASSERT(ecdh_derive(ec, bob_secret, alice_pub, bob_priv));
+    memset(pubs[3], 0xff, fe_size);
 
-      ASSERT(torsion_memcmp(alice_secret, bob_secret, fe_size) == 0);
+    for (n = 1; n <= 20; n += 6) {
+      int ret = ecdh_derive_batch(ec, secret_ptrs, pub_ptrs, priv_ptrs, n);
+      int ok = 1;
+
+      for (j = 0; j < n; j++) {
+        ok &= ecdh_derive(ec, expect, pubs[j], privs[j]);
+        ASSERT(torsion_memcmp(secrets[j], expect, fe_size) == 0);
+      }
+
+      ASSERT(ret == ok);
     }
 
     mont_curve_destroy(ec);
@@ -3958,12 +4717,61 @@ test_kdf_bcrypt_pbkdf(drbg_t *unused) {
     0x76, 0x11, 0x2e, 0x0c, 0x0e, 0xde, 0xc6, 0x85, 0x94, 0x77, 0x7f, 0x75
   };
 
-  unsigned char out[48];
+  /* Three output strides (one pair, one single). */
+  static const unsigned char expect80[] = {
+    0x5b, 0xa4, 0xe7, 0xbf, 0xc6, 0x12, 0x0c, 0x7a, 0x55, 0xc2, 0x72, 0x3b,
+    0x93, 0x14, 0xb8, 0x58, 0x40, 0x06, 0x7f, 0x4c, 0xb9, 0x1c, 0x49, 0x94,
+    0x36, 0xea, 0x92, 0x35, 0x6c, 0x30, 0x55, 0x12, 0x1b, 0x5c, 0x5a, 0x17,
+    0x27, 0x9b, 0xfe, 0x79, 0x1d, 0xad, 0x65, 0xbf, 0xeb, 0x98, 0x42, 0x02,
+    0xd4, 0x9d, 0xdd, 0x7e, 0x1b, 0x98, 0x57, 0x2a, 0xef, 0x90, 0x52, 0xf3,
+    0x71, 0x5e, 0x1a, 0xbf, 0xa9, 0x1d, 0x42, 0x1e, 0xe4, 0x7e, 0x94, 0xe3,
+    0x9d, 0x8f, 0x34, 0x8f, 0x19, 0x79, 0xbe, 0x32
+  };
+
+  unsigned char out[80];
 
   (void)unused;
 
   ASSERT(bcrypt_pbkdf(out, pass, sizeof(pass) - 1, salt, sizeof(salt), 16, 48));
   ASSERT(torsion_memcmp(out, expect, 48) == 0);
+
+  ASSERT(bcrypt_pbkdf(out, (const unsigned char *)"password", 8,
+                     (const unsigned char *)"salt", 4, 4, 80));
+
+  ASSERT(torsion_memcmp(out, expect80, 80) == 0);
+}
+
+static void
+test_kdf_bcrypt_pbkdf_runner(drbg_t *rng) {
+  unsigned char pass[32];
+  unsigned char salt[16];
+  unsigned char expect[200];
+  unsigned char out[200];
+  size_t count = 0;
+
+  drbg_generate(rng, pass, sizeof(pass));
+  drbg_generate(rng, salt, sizeof(salt));
+
+  ASSERT(bcrypt_pbkdf(expect, pass, 32, salt, 16, 2, 200));
+
+  /* Seven strides: three pairs and a single. */
+  ASSERT(bcrypt_pbkdf_with_runner(out, pass, 32, salt, 16, 2, 200,
+                                  run_reverse, &count));
+
+  ASSERT(torsion_memcmp(out, expect, 200) == 0);
+  ASSERT(count == 4);
+
+  ASSERT(!bcrypt_pbkdf_with_runner(out, pass, 32, salt, 16, 2, 200,
+                                   run_drop, NULL));
+
+#ifdef TORSION_HAVE_THREADS
+  memset(out, 0, sizeof(out));
+
+  ASSERT(bcrypt_pbkdf_with_runner(out, pass, 32, salt, 16, 2, 200,
+                                  run_threads, NULL));
+
+  ASSERT(torsion_memcmp(out, expect, 200) == 0);
+#endif
 }
 
 static void
@@ -4163,6 +4971,39 @@ test_kdf_scrypt(drbg_t *unused) {
   ASSERT(torsion_memcmp(out, expect3, 64) == 0);
 }
 
+static void
+test_kdf_scrypt_runner(drbg_t *rng) {
+  unsigned char pass[32];
+  unsigned char salt[32];
+  unsigned char expect[64];
+  unsigned char out[64];
+  size_t count = 0;
+
+  drbg_generate(rng, pass, sizeof(pass));
+  drbg_generate(rng, salt, sizeof(salt));
+
+  ASSERT(scrypt_derive(expect, pass, 32, salt, 32, 256, 2, 5, 64));
+
+  /* One job per smix, in any order. */
+  ASSERT(scrypt_derive_with_runner(out, pass, 32, salt, 32, 256, 2, 5, 64,
+                                   run_reverse, &count));
+
+  ASSERT(torsion_memcmp(out, expect, 64) == 0);
+  ASSERT(count == 5);
+
+  ASSERT(!scrypt_derive_with_runner(out, pass, 32, salt, 32, 256, 2, 5, 64,
+                                    run_drop, NULL));
+
+#ifdef TORSION_HAVE_THREADS
+  memset(out, 0, sizeof(out));
+
+  ASSERT(scrypt_derive_with_runner(out, pass, 32, salt, 32, 256, 2, 5, 64,
+                                   run_threads, NULL));
+
+  ASSERT(torsion_memcmp(out, expect, 64) == 0);
+#endif
+}
+
 /*
  * MAC
  */
@@ -4759,6 +5600,428 @@ test_rsa_random(drbg_t *rng) {
   }
 }
 
+static void
+test_rsa_key(drbg_t *rng) {
+  static unsigned char priv[RSA_MAX_PRIV_SIZE];
+  static unsigned char pub[RSA_MAX_PUB_SIZE];
+  static unsigned char sig[RSA_MAX_MOD_SIZE];
+  static unsigned char ct[RSA_MAX_MOD_SIZE];
+  static unsigned char pt[RSA_MAX_MOD_SIZE];
+  size_t priv_len, pub_len, sig_len, ct_len, pt_len;
+  unsigned char msg[32];
+  unsigned char entropy[ENTROPY_SIZE];
+  rsa_key_t *sk, *pk;
+  size_t i, j;
+
+  for (i = 0; i < 5; i++) {
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ASSERT(rsa_privkey_generate(priv, &priv_len, 1024, 65537, entropy));
+    ASSERT(rsa_pubkey_create(pub, &pub_len, priv, priv_len));
+
+    ASSERT(rsa_key_create_private(pub, pub_len) == NULL);
+    ASSERT(rsa_key_create_public(priv, priv_len) == NULL);
+
+    sk = rsa_key_create_private(priv, priv_len);
+    pk = rsa_key_create_public(pub, pub_len);
+
+    ASSERT(sk != NULL && pk != NULL);
+    ASSERT(rsa_key_has_private(sk));
+    ASSERT(!rsa_key_has_private(pk));
+    ASSERT(rsa_key_bits(sk) == 1024);
+    ASSERT(rsa_key_bits(pk) == 1024);
+
+    drbg_generate(rng, msg, 32);
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    j = drbg_uniform(rng, 128);
+
+    ASSERT(!rsa_key_sign(sig, &sig_len, HASH_SHA256, msg, 32, pk, entropy));
+    ASSERT(rsa_key_sign(sig, &sig_len, HASH_SHA256, msg, 32, sk, entropy));
+
+    ASSERT(rsa_verify(HASH_SHA256, msg, 32, sig, sig_len, pub, pub_len));
+    ASSERT(rsa_key_verify(HASH_SHA256, msg, 32, sig, sig_len, pk));
+    ASSERT(rsa_key_verify(HASH_SHA256, msg, 32, sig, sig_len, sk));
+
+    sig[j] ^= 1;
+
+    ASSERT(!rsa_key_verify(HASH_SHA256, msg, 32, sig, sig_len, pk));
+
+    drbg_generate(rng, msg, 32);
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ASSERT(rsa_key_encrypt(ct, &ct_len, msg, 32, pk, entropy));
+    ASSERT(!rsa_key_decrypt(pt, &pt_len, ct, ct_len, pk, entropy));
+    ASSERT(rsa_key_decrypt(pt, &pt_len, ct, ct_len, sk, entropy));
+    ASSERT(pt_len == 32 && torsion_memcmp(pt, msg, 32) == 0);
+
+    ASSERT(rsa_decrypt(pt, &pt_len, ct, ct_len, priv, priv_len, entropy));
+    ASSERT(pt_len == 32 && torsion_memcmp(pt, msg, 32) == 0);
+
+    ct[j] ^= 1;
+
+    ASSERT(!rsa_key_decrypt(pt, &pt_len, ct, ct_len, sk, entropy));
+
+    drbg_generate(rng, msg, 32);
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ASSERT(rsa_key_sign_pss(sig, &sig_len, HASH_SHA256, msg, 32,
+                            sk, -1, entropy));
+
+    ASSERT(rsa_verify_pss(HASH_SHA256, msg, 32,
+                          sig, sig_len, pub, pub_len, -1));
+
+    ASSERT(rsa_key_verify_pss(HASH_SHA256, msg, 32, sig, sig_len, pk, -1));
+
+    sig[j] ^= 1;
+
+    ASSERT(!rsa_key_verify_pss(HASH_SHA256, msg, 32, sig, sig_len, pk, -1));
+
+    drbg_generate(rng, msg, 32);
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ASSERT(rsa_key_encrypt_oaep(ct, &ct_len, HASH_SHA256, msg, 32,
+                                pk, NULL, 0, entropy));
+
+    ASSERT(rsa_key_decrypt_oaep(pt, &pt_len, HASH_SHA256, ct, ct_len,
+                                sk, NULL, 0, entropy));
+
+    ASSERT(pt_len == 32 && torsion_memcmp(pt, msg, 32) == 0);
+
+    ASSERT(rsa_decrypt_oaep(pt, &pt_len, HASH_SHA256, ct, ct_len,
+                            priv, priv_len, NULL, 0, entropy));
+
+    ASSERT(pt_len == 32 && torsion_memcmp(pt, msg, 32) == 0);
+
+    ct[j] ^= 1;
+
+    ASSERT(!rsa_key_decrypt_oaep(pt, &pt_len, HASH_SHA256, ct, ct_len,
+                                 sk, NULL, 0, entropy));
+
+    /* Cross a blinding refresh. */
+    for (j = 0; j < 40; j++) {
+      drbg_generate(rng, msg, 32);
+      drbg_generate(rng, entropy, sizeof(entropy));
+
+      ASSERT(rsa_key_sign(sig, &sig_len, HASH_SHA256, msg, 32, sk, entropy));
+      ASSERT(rsa_key_verify(HASH_SHA256, msg, 32, sig, sig_len, pk));
+    }
+
+    rsa_key_destroy(sk);
+    rsa_key_destroy(pk);
+  }
+}
+
+static void
+test_rsa_multi(drbg_t *rng) {
+  /* Three-prime key, public key and PKCS1v1.5
+     signature generated by OpenSSL 3.0. */
+  static const unsigned char vpriv[] = {
+    0x30, 0x82, 0x02, 0x7e, 0x02, 0x01, 0x01, 0x02, 0x81, 0x81, 0x00, 0xa9,
+    0x0a, 0xdd, 0x1d, 0x04, 0x84, 0xf6, 0xb5, 0x19, 0x0b, 0x52, 0x2f, 0x78,
+    0xc7, 0x68, 0x28, 0x64, 0x18, 0x5d, 0xc6, 0x98, 0x29, 0xd0, 0xed, 0xca,
+    0xf5, 0x46, 0xf7, 0x37, 0xc1, 0x6a, 0x11, 0xca, 0xfe, 0x20, 0xa0, 0xce,
+    0x20, 0xe1, 0x45, 0x85, 0xf4, 0x80, 0xd6, 0x2e, 0x42, 0xa7, 0x64, 0xa5,
+    0xb5, 0x7c, 0x1c, 0x4b, 0x63, 0x1c, 0xcb, 0x75, 0xb4, 0x40, 0x8f, 0xe5,
+    0x2f, 0x54, 0x6e, 0x0d, 0xc8, 0xa1, 0x8b, 0xda, 0x0b, 0xd6, 0x37, 0x0f,
+    0x6d, 0xb6, 0xf5, 0x92, 0x11, 0xfe, 0x2e, 0xb5, 0x00, 0x98, 0x9d, 0x15,
+    0xe4, 0xd5, 0x34, 0x8c, 0xb1, 0x1b, 0x9c, 0x63, 0xa1, 0xb3, 0x7f, 0x1f,
+    0x36, 0xf9, 0xdb, 0xb1, 0x70, 0xc9, 0x82, 0xa8, 0xe7, 0xca, 0x14, 0x9f,
+    0xb7, 0xa6, 0x0f, 0x57, 0x86, 0x85, 0xaf, 0x32, 0x3f, 0xad, 0x68, 0xc1,
+    0xac, 0x56, 0x93, 0x43, 0x25, 0x00, 0x65, 0x02, 0x03, 0x01, 0x00, 0x01,
+    0x02, 0x81, 0x81, 0x00, 0xa8, 0xc0, 0xe8, 0xa6, 0x3c, 0x49, 0xc4, 0xc4,
+    0x5b, 0xc1, 0x1a, 0x85, 0xbb, 0xac, 0x4e, 0x05, 0xec, 0x8f, 0x0a, 0xa6,
+    0xe4, 0x66, 0xf2, 0x65, 0x41, 0x75, 0x05, 0x28, 0x6d, 0x67, 0xcf, 0xcc,
+    0xfd, 0x7a, 0x1e, 0xf6, 0x89, 0x70, 0xf7, 0x92, 0xe1, 0x3c, 0x7b, 0x08,
+    0x85, 0x13, 0x4f, 0x28, 0xd5, 0x62, 0xe4, 0x57, 0xdc, 0x73, 0xe3, 0x7a,
+    0xd9, 0x3e, 0xec, 0xaa, 0x46, 0xcd, 0xf9, 0x4a, 0x08, 0xcb, 0x4b, 0x0e,
+    0x70, 0xb8, 0xd1, 0x56, 0x48, 0xd7, 0x91, 0x94, 0xaf, 0xa8, 0x9b, 0x4b,
+    0x29, 0x7e, 0x68, 0x14, 0x71, 0xd7, 0xa3, 0xf2, 0xf8, 0x41, 0xa2, 0x30,
+    0x44, 0x95, 0x1a, 0x58, 0xb2, 0x0a, 0x0c, 0xd4, 0x78, 0x5c, 0x5a, 0x92,
+    0x2d, 0x94, 0xa1, 0x78, 0x67, 0xe1, 0x08, 0x23, 0x1d, 0x3c, 0xf7, 0x8d,
+    0xad, 0xe9, 0x2d, 0xd3, 0x7c, 0xe7, 0x4a, 0x58, 0xe6, 0x48, 0xd2, 0xd1,
+    0x02, 0x2b, 0x3e, 0xaf, 0x86, 0x08, 0xa3, 0x61, 0x5d, 0x69, 0x6f, 0x17,
+    0x92, 0xbe, 0xde, 0xbd, 0xb6, 0x10, 0xe1, 0x5b, 0x38, 0xd7, 0x2a, 0x0c,
+    0x0a, 0x6d, 0x6c, 0x4a, 0x12, 0x9d, 0x3f, 0x03, 0x96, 0x9a, 0x33, 0x54,
+    0x9f, 0x94, 0x8f, 0x2d, 0x50, 0xa5, 0xe6, 0xd4, 0x33, 0x02, 0x2b, 0x19,
+    0x10, 0x7c, 0xa0, 0x36, 0x2d, 0xc1, 0xb0, 0x03, 0x98, 0x7e, 0x70, 0x80,
+    0x8b, 0x2a, 0xd5, 0x11, 0x40, 0xc2, 0x55, 0xeb, 0xe1, 0x94, 0x97, 0xdf,
+    0x4f, 0xf1, 0x84, 0x71, 0x10, 0xf2, 0xa7, 0xe5, 0x5e, 0x7d, 0x79, 0x6b,
+    0x4c, 0x71, 0x8f, 0xfa, 0xe6, 0x3b, 0x02, 0x2b, 0x09, 0xeb, 0x38, 0x28,
+    0x31, 0xc1, 0xfc, 0x47, 0xec, 0x9e, 0x2c, 0x48, 0x2b, 0x72, 0x95, 0x56,
+    0x82, 0x72, 0x2e, 0xc2, 0x4d, 0x12, 0xee, 0xab, 0x75, 0xd1, 0x1a, 0xb4,
+    0xea, 0xfd, 0xa4, 0x5c, 0xed, 0xf6, 0x5b, 0xf1, 0xe3, 0xdd, 0xe5, 0xbe,
+    0xfa, 0x91, 0x65, 0x02, 0x2b, 0x11, 0xb7, 0x69, 0xa0, 0x05, 0x2b, 0xca,
+    0xa0, 0x93, 0xaa, 0x12, 0x95, 0x8b, 0x06, 0xd3, 0xbb, 0xcf, 0x7a, 0x2a,
+    0xe3, 0x78, 0xdb, 0xf6, 0xa0, 0x73, 0x24, 0x9a, 0xde, 0xb6, 0xdc, 0xf7,
+    0xe8, 0x5d, 0x64, 0xb0, 0xe4, 0x46, 0x47, 0xbe, 0x6d, 0xbb, 0x37, 0x49,
+    0x02, 0x2b, 0x08, 0x49, 0xf6, 0x9f, 0xca, 0xad, 0x9c, 0xee, 0xd5, 0xb4,
+    0x56, 0x13, 0xcf, 0x72, 0x89, 0x37, 0xaf, 0x7a, 0x86, 0x3d, 0x4a, 0x79,
+    0xc2, 0xaf, 0x93, 0xc5, 0x27, 0x29, 0xa7, 0x18, 0x02, 0x11, 0x63, 0xca,
+    0x73, 0x55, 0xa4, 0xca, 0x85, 0x49, 0xae, 0xee, 0xf7, 0x30, 0x81, 0x8a,
+    0x30, 0x81, 0x87, 0x02, 0x2b, 0x1b, 0x8a, 0xfe, 0x2d, 0x64, 0xff, 0x55,
+    0x2a, 0x10, 0x55, 0x6d, 0x6c, 0xf4, 0x8c, 0x52, 0xc3, 0xf8, 0x0d, 0x09,
+    0x54, 0xbc, 0x00, 0x1f, 0x42, 0x0f, 0x4b, 0x73, 0x79, 0xa5, 0x1b, 0x6e,
+    0x14, 0x04, 0x9d, 0xd1, 0x53, 0x8f, 0x09, 0xec, 0x78, 0x5b, 0x07, 0xa5,
+    0x02, 0x2b, 0x0b, 0xa2, 0x92, 0xaf, 0x50, 0x7c, 0x00, 0x59, 0x0d, 0x9f,
+    0x58, 0xe3, 0x6f, 0x07, 0x1c, 0x2b, 0x86, 0xcc, 0xd3, 0x05, 0x45, 0x89,
+    0xf3, 0xaa, 0x6f, 0x55, 0x9b, 0x49, 0x66, 0xf3, 0x08, 0x74, 0x52, 0x62,
+    0xec, 0xbb, 0x94, 0xb0, 0x47, 0x81, 0xac, 0x4a, 0xb5, 0x02, 0x2b, 0x10,
+    0xc6, 0x78, 0x4c, 0x9b, 0x50, 0xc4, 0xdb, 0x42, 0x4a, 0x1f, 0x1d, 0xf2,
+    0x02, 0x66, 0xed, 0x4c, 0x01, 0x56, 0x66, 0x4f, 0x03, 0x79, 0x1d, 0x4e,
+    0xbc, 0x61, 0xd5, 0x0a, 0xd4, 0x3a, 0xf6, 0xc7, 0x01, 0xb1, 0xf9, 0x9c,
+    0x1b, 0x79, 0x80, 0x31, 0x1f, 0x11
+  };
+
+  static const unsigned char vpub[] = {
+    0x30, 0x81, 0x89, 0x02, 0x81, 0x81, 0x00, 0xa9, 0x0a, 0xdd, 0x1d, 0x04,
+    0x84, 0xf6, 0xb5, 0x19, 0x0b, 0x52, 0x2f, 0x78, 0xc7, 0x68, 0x28, 0x64,
+    0x18, 0x5d, 0xc6, 0x98, 0x29, 0xd0, 0xed, 0xca, 0xf5, 0x46, 0xf7, 0x37,
+    0xc1, 0x6a, 0x11, 0xca, 0xfe, 0x20, 0xa0, 0xce, 0x20, 0xe1, 0x45, 0x85,
+    0xf4, 0x80, 0xd6, 0x2e, 0x42, 0xa7, 0x64, 0xa5, 0xb5, 0x7c, 0x1c, 0x4b,
+    0x63, 0x1c, 0xcb, 0x75, 0xb4, 0x40, 0x8f, 0xe5, 0x2f, 0x54, 0x6e, 0x0d,
+    0xc8, 0xa1, 0x8b, 0xda, 0x0b, 0xd6, 0x37, 0x0f, 0x6d, 0xb6, 0xf5, 0x92,
+    0x11, 0xfe, 0x2e, 0xb5, 0x00, 0x98, 0x9d, 0x15, 0xe4, 0xd5, 0x34, 0x8c,
+    0xb1, 0x1b, 0x9c, 0x63, 0xa1, 0xb3, 0x7f, 0x1f, 0x36, 0xf9, 0xdb, 0xb1,
+    0x70, 0xc9, 0x82, 0xa8, 0xe7, 0xca, 0x14, 0x9f, 0xb7, 0xa6, 0x0f, 0x57,
+    0x86, 0x85, 0xaf, 0x32, 0x3f, 0xad, 0x68, 0xc1, 0xac, 0x56, 0x93, 0x43,
+    0x25, 0x00, 0x65, 0x02, 0x03, 0x01, 0x00, 0x01
+  };
+
+  static const unsigned char vmsg[] = {
+    0xe7, 0x15, 0x3a, 0x81, 0x18, 0x89, 0x4d, 0x8a, 0xac, 0x8c, 0x3f, 0x7a,
+    0x61, 0xa9, 0xd6, 0x66, 0xe2, 0xb8, 0xbf, 0x67, 0xe6, 0x5e, 0x85, 0x07,
+    0x4b, 0x63, 0x72, 0xd1, 0x61, 0x96, 0xaa, 0x84
+  };
+
+  static const unsigned char vsig[] = {
+    0xa1, 0x09, 0x74, 0x58, 0x62, 0xc4, 0xd9, 0xc6, 0x78, 0xd9, 0x6c, 0xf1,
+    0x33, 0x17, 0x16, 0x11, 0x03, 0xfe, 0x0a, 0x39, 0x2b, 0xe9, 0x74, 0x1d,
+    0xee, 0xed, 0x61, 0xb4, 0x75, 0xac, 0xe1, 0x70, 0x82, 0x29, 0xbe, 0x39,
+    0x7d, 0x33, 0x1c, 0xe4, 0x50, 0x44, 0xaf, 0x8e, 0x3b, 0x7f, 0xa4, 0x35,
+    0x9f, 0xf6, 0x4f, 0x59, 0x53, 0x6d, 0xea, 0xf6, 0x80, 0x11, 0xd9, 0x20,
+    0x13, 0xb7, 0x0d, 0x1c, 0x92, 0xc5, 0x30, 0x40, 0x98, 0xba, 0xd6, 0xc4,
+    0x2e, 0x87, 0xf8, 0x20, 0xd5, 0x0a, 0x12, 0x1b, 0xb5, 0xff, 0x62, 0xd0,
+    0xf7, 0x95, 0x1c, 0xf7, 0x3e, 0x24, 0x0e, 0x62, 0x0c, 0x19, 0x37, 0x75,
+    0x77, 0x9f, 0xc5, 0x04, 0x4a, 0x76, 0xef, 0xe3, 0x24, 0x7a, 0xe7, 0xfe,
+    0x9a, 0x80, 0xfc, 0xad, 0x63, 0xd0, 0x8f, 0x9f, 0x68, 0xbd, 0xeb, 0x1d,
+    0xc0, 0x54, 0xd8, 0x8f, 0x77, 0x9d, 0x8c, 0xe5
+  };
+
+  static unsigned char priv[RSA_MAX_PRIV_SIZE];
+  static unsigned char pub[RSA_MAX_PUB_SIZE];
+  static unsigned char sig[RSA_MAX_MOD_SIZE];
+  static unsigned char ct[RSA_MAX_MOD_SIZE];
+  static unsigned char pt[RSA_MAX_MOD_SIZE];
+  static unsigned char out[RSA_MAX_PRIV_SIZE];
+  size_t priv_len, pub_len, sig_len, ct_len, pt_len, len;
+  unsigned char msg[32];
+  unsigned char entropy[ENTROPY_SIZE];
+  rsa_key_t *sk, *pk;
+  unsigned int primes;
+  size_t j;
+
+  drbg_generate(rng, entropy, sizeof(entropy));
+
+  ASSERT(rsa_privkey_verify(vpriv, sizeof(vpriv)));
+  ASSERT(rsa_privkey_bits(vpriv, sizeof(vpriv)) == 1024);
+
+  ASSERT(rsa_pubkey_create(out, &len, vpriv, sizeof(vpriv)));
+  ASSERT(len == sizeof(vpub) && torsion_memcmp(out, vpub, len) == 0);
+
+  ASSERT(rsa_sign(out, &len, HASH_SHA256, vmsg, sizeof(vmsg),
+                  vpriv, sizeof(vpriv), entropy));
+
+  ASSERT(len == sizeof(vsig) && torsion_memcmp(out, vsig, len) == 0);
+
+  ASSERT(rsa_verify(HASH_SHA256, vmsg, sizeof(vmsg),
+                    vsig, sizeof(vsig), vpub, sizeof(vpub)));
+
+  /* The raw format cannot hold the third prime. */
+  ASSERT(!rsa_privkey_export(out, &len, vpriv, sizeof(vpriv)));
+
+  /* Corrupt the third prime's coefficient. */
+  memcpy(priv, vpriv, sizeof(vpriv));
+
+  priv[sizeof(vpriv) - 1] ^= 1;
+
+  ASSERT(!rsa_privkey_verify(priv, sizeof(vpriv)));
+
+  /* Prime counts are limited by modulus size. */
+  ASSERT(!rsa_privkey_generate_multi(priv, &priv_len, 1024, 65537, 1, entropy));
+  ASSERT(!rsa_privkey_generate_multi(priv, &priv_len, 1024, 65537, 4, entropy));
+  ASSERT(!rsa_privkey_generate_multi(priv, &priv_len, 1000, 65537, 3, entropy));
+
+  for (primes = 2; primes <= 3; primes++) {
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ASSERT(rsa_privkey_generate_multi(priv, &priv_len, 1024, 65537,
+                                      primes, entropy));
+
+    ASSERT(priv[4] == 0x02 && priv[6] == (primes > 2));
+    ASSERT(rsa_privkey_verify(priv, priv_len));
+    ASSERT(rsa_privkey_bits(priv, priv_len) == 1024);
+
+    ASSERT(rsa_pubkey_create(pub, &pub_len, priv, priv_len));
+
+    sk = rsa_key_create_private(priv, priv_len);
+    pk = rsa_key_create_public(pub, pub_len);
+
+    ASSERT(sk != NULL && pk != NULL);
+
+    drbg_generate(rng, msg, 32);
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    j = drbg_uniform(rng, 128);
+
+    ASSERT(rsa_sign(sig, &sig_len, HASH_SHA256, msg, 32,
+                    priv, priv_len, entropy));
+
+    ASSERT(rsa_key_verify(HASH_SHA256, msg, 32, sig, sig_len, pk));
+
+    ASSERT(rsa_key_sign(out, &len, HASH_SHA256, msg, 32, sk, entropy));
+    ASSERT(len == sig_len && torsion_memcmp(out, sig, len) == 0);
+
+    sig[j] ^= 1;
+
+    ASSERT(!rsa_verify(HASH_SHA256, msg, 32, sig, sig_len, pub, pub_len));
+
+    drbg_generate(rng, msg, 32);
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ASSERT(rsa_encrypt_oaep(ct, &ct_len, HASH_SHA256, msg, 32,
+                            pub, pub_len, NULL, 0, entropy));
+
+    ASSERT(rsa_key_decrypt_oaep(pt, &pt_len, HASH_SHA256, ct, ct_len,
+                                sk, NULL, 0, entropy));
+
+    ASSERT(pt_len == 32 && torsion_memcmp(pt, msg, 32) == 0);
+
+    ct[j] ^= 1;
+
+    ASSERT(!rsa_decrypt_oaep(pt, &pt_len, HASH_SHA256, ct, ct_len,
+                             priv, priv_len, NULL, 0, entropy));
+
+    rsa_key_destroy(sk);
+    rsa_key_destroy(pk);
+  }
+}
+
+static void
+test_rsa_runner(drbg_t *rng) {
+  static unsigned char priv[RSA_MAX_PRIV_SIZE];
+  static unsigned char pub[RSA_MAX_PUB_SIZE];
+  static unsigned char sig[RSA_MAX_MOD_SIZE];
+  static unsigned char out[RSA_MAX_MOD_SIZE];
+  static unsigned char ct[RSA_MAX_MOD_SIZE];
+  static unsigned char pt[RSA_MAX_MOD_SIZE];
+  size_t priv_len, pub_len, sig_len, ct_len, pt_len, len;
+  unsigned char entropy[ENTROPY_SIZE];
+  unsigned char msg[32];
+  unsigned int primes;
+  rsa_key_t *sk;
+  size_t count;
+
+  for (primes = 2; primes <= 3; primes++) {
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ASSERT(rsa_privkey_generate_multi(priv, &priv_len, 1024, 65537,
+                                      primes, entropy));
+
+    ASSERT(rsa_pubkey_create(pub, &pub_len, priv, priv_len));
+
+    sk = rsa_key_create_private(priv, priv_len);
+
+    ASSERT(sk != NULL);
+
+    drbg_generate(rng, msg, 32);
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ASSERT(rsa_sign(sig, &sig_len, HASH_SHA256, msg, 32,
+                    priv, priv_len, entropy));
+
+    /* One job per prime, in any order. */
+    count = 0;
+
+    rsa_key_set_runner(sk, run_reverse, &count);
+
+    ASSERT(rsa_key_sign(out, &len, HASH_SHA256, msg, 32, sk, entropy));
+    ASSERT(len == sig_len && torsion_memcmp(out, sig, len) == 0);
+    ASSERT(count == primes);
+
+    ASSERT(rsa_encrypt_oaep(ct, &ct_len, HASH_SHA256, msg, 32,
+                            pub, pub_len, NULL, 0, entropy));
+
+    ASSERT(rsa_key_decrypt_oaep(pt, &pt_len, HASH_SHA256, ct, ct_len,
+                                sk, NULL, 0, entropy));
+
+    ASSERT(pt_len == 32 && torsion_memcmp(pt, msg, 32) == 0);
+    ASSERT(count == primes * 2);
+
+    /* A runner which skips a job must not leak a bad signature. */
+    rsa_key_set_runner(sk, run_drop, NULL);
+
+    ASSERT(!rsa_key_sign(out, &len, HASH_SHA256, msg, 32, sk, entropy));
+
+#ifdef TORSION_HAVE_THREADS
+    rsa_key_set_runner(sk, run_threads, NULL);
+
+    ASSERT(rsa_key_sign(out, &len, HASH_SHA256, msg, 32, sk, entropy));
+    ASSERT(len == sig_len && torsion_memcmp(out, sig, len) == 0);
+#endif
+
+    rsa_key_set_runner(sk, NULL, NULL);
+
+    ASSERT(rsa_key_sign(out, &len, HASH_SHA256, msg, 32, sk, entropy));
+    ASSERT(len == sig_len && torsion_memcmp(out, sig, len) == 0);
+
+    rsa_key_destroy(sk);
+  }
+}
+
+static void
+test_rsa_generate_runner(drbg_t *rng) {
+  static unsigned char expect[RSA_MAX_PRIV_SIZE];
+  static unsigned char priv[RSA_MAX_PRIV_SIZE];
+  unsigned char entropy[ENTROPY_SIZE];
+  size_t expect_len, priv_len;
+  unsigned int primes;
+  size_t count;
+
+  for (primes = 2; primes <= 3; primes++) {
+    drbg_generate(rng, entropy, sizeof(entropy));
+
+    ASSERT(rsa_privkey_generate_with_runner(expect, &expect_len, 1024, 65537,
+                                            primes, entropy, NULL, NULL));
+
+    ASSERT(rsa_privkey_verify(expect, expect_len));
+
+    /* One job per prime, in any order. */
+    count = 0;
+
+    ASSERT(rsa_privkey_generate_with_runner(priv, &priv_len, 1024, 65537,
+                                            primes, entropy,
+                                            run_reverse, &count));
+
+    ASSERT(priv_len == expect_len);
+    ASSERT(torsion_memcmp(priv, expect, priv_len) == 0);
+    ASSERT(count >= primes && count % primes == 0);
+
+    ASSERT(!rsa_privkey_generate_with_runner(priv, &priv_len, 1024, 65537,
+                                             primes, entropy,
+                                             run_drop, NULL));
+
+#ifdef TORSION_HAVE_THREADS
+    ASSERT(rsa_privkey_generate_with_runner(priv, &priv_len, 1024, 65537,
+                                            primes, entropy,
+                                            run_threads, NULL));
+
+    ASSERT(priv_len == expect_len);
+    ASSERT(torsion_memcmp(priv, expect, priv_len) == 0);
+#endif
+  }
+}
+
 /*
  * Stream
  */
@@ -5202,11 +6465,13 @@ static const torsion_test_t torsion_tests[] = {
 
   /* AEAD */
   T(aead_chachapoly),
+  T(aead_chachapoly_batch),
 
   /* Cipher */
   T(cipher_contexts),
   T(cipher_modes),
   T(cipher_aead),
+  T(cipher_gcm_batch),
 
   /* DRBG */
   T(drbg_hash),
@@ -5216,20 +6481,28 @@ static const torsion_test_t torsion_tests[] = {
   /* DSA */
   T(dsa_vectors),
   T(dsa_keygen),
+  T(dsa_generate_runner),
+  T(dsa_domain),
 
   /* ECC */
   T(ecc_internal),
   T(ecdsa_vectors),
   T(ecdsa_random),
+  T(ecdsa_presign),
+  T(ecdsa_recover_batch),
+  T(ecdsa_tweak_add_batch),
   T(ecdsa_sswu),
   T(ecdsa_svdw),
   T(bipschnorr_vectors),
   T(bipschnorr_random),
   T(bip340_vectors),
   T(bip340_random),
+  T(bip340_tweak_batch),
+  T(bip340_tweak_add_batch),
   T(ecdh_x25519),
   T(ecdh_x448),
   T(ecdh_random),
+  T(ecdh_batch),
   T(ecdh_elligator2),
   T(eddsa_vectors),
   T(eddsa_random),
@@ -5261,11 +6534,13 @@ static const torsion_test_t torsion_tests[] = {
   /* KDF */
   T(kdf_bcrypt),
   T(kdf_bcrypt_pbkdf),
+  T(kdf_bcrypt_pbkdf_runner),
   T(kdf_eb2k),
   T(kdf_hkdf),
   T(kdf_pbkdf2),
   T(kdf_pgpdf),
   T(kdf_scrypt),
+  T(kdf_scrypt_runner),
 
   /* MAC */
   T(mac_poly1305),
@@ -5296,6 +6571,10 @@ static const torsion_test_t torsion_tests[] = {
   /* RSA */
   T(rsa_vectors),
   T(rsa_random),
+  T(rsa_key),
+  T(rsa_multi),
+  T(rsa_runner),
+  T(rsa_generate_runner),
 
   /* Stream */
   T(stream_arc4),